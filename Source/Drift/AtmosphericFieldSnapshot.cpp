@@ -0,0 +1,103 @@
+// AtmosphericFieldSnapshot.cpp - Immutable copy of one atmospheric grid field for lock-free bulk sampling
+#include "AtmosphericFieldSnapshot.h"
+#include "Async/ParallelFor.h"
+
+namespace
+{
+    // Continuous grid coordinate -> lower sample index and blend weight, clamp-to-edge
+    FORCEINLINE void ResolveBilinearAxis(float GridCoord, int32 Count, int32& OutIndex0, int32& OutIndex1, float& OutAlpha)
+    {
+        // Cell centres sit at +0.5
+        const float Centred = FMath::Clamp(GridCoord - 0.5f, 0.0f, static_cast<float>(Count - 1));
+        OutIndex0 = FMath::Min(FMath::FloorToInt32(Centred), Count - 1);
+        OutIndex1 = FMath::Min(OutIndex0 + 1, Count - 1);
+        OutAlpha = Centred - OutIndex0;
+    }
+}
+
+float FAtmosphericFieldSnapshot::SampleNearest(const FVector2D& WorldXY) const
+{
+    if (!IsValid())
+    {
+        return 0.0f;
+    }
+
+    const int32 X = FMath::Clamp(static_cast<int32>((WorldXY.X - WorldMin.X) * GridPerWorld.X), 0, GridWidth - 1);
+    const int32 Y = FMath::Clamp(static_cast<int32>((WorldXY.Y - WorldMin.Y) * GridPerWorld.Y), 0, GridHeight - 1);
+    return Values[Y * GridWidth + X];
+}
+
+float FAtmosphericFieldSnapshot::SampleBilinear(const FVector2D& WorldXY) const
+{
+    if (!IsValid())
+    {
+        return 0.0f;
+    }
+
+    int32 X0, X1, Y0, Y1;
+    float FX, FY;
+    ResolveBilinearAxis((WorldXY.X - WorldMin.X) * GridPerWorld.X, GridWidth, X0, X1, FX);
+    ResolveBilinearAxis((WorldXY.Y - WorldMin.Y) * GridPerWorld.Y, GridHeight, Y0, Y1, FY);
+
+    const float* Row0 = Values.GetData() + Y0 * GridWidth;
+    const float* Row1 = Values.GetData() + Y1 * GridWidth;
+    const float Top = FMath::Lerp(Row0[X0], Row0[X1], FX);
+    const float Bottom = FMath::Lerp(Row1[X0], Row1[X1], FX);
+    return FMath::Lerp(Top, Bottom, FY);
+}
+
+void FAtmosphericFieldSnapshot::ResampleToGrid(const FVector2D& TargetOrigin, const FVector2D& TargetSpacing,
+                                               int32 TargetWidth, int32 TargetHeight, TArray<float>& OutValues) const
+{
+    TargetWidth = FMath::Max(TargetWidth, 0);
+    TargetHeight = FMath::Max(TargetHeight, 0);
+    OutValues.SetNumUninitialized(TargetWidth * TargetHeight, EAllowShrinking::No);
+
+    if (!IsValid())
+    {
+        if (OutValues.Num() > 0)
+        {
+            FMemory::Memzero(OutValues.GetData(), OutValues.Num() * sizeof(float));
+        }
+        return;
+    }
+
+    // Separable: every target column shares one source column pair and weight
+    TArray<int32> Column0, Column1;
+    TArray<float> ColumnAlpha;
+    Column0.SetNumUninitialized(TargetWidth);
+    Column1.SetNumUninitialized(TargetWidth);
+    ColumnAlpha.SetNumUninitialized(TargetWidth);
+
+    for (int32 I = 0; I < TargetWidth; I++)
+    {
+        const float GridX = (TargetOrigin.X + I * TargetSpacing.X - WorldMin.X) * GridPerWorld.X;
+        ResolveBilinearAxis(GridX, GridWidth, Column0[I], Column1[I], ColumnAlpha[I]);
+    }
+
+    const float* Source = Values.GetData();
+    float* Dest = OutValues.GetData();
+
+    // Small targets (the usual case) aren't worth waking workers for
+    const EParallelForFlags Flags = (TargetWidth * TargetHeight >= 64 * 1024) ? EParallelForFlags::None : EParallelForFlags::ForceSingleThread;
+
+    ParallelFor(TargetHeight, [&](int32 J)
+    {
+        int32 Y0, Y1;
+        float FY;
+        const float GridY = (TargetOrigin.Y + J * TargetSpacing.Y - WorldMin.Y) * GridPerWorld.Y;
+        ResolveBilinearAxis(GridY, GridHeight, Y0, Y1, FY);
+
+        const float* Row0 = Source + Y0 * GridWidth;
+        const float* Row1 = Source + Y1 * GridWidth;
+        float* Out = Dest + J * TargetWidth;
+
+        for (int32 I = 0; I < TargetWidth; I++)
+        {
+            const float FX = ColumnAlpha[I];
+            const float Top = Row0[Column0[I]] + (Row0[Column1[I]] - Row0[Column0[I]]) * FX;
+            const float Bottom = Row1[Column0[I]] + (Row1[Column1[I]] - Row1[Column0[I]]) * FX;
+            Out[I] = Top + (Bottom - Top) * FY;
+        }
+    }, Flags);
+}
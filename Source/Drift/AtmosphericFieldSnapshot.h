@@ -0,0 +1,58 @@
+// AtmosphericFieldSnapshot.h - Immutable copy of one atmospheric grid field for lock-free bulk sampling
+#pragma once
+
+#include "CoreMinimal.h"
+
+// Scalar fields of the atmospheric grid that can be snapshotted
+enum class EAtmosphericField : uint8
+{
+    Temperature,
+    Humidity,
+    MoistureMass,
+    CloudCover,
+    Precipitation,
+    WindX,
+    WindY,
+
+    Count
+};
+
+/**
+ * One field of the atmospheric grid plus the grid-to-world mapping at capture time.
+ *
+ * Never modified after UAtmosphericSystem publishes it, so any number of threads can
+ * sample it without locks while the simulation keeps running. Values are cell-centred:
+ * cell (X, Y) covers [X, X + 1) x [Y, Y + 1) in grid space, and bilinear filtering
+ * interpolates between cell centres with clamp-to-edge addressing.
+ */
+struct DRIFT_API FAtmosphericFieldSnapshot
+{
+    EAtmosphericField Field = EAtmosphericField::Temperature;
+    uint32 Version = 0;
+
+    int32 GridWidth = 0;
+    int32 GridHeight = 0;
+
+    // World XY of grid corner (0, 0) and world units -> grid cells scale (0 when unmapped)
+    FVector2D WorldMin = FVector2D::ZeroVector;
+    FVector2D GridPerWorld = FVector2D::ZeroVector;
+
+    TArray<float> Values;       // GridWidth x GridHeight, row-major
+
+    bool IsValid() const { return GridWidth > 0 && GridHeight > 0 && Values.Num() == GridWidth * GridHeight; }
+
+    // Cell containing the position (matches UAtmosphericSystem point queries)
+    float SampleNearest(const FVector2D& WorldXY) const;
+
+    float SampleBilinear(const FVector2D& WorldXY) const;
+
+    /**
+     * Bilinear resample onto a regular target grid in one pass.
+     * Target sample (I, J) is at TargetOrigin + (I, J) * TargetSpacing; OutValues is
+     * TargetWidth x TargetHeight, row-major. Column weights are computed once per call.
+     */
+    void ResampleToGrid(const FVector2D& TargetOrigin, const FVector2D& TargetSpacing,
+                        int32 TargetWidth, int32 TargetHeight, TArray<float>& OutValues) const;
+};
+
+typedef TSharedRef<const FAtmosphericFieldSnapshot, ESPMode::ThreadSafe> FAtmosphericFieldSnapshotRef;
@@ -0,0 +1,56 @@
+// AtmosphericGrid.cpp - Structure-of-arrays storage for the atmospheric simulation grid
+#include "AtmosphericGrid.h"
+
+void FAtmosphericGridSoA::Initialize(int32 InWidth, int32 InHeight)
+{
+    Width = FMath::Max(InWidth, 0);
+    Height = FMath::Max(InHeight, 0);
+    PaddedNum = Align(Width * Height, Lanes);
+
+    // Same defaults as FSimplifiedAtmosphericCell
+    Temperature.Init(288.15f, PaddedNum);
+    Humidity.Init(0.5f, PaddedNum);
+    MoistureMass.Init(0.0f, PaddedNum);
+    CloudCover.Init(0.0f, PaddedNum);
+    PrecipitationRate.Init(0.0f, PaddedNum);
+    WindX.Init(0.0f, PaddedNum);
+    WindY.Init(0.0f, PaddedNum);
+    Pressure.Init(101325.0f, PaddedNum);
+}
+
+FAtmosphericFieldArray& FAtmosphericGridSoA::GetField(EAtmosphericField Field)
+{
+    return const_cast<FAtmosphericFieldArray&>(static_cast<const FAtmosphericGridSoA*>(this)->GetField(Field));
+}
+
+const FAtmosphericFieldArray& FAtmosphericGridSoA::GetField(EAtmosphericField Field) const
+{
+    switch (Field)
+    {
+    case EAtmosphericField::Temperature: return Temperature;
+    case EAtmosphericField::Humidity: return Humidity;
+    case EAtmosphericField::MoistureMass: return MoistureMass;
+    case EAtmosphericField::CloudCover: return CloudCover;
+    case EAtmosphericField::Precipitation: return PrecipitationRate;
+    case EAtmosphericField::WindX: return WindX;
+    case EAtmosphericField::WindY: return WindY;
+    default:
+        checkNoEntry();
+        return Temperature;
+    }
+}
+
+FAtmosphericCellView FAtmosphericGridSoA::operator[](int32 Index)
+{
+    check(IsValidIndex(Index));
+    return FAtmosphericCellView{
+        Temperature[Index], Humidity[Index], MoistureMass[Index], CloudCover[Index],
+        PrecipitationRate[Index], WindX[Index], WindY[Index], Pressure[Index] };
+}
+
+SIZE_T FAtmosphericGridSoA::GetAllocatedSize() const
+{
+    return Temperature.GetAllocatedSize() + Humidity.GetAllocatedSize() + MoistureMass.GetAllocatedSize() +
+           CloudCover.GetAllocatedSize() + PrecipitationRate.GetAllocatedSize() + WindX.GetAllocatedSize() +
+           WindY.GetAllocatedSize() + Pressure.GetAllocatedSize();
+}
@@ -0,0 +1,68 @@
+// AtmosphericGrid.h - Structure-of-arrays storage for the atmospheric simulation grid
+// One 16-byte aligned float array per field, padded to whole SIMD vectors
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AtmosphericFieldSnapshot.h"
+
+typedef TArray<float, TAlignedHeapAllocator<16>> FAtmosphericFieldArray;
+
+/**
+ * Mutable view of one grid cell, for code written against the old per-cell struct
+ * (Grid[Index].MoistureMass += X keeps working). Wind is stored as two scalar fields.
+ */
+struct FAtmosphericCellView
+{
+    float& Temperature;
+    float& Humidity;
+    float& MoistureMass;
+    float& CloudCover;
+    float& PrecipitationRate;
+    float& WindX;
+    float& WindY;
+    float& Pressure;
+
+    FVector2D GetWindVector() const { return FVector2D(WindX, WindY); }
+    void SetWindVector(const FVector2D& Wind) { WindX = Wind.X; WindY = Wind.Y; }
+};
+
+/**
+ * Atmospheric grid fields, row-major Width x Height.
+ *
+ * Every array holds NumPadded() elements (Num() rounded up to a multiple of Lanes) so
+ * per-cell kernels run whole VectorRegister4Float iterations with aligned loads and no
+ * scalar tail. Padding cells carry default values and are never read back by queries.
+ */
+struct DRIFT_API FAtmosphericGridSoA
+{
+    static constexpr int32 Lanes = 4;
+
+    void Initialize(int32 InWidth, int32 InHeight);
+
+    int32 GetWidth() const { return Width; }
+    int32 GetHeight() const { return Height; }
+    int32 Num() const { return Width * Height; }
+    int32 NumPadded() const { return PaddedNum; }
+    bool IsValidIndex(int32 Index) const { return Index >= 0 && Index < Num(); }
+
+    FAtmosphericFieldArray& GetField(EAtmosphericField Field);
+    const FAtmosphericFieldArray& GetField(EAtmosphericField Field) const;
+
+    FAtmosphericCellView operator[](int32 Index);
+
+    SIZE_T GetAllocatedSize() const;
+
+    FAtmosphericFieldArray Temperature;        // Kelvin
+    FAtmosphericFieldArray Humidity;
+    FAtmosphericFieldArray MoistureMass;
+    FAtmosphericFieldArray CloudCover;
+    FAtmosphericFieldArray PrecipitationRate;
+    FAtmosphericFieldArray WindX;
+    FAtmosphericFieldArray WindY;
+    FAtmosphericFieldArray Pressure;           // Pascals
+
+private:
+    int32 Width = 0;
+    int32 Height = 0;
+    int32 PaddedNum = 0;
+};
@@ -0,0 +1,299 @@
+// AtmosphericSurfaceCache.cpp - Terrain height and surface water aggregated per atmosphere cell
+#include "AtmosphericSurfaceCache.h"
+#include "Algo/BinarySearch.h"
+#include "Algo/Unique.h"
+#include "Async/ParallelFor.h"
+
+namespace
+{
+    FORCEINLINE bool EdgesEqual(TConstArrayView<int32> A, TConstArrayView<int32> B)
+    {
+        return A.Num() == B.Num() && FMemory::Memcmp(A.GetData(), B.GetData(), A.Num() * sizeof(int32)) == 0;
+    }
+}
+
+// ============================================================================
+// LAYOUT
+// ============================================================================
+
+void FAtmosphericSurfaceCache::FAxisLayout::Build(int32 TerrainSize, TConstArrayView<int32> InCellEdges, int32 InTileSize)
+{
+    const int32 NumCells = InCellEdges.Num() - 1;
+    CellEdges = TArray<int32>(InCellEdges.GetData(), InCellEdges.Num());
+    CellFootprintBegin.SetNumUninitialized(NumCells);
+    CellFootprintEnd.SetNumUninitialized(NumCells);
+
+    for (int32 Cell = 0; Cell < NumCells; Cell++)
+    {
+        int32 Begin = FMath::Clamp(InCellEdges[Cell], 0, TerrainSize);
+        int32 End = FMath::Clamp(InCellEdges[Cell + 1], 0, TerrainSize);
+        if (End <= Begin)
+        {
+            // Off the heightmap: fall back to the nearest edge column/row
+            Begin = FMath::Min(Begin, TerrainSize - 1);
+            End = Begin + 1;
+        }
+        CellFootprintBegin[Cell] = Begin;
+        CellFootprintEnd[Cell] = End;
+    }
+
+    // Piece edges: every footprint edge plus every tile line
+    PieceEdges.Reset();
+    for (int32 Edge = 0; Edge < TerrainSize; Edge += InTileSize)
+    {
+        PieceEdges.Add(Edge);
+    }
+    PieceEdges.Add(TerrainSize);
+    PieceEdges.Append(CellFootprintBegin);
+    PieceEdges.Append(CellFootprintEnd);
+    PieceEdges.Sort();
+    PieceEdges.SetNum(Algo::Unique(PieceEdges));
+
+    CellPieceBegin.SetNumUninitialized(NumCells);
+    CellPieceEnd.SetNumUninitialized(NumCells);
+    for (int32 Cell = 0; Cell < NumCells; Cell++)
+    {
+        CellPieceBegin[Cell] = Algo::LowerBound(PieceEdges, CellFootprintBegin[Cell]);
+        CellPieceEnd[Cell] = Algo::LowerBound(PieceEdges, CellFootprintEnd[Cell]);
+    }
+}
+
+void FAtmosphericSurfaceCache::FAxisLayout::GetPieceRange(int32 Min, int32 Max, int32& OutFirst, int32& OutLast) const
+{
+    OutFirst = Algo::UpperBound(PieceEdges, Min) - 1;
+    OutLast = FMath::Min(Algo::UpperBound(PieceEdges, Max) - 1, NumPieces() - 1);
+}
+
+void FAtmosphericSurfaceCache::FAxisLayout::GetCellRange(int32 Min, int32 Max, int32& OutFirst, int32& OutLast) const
+{
+    // Footprint begins and ends are both nondecreasing, so the overlapping cells are contiguous
+    OutFirst = Algo::UpperBound(CellFootprintEnd, Min);
+    OutLast = Algo::UpperBound(CellFootprintBegin, Max) - 1;
+}
+
+void FAtmosphericSurfaceCache::Initialize(int32 InTerrainWidth, int32 InTerrainHeight, TConstArrayView<int32> ColumnEdges,
+                                          TConstArrayView<int32> RowEdges, int32 InTileSize)
+{
+    TerrainWidth = FMath::Max(InTerrainWidth, 0);
+    TerrainHeight = FMath::Max(InTerrainHeight, 0);
+    TileSize = FMath::Max(InTileSize, 1);
+    NumCellsX = FMath::Max(ColumnEdges.Num() - 1, 0);
+    NumCellsY = FMath::Max(RowEdges.Num() - 1, 0);
+    NumCellsUpdatedLastUpdate = 0;
+
+    if (TerrainWidth == 0 || TerrainHeight == 0)
+    {
+        NumCellsX = NumCellsY = 0;
+    }
+
+    if (!IsInitialized())
+    {
+        MeanHeight.Reset();
+        MaxHeight.Reset();
+        WaterFraction.Reset();
+        Pieces.Reset();
+        DirtyPieces.Reset();
+        DirtyPieceList.Reset();
+        DirtyCells.Reset();
+        DirtyCellList.Reset();
+        return;
+    }
+
+    AxisX.Build(TerrainWidth, ColumnEdges, TileSize);
+    AxisY.Build(TerrainHeight, RowEdges, TileSize);
+
+    const int32 NumPieces = AxisX.NumPieces() * AxisY.NumPieces();
+    Pieces.SetNum(NumPieces);
+    DirtyPieces.SetNumZeroed(NumPieces);
+    DirtyPieceList.Reset();
+
+    MeanHeight.SetNumZeroed(Num());
+    MaxHeight.SetNumZeroed(Num());
+    WaterFraction.SetNumZeroed(Num());
+    DirtyCells.SetNumZeroed(Num());
+    DirtyCellList.Reset();
+
+    MarkAllDirty();
+
+    UE_LOG(LogTemp, Verbose, TEXT("AtmosphericSurfaceCache: %dx%d cells over %dx%d heightmap, %d pieces"),
+           NumCellsX, NumCellsY, TerrainWidth, TerrainHeight, NumPieces);
+}
+
+bool FAtmosphericSurfaceCache::MatchesLayout(int32 InTerrainWidth, int32 InTerrainHeight, TConstArrayView<int32> ColumnEdges,
+                                             TConstArrayView<int32> RowEdges, int32 InTileSize) const
+{
+    return IsInitialized() &&
+           InTerrainWidth == TerrainWidth && InTerrainHeight == TerrainHeight &&
+           FMath::Max(InTileSize, 1) == TileSize &&
+           EdgesEqual(ColumnEdges, AxisX.CellEdges) &&
+           EdgesEqual(RowEdges, AxisY.CellEdges);
+}
+
+// ============================================================================
+// DIRTY TRACKING
+// ============================================================================
+
+void FAtmosphericSurfaceCache::MarkRegionDirty(const FIntRect& HeightmapRect)
+{
+    if (!IsInitialized())
+    {
+        return;
+    }
+
+    const int32 MinX = FMath::Max(HeightmapRect.Min.X, 0);
+    const int32 MinY = FMath::Max(HeightmapRect.Min.Y, 0);
+    const int32 MaxX = FMath::Min(HeightmapRect.Max.X, TerrainWidth - 1);
+    const int32 MaxY = FMath::Min(HeightmapRect.Max.Y, TerrainHeight - 1);
+    if (MaxX < MinX || MaxY < MinY)
+    {
+        return;
+    }
+
+    int32 FirstPieceX, LastPieceX, FirstPieceY, LastPieceY;
+    AxisX.GetPieceRange(MinX, MaxX, FirstPieceX, LastPieceX);
+    AxisY.GetPieceRange(MinY, MaxY, FirstPieceY, LastPieceY);
+
+    const int32 NumPiecesX = AxisX.NumPieces();
+    for (int32 PY = FirstPieceY; PY <= LastPieceY; PY++)
+    {
+        for (int32 PX = FirstPieceX; PX <= LastPieceX; PX++)
+        {
+            const int32 PieceIndex = PY * NumPiecesX + PX;
+            if (!DirtyPieces[PieceIndex])
+            {
+                DirtyPieces[PieceIndex] = 1;
+                DirtyPieceList.Add(PieceIndex);
+            }
+        }
+    }
+
+    int32 FirstCellX, LastCellX, FirstCellY, LastCellY;
+    AxisX.GetCellRange(MinX, MaxX, FirstCellX, LastCellX);
+    AxisY.GetCellRange(MinY, MaxY, FirstCellY, LastCellY);
+
+    for (int32 CY = FirstCellY; CY <= LastCellY; CY++)
+    {
+        for (int32 CX = FirstCellX; CX <= LastCellX; CX++)
+        {
+            const int32 CellIndex = CY * NumCellsX + CX;
+            if (!DirtyCells[CellIndex])
+            {
+                DirtyCells[CellIndex] = 1;
+                DirtyCellList.Add(CellIndex);
+            }
+        }
+    }
+}
+
+void FAtmosphericSurfaceCache::MarkAllDirty()
+{
+    MarkRegionDirty(FIntRect(0, 0, TerrainWidth - 1, TerrainHeight - 1));
+}
+
+// ============================================================================
+// UPDATE
+// ============================================================================
+
+void FAtmosphericSurfaceCache::Update(TConstArrayView<float> Heights, TConstArrayView<float> WaterDepths)
+{
+    NumCellsUpdatedLastUpdate = 0;
+    if (!IsInitialized() || DirtyPieceList.Num() == 0)
+    {
+        return;
+    }
+
+    const int32 NumTerrainCells = TerrainWidth * TerrainHeight;
+    const float* HeightData = Heights.Num() == NumTerrainCells ? Heights.GetData() : nullptr;
+    const float* WaterData = WaterDepths.Num() == NumTerrainCells ? WaterDepths.GetData() : nullptr;
+
+    // Pieces are disjoint; only worth spreading out for bulk changes (terrain regeneration, first fill)
+    ParallelFor(DirtyPieceList.Num(), [&](int32 ListIndex)
+    {
+        RecomputePiece(DirtyPieceList[ListIndex], HeightData, WaterData);
+    }, DirtyPieceList.Num() >= 64 ? EParallelForFlags::None : EParallelForFlags::ForceSingleThread);
+
+    for (int32 PieceIndex : DirtyPieceList)
+    {
+        DirtyPieces[PieceIndex] = 0;
+    }
+    DirtyPieceList.Reset();
+
+    for (int32 CellIndex : DirtyCellList)
+    {
+        RecombineCell(CellIndex);
+        DirtyCells[CellIndex] = 0;
+    }
+    NumCellsUpdatedLastUpdate = DirtyCellList.Num();
+    DirtyCellList.Reset();
+}
+
+void FAtmosphericSurfaceCache::RecomputePiece(int32 PieceIndex, const float* Heights, const float* WaterDepths)
+{
+    const int32 PX = PieceIndex % AxisX.NumPieces();
+    const int32 PY = PieceIndex / AxisX.NumPieces();
+    const int32 BeginX = AxisX.PieceEdges[PX];
+    const int32 EndX = AxisX.PieceEdges[PX + 1];
+    const int32 BeginY = AxisY.PieceEdges[PY];
+    const int32 EndY = AxisY.PieceEdges[PY + 1];
+
+    FSurfacePiece& Piece = Pieces[PieceIndex];
+    Piece.HeightSum = 0.0;
+    Piece.MaxHeight = Heights ? -MAX_flt : 0.0f;
+    Piece.WetCells = 0;
+
+    for (int32 Y = BeginY; Y < EndY; Y++)
+    {
+        if (Heights)
+        {
+            const float* Row = Heights + Y * TerrainWidth;
+            for (int32 X = BeginX; X < EndX; X++)
+            {
+                Piece.HeightSum += Row[X];
+                Piece.MaxHeight = FMath::Max(Piece.MaxHeight, Row[X]);
+            }
+        }
+        if (WaterDepths)
+        {
+            const float* Row = WaterDepths + Y * TerrainWidth;
+            for (int32 X = BeginX; X < EndX; X++)
+            {
+                Piece.WetCells += Row[X] > WetDepthThreshold ? 1 : 0;
+            }
+        }
+    }
+}
+
+void FAtmosphericSurfaceCache::RecombineCell(int32 CellIndex)
+{
+    const int32 CX = CellIndex % NumCellsX;
+    const int32 CY = CellIndex / NumCellsX;
+    const int32 NumPiecesX = AxisX.NumPieces();
+
+    double HeightSum = 0.0;
+    float CellMax = -MAX_flt;
+    int64 WetCells = 0;
+
+    for (int32 PY = AxisY.CellPieceBegin[CY]; PY < AxisY.CellPieceEnd[CY]; PY++)
+    {
+        for (int32 PX = AxisX.CellPieceBegin[CX]; PX < AxisX.CellPieceEnd[CX]; PX++)
+        {
+            const FSurfacePiece& Piece = Pieces[PY * NumPiecesX + PX];
+            HeightSum += Piece.HeightSum;
+            CellMax = FMath::Max(CellMax, Piece.MaxHeight);
+            WetCells += Piece.WetCells;
+        }
+    }
+
+    const int64 FootprintCells = int64(AxisX.CellFootprintEnd[CX] - AxisX.CellFootprintBegin[CX]) *
+                                 (AxisY.CellFootprintEnd[CY] - AxisY.CellFootprintBegin[CY]);
+    MeanHeight[CellIndex] = static_cast<float>(HeightSum / FootprintCells);
+    MaxHeight[CellIndex] = CellMax;
+    WaterFraction[CellIndex] = static_cast<float>(double(WetCells) / FootprintCells);
+}
+
+SIZE_T FAtmosphericSurfaceCache::GetAllocatedSize() const
+{
+    return MeanHeight.GetAllocatedSize() + MaxHeight.GetAllocatedSize() + WaterFraction.GetAllocatedSize() +
+           Pieces.GetAllocatedSize() + DirtyPieces.GetAllocatedSize() + DirtyPieceList.GetAllocatedSize() +
+           DirtyCells.GetAllocatedSize() + DirtyCellList.GetAllocatedSize();
+}
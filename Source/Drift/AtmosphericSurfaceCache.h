@@ -0,0 +1,110 @@
+// AtmosphericSurfaceCache.h - Terrain height and surface water aggregated per atmosphere cell
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Downsampled view of the terrain surface under the atmosphere grid: mean height, max
+ * height and wet-area fraction for every atmosphere cell.
+ *
+ * Two levels. The heightmap is cut along every atmosphere footprint edge and every
+ * TileSize line into pieces, so each piece lies inside one tile and inside or outside each
+ * footprint entirely; pieces hold height sum / max / wet count, and atmosphere cells
+ * combine the pieces under them. An edit
+ * only rereads the pieces it touches (a water tile is a whole number of pieces) and then
+ * recombines the few cells above them, so keeping the cache current costs as much as the
+ * change itself rather than a full heightmap scan.
+ *
+ * Footprints are given as per-column / per-row heightmap cell edges, so the cache does not
+ * know about world space. An empty footprint (atmosphere cell off the heightmap) is
+ * widened to the nearest heightmap column or row, like a clamped point sample.
+ */
+struct DRIFT_API FAtmosphericSurfaceCache
+{
+    // Depth above which a heightmap cell counts as wet (matches the evaporation threshold)
+    static constexpr float WetDepthThreshold = 0.01f;
+
+    /**
+     * ColumnEdges has NumCellsX + 1 nondecreasing heightmap X coordinates (RowEdges likewise
+     * for Y); atmosphere column C covers heightmap columns [ColumnEdges[C], ColumnEdges[C + 1]).
+     * Marks everything dirty.
+     */
+    void Initialize(int32 InTerrainWidth, int32 InTerrainHeight, TConstArrayView<int32> ColumnEdges,
+                    TConstArrayView<int32> RowEdges, int32 InTileSize);
+
+    bool IsInitialized() const { return NumCellsX > 0 && NumCellsY > 0; }
+
+    // True when Initialize() with these arguments would produce the current layout
+    bool MatchesLayout(int32 InTerrainWidth, int32 InTerrainHeight, TConstArrayView<int32> ColumnEdges,
+                       TConstArrayView<int32> RowEdges, int32 InTileSize) const;
+
+    // Heightmap cells (inclusive rect) whose height or water depth changed
+    void MarkRegionDirty(const FIntRect& HeightmapRect);
+    void MarkAllDirty();
+    bool HasDirtyRegions() const { return DirtyPieceList.Num() > 0; }
+
+    /**
+     * Rereads dirty pieces and recombines the atmosphere cells above them.
+     * Heights / WaterDepths are TerrainWidth x TerrainHeight; a mismatched view reads as 0.
+     */
+    void Update(TConstArrayView<float> Heights, TConstArrayView<float> WaterDepths);
+
+    int32 GetNumCellsX() const { return NumCellsX; }
+    int32 GetNumCellsY() const { return NumCellsY; }
+    int32 Num() const { return NumCellsX * NumCellsY; }
+
+    // Atmosphere cells recombined by the last Update() (0 when nothing changed)
+    int32 GetNumCellsUpdatedLastUpdate() const { return NumCellsUpdatedLastUpdate; }
+
+    SIZE_T GetAllocatedSize() const;
+
+    // Per atmosphere cell, row-major NumCellsX x NumCellsY
+    TArray<float> MeanHeight;
+    TArray<float> MaxHeight;
+    TArray<float> WaterFraction;   // Share of footprint cells deeper than WetDepthThreshold
+
+private:
+    struct FSurfacePiece
+    {
+        double HeightSum = 0.0;
+        float MaxHeight = 0.0f;
+        int32 WetCells = 0;
+    };
+
+    // Per axis: piece boundaries in heightmap cells, and each atmosphere cell's piece range
+    struct FAxisLayout
+    {
+        TArray<int32> CellEdges;           // As passed to Initialize()
+        TArray<int32> PieceEdges;          // NumPieces + 1 entries
+        TArray<int32> CellPieceBegin;      // Per atmosphere column/row
+        TArray<int32> CellPieceEnd;
+        TArray<int32> CellFootprintBegin;  // Heightmap range after empty footprints are widened
+        TArray<int32> CellFootprintEnd;
+
+        void Build(int32 TerrainSize, TConstArrayView<int32> CellEdges, int32 TileSize);
+        int32 NumPieces() const { return PieceEdges.Num() - 1; }
+
+        // Inclusive piece / atmosphere cell ranges overlapping heightmap cells [Min, Max]
+        void GetPieceRange(int32 Min, int32 Max, int32& OutFirst, int32& OutLast) const;
+        void GetCellRange(int32 Min, int32 Max, int32& OutFirst, int32& OutLast) const;
+    };
+
+    void RecomputePiece(int32 PieceIndex, const float* Heights, const float* WaterDepths);
+    void RecombineCell(int32 CellIndex);
+
+    int32 TerrainWidth = 0;
+    int32 TerrainHeight = 0;
+    int32 TileSize = 0;
+    int32 NumCellsX = 0;
+    int32 NumCellsY = 0;
+    int32 NumCellsUpdatedLastUpdate = 0;
+
+    FAxisLayout AxisX;
+    FAxisLayout AxisY;
+
+    TArray<FSurfacePiece> Pieces;
+    TArray<uint8> DirtyPieces;
+    TArray<int32> DirtyPieceList;
+    TArray<uint8> DirtyCells;
+    TArray<int32> DirtyCellList;
+};
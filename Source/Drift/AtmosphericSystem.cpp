@@ -4,6 +4,23 @@
 #include "DynamicTerrain.h"
 #include "WaterSystem.h"
 #include "Engine/World.h"
+#include "Async/ParallelFor.h"
+#include "Math/VectorRegister.h"
+
+namespace
+{
+    // A + (B - A) * Alpha, four cells at a time
+    FORCEINLINE VectorRegister4Float VectorLerpToward(const VectorRegister4Float& A, const VectorRegister4Float& B, const VectorRegister4Float& Alpha)
+    {
+        return VectorMultiplyAdd(VectorSubtract(B, A), Alpha, A);
+    }
+
+    // Row-parallel passes only pay off once the grid is well past the default 32x32
+    FORCEINLINE EParallelForFlags GetAtmosphereParallelFlags(int32 NumCells)
+    {
+        return NumCells >= 128 * 128 ? EParallelForFlags::None : EParallelForFlags::ForceSingleThread;
+    }
+}
 
 UAtmosphericSystem::UAtmosphericSystem()
 {
@@ -56,29 +73,10 @@ void UAtmosphericSystem::InitializeAtmosphericGrid()
 {
     FScopeLock Lock(&GridDataLock);
     
-    int32 TotalCells = GridResolutionX * GridResolutionY;
-    AtmosphericGrid.Empty(TotalCells);
-    AtmosphericGrid.SetNum(TotalCells);
+    // Every field starts at the per-cell defaults (15C, 50% humidity, 1 atm, calm)
+    AtmosphericGrid.Initialize(GridResolutionX, GridResolutionY);
     
-    // Initialize each cell
-    for (int32 Y = 0; Y < GridResolutionY; Y++)
-    {
-        for (int32 X = 0; X < GridResolutionX; X++)
-        {
-            int32 Index = GetGridIndex(X, Y);
-            FSimplifiedAtmosphericCell& Cell = AtmosphericGrid[Index];
-            
-            Cell.GridX = X;
-            Cell.GridY = Y;
-            Cell.Temperature = 288.15f;  // 15Â°C
-            Cell.Humidity = 0.5f;
-            Cell.MoistureMass = 0.0f;
-            Cell.CloudCover = 0.0f;
-            Cell.PrecipitationRate = 0.0f;
-            Cell.Pressure = 101325.0f;
-            Cell.WindVector = FVector2D::ZeroVector;
-        }
-    }
+    MarkFieldsChanged();
     
     UE_LOG(LogTemp, Log, TEXT("AtmosphericSystem: Grid initialized with %dx%d cells"),
            GridResolutionX, GridResolutionY);
@@ -159,11 +157,15 @@ void UAtmosphericSystem::UpdateAtmosphericPhysics(float DeltaTime)
         ApplyWeatherToGrid();
     }
     
+    RefreshSurfaceCache();
+    
     ProcessCondensationAndPrecipitation(DeltaTime);
     AdvectMoisture(DeltaTime);
     ApplyOrographicEffects(DeltaTime);
     ProcessEvaporation(DeltaTime);
     UpdateCloudPhysics(DeltaTime);
+    
+    MarkFieldsChanged();
 }
 
 // ===== WEATHER STATE MANAGEMENT =====
@@ -241,7 +243,11 @@ void UAtmosphericSystem::SetWeatherImmediate(EWeatherType NewWeather)
     WeatherTransitionProgress = 1.0f;
     
     // Immediately apply to grid
-    ApplyWeatherToGrid();
+    {
+        FScopeLock Lock(&GridDataLock);
+        ApplyWeatherToGrid();
+        MarkFieldsChanged();
+    }
     
     // Broadcast change
     OnWeatherChanged.Broadcast(CurrentWeather);
@@ -278,18 +284,28 @@ void UAtmosphericSystem::ApplyWeatherToGrid()
 {
     const float BlendFactor = 0.05f;  // Gentle influence per frame
     
-    for (FSimplifiedAtmosphericCell& Cell : AtmosphericGrid)
+    // Gradually influence towards weather state, don't overwrite
+    // Wind: Stable base direction, no per-frame randomness
+    const FVector2D TargetWind = FVector2D(CurrentWeather.WindDirection.X,
+        CurrentWeather.WindDirection.Y) * CurrentWeather.WindSpeed;
+    
+    const VectorRegister4Float VBlend = VectorSetFloat1(BlendFactor);
+    const VectorRegister4Float VCloudTarget = VectorSetFloat1(CurrentWeather.CloudCover);
+    const VectorRegister4Float VHumidityTarget = VectorSetFloat1(CurrentWeather.Humidity);
+    const VectorRegister4Float VWindXTarget = VectorSetFloat1(static_cast<float>(TargetWind.X));
+    const VectorRegister4Float VWindYTarget = VectorSetFloat1(static_cast<float>(TargetWind.Y));
+    
+    float* Cloud = AtmosphericGrid.CloudCover.GetData();
+    float* Humidity = AtmosphericGrid.Humidity.GetData();
+    float* WindX = AtmosphericGrid.WindX.GetData();
+    float* WindY = AtmosphericGrid.WindY.GetData();
+    
+    for (int32 i = 0; i < AtmosphericGrid.NumPadded(); i += FAtmosphericGridSoA::Lanes)
     {
-        // Gradually influence towards weather state, don't overwrite
-        Cell.CloudCover = FMath::Lerp(Cell.CloudCover,
-            CurrentWeather.CloudCover, BlendFactor);
-        Cell.Humidity = FMath::Lerp(Cell.Humidity,
-            CurrentWeather.Humidity, BlendFactor);
-        
-        // Wind: Stable base direction, no per-frame randomness
-        FVector2D TargetWind = FVector2D(CurrentWeather.WindDirection.X,
-            CurrentWeather.WindDirection.Y) * CurrentWeather.WindSpeed;
-        Cell.WindVector = FMath::Lerp(Cell.WindVector, TargetWind, BlendFactor);
+        VectorStoreAligned(VectorLerpToward(VectorLoadAligned(Cloud + i), VCloudTarget, VBlend), Cloud + i);
+        VectorStoreAligned(VectorLerpToward(VectorLoadAligned(Humidity + i), VHumidityTarget, VBlend), Humidity + i);
+        VectorStoreAligned(VectorLerpToward(VectorLoadAligned(WindX + i), VWindXTarget, VBlend), WindX + i);
+        VectorStoreAligned(VectorLerpToward(VectorLoadAligned(WindY + i), VWindYTarget, VBlend), WindY + i);
     }
 }
 
@@ -297,31 +313,44 @@ void UAtmosphericSystem::ApplyWeatherToGrid()
 
 void UAtmosphericSystem::ProcessCondensationAndPrecipitation(float DeltaTime)
 {
-    for (FSimplifiedAtmosphericCell& Cell : AtmosphericGrid)
+    // Condensation: actual vapour pressure is Humidity * SVP(T), so "actual > saturation"
+    // is Humidity > 1 and the relative excess (actual - SVP) / SVP is Humidity - 1.
+    // The Magnus exp() cancels out of both, leaving a branch-free select per cell.
+    const VectorRegister4Float VOne = VectorOne();
+    const VectorRegister4Float VDeltaTime = VectorSetFloat1(DeltaTime);
+    const VectorRegister4Float VCondenseRate = VectorSetFloat1(0.01f * DeltaTime);
+    const VectorRegister4Float VPrecipMinMoisture = VectorSetFloat1(0.005f);
+    const VectorRegister4Float VPrecipMinCloud = VectorSetFloat1(0.7f);
+    const VectorRegister4Float VPrecipRate = VectorSetFloat1(0.1f);
+    const VectorRegister4Float VPrecipAmount = VectorSetFloat1(0.1f * DeltaTime);
+    
+    float* Humidity = AtmosphericGrid.Humidity.GetData();
+    float* Moisture = AtmosphericGrid.MoistureMass.GetData();
+    float* Cloud = AtmosphericGrid.CloudCover.GetData();
+    float* Precip = AtmosphericGrid.PrecipitationRate.GetData();
+    
+    for (int32 i = 0; i < AtmosphericGrid.NumPadded(); i += FAtmosphericGridSoA::Lanes)
     {
-        // Calculate saturation vapor pressure
-        float SaturationVaporPressure = 611.0f * FMath::Exp((17.27f * (Cell.Temperature - 273.15f)) /
-                                                            (Cell.Temperature - 273.15f + 237.3f));
+        const VectorRegister4Float H = VectorLoadAligned(Humidity + i);
+        VectorRegister4Float M = VectorLoadAligned(Moisture + i);
+        VectorRegister4Float C = VectorLoadAligned(Cloud + i);
+        VectorRegister4Float R = VectorLoadAligned(Precip + i);
         
-        // Check for condensation
-        float ActualVaporPressure = Cell.Humidity * SaturationVaporPressure;
-        if (ActualVaporPressure > SaturationVaporPressure)
-        {
-            // Excess moisture condenses
-            float ExcessMoisture = (ActualVaporPressure - SaturationVaporPressure) / SaturationVaporPressure;
-            Cell.MoistureMass += ExcessMoisture * 0.01f * DeltaTime;
-            
-            // Update cloud cover
-            Cell.CloudCover = FMath::Min(Cell.CloudCover + ExcessMoisture * DeltaTime, 1.0f);
-        }
+        // Excess moisture condenses and builds cloud cover
+        const VectorRegister4Float CondenseMask = VectorCompareGT(H, VOne);
+        const VectorRegister4Float Excess = VectorSubtract(H, VOne);
+        M = VectorSelect(CondenseMask, VectorMultiplyAdd(Excess, VCondenseRate, M), M);
+        C = VectorSelect(CondenseMask, VectorMin(VectorMultiplyAdd(Excess, VDeltaTime, C), VOne), C);
         
-        // Check for precipitation
-        if (Cell.MoistureMass > 0.005f && Cell.CloudCover > 0.7f)
-        {
-            float PrecipitationAmount = Cell.MoistureMass * 0.1f * DeltaTime;
-            Cell.PrecipitationRate = PrecipitationAmount / DeltaTime;
-            Cell.MoistureMass -= PrecipitationAmount;
-        }
+        // Precipitation from moist, overcast cells (rate is left unchanged elsewhere)
+        const VectorRegister4Float PrecipMask = VectorBitwiseAnd(
+            VectorCompareGT(M, VPrecipMinMoisture), VectorCompareGT(C, VPrecipMinCloud));
+        R = VectorSelect(PrecipMask, VectorMultiply(M, VPrecipRate), R);
+        M = VectorSelect(PrecipMask, VectorSubtract(M, VectorMultiply(M, VPrecipAmount)), M);
+        
+        VectorStoreAligned(M, Moisture + i);
+        VectorStoreAligned(C, Cloud + i);
+        VectorStoreAligned(R, Precip + i);
     }
 }
 
@@ -329,70 +358,79 @@ void UAtmosphericSystem::AdvectMoisture(float DeltaTime)
 {
     FScopeLock Lock(&GridDataLock);
     
-    // Create temporary buffer for advected values
-    TArray<float> NewMoisture;
-    NewMoisture.SetNum(AtmosphericGrid.Num());
+    const int32 Width = AtmosphericGrid.GetWidth();
+    const int32 Height = AtmosphericGrid.GetHeight();
+    
+    // Persistent scratch buffer for advected values (only reallocates when the grid is resized)
+    FAtmosphericFieldArray& NewMoisture = AdvectedMoistureScratch;
+    if (NewMoisture.Num() != AtmosphericGrid.NumPadded())
+    {
+        NewMoisture.SetNumUninitialized(AtmosphericGrid.NumPadded());
+    }
     
-    for (int32 Y = 0; Y < GridResolutionY; Y++)
+    const float* Moisture = AtmosphericGrid.MoistureMass.GetData();
+    const float* WindX = AtmosphericGrid.WindX.GetData();
+    const float* WindY = AtmosphericGrid.WindY.GetData();
+    float* Out = NewMoisture.GetData();
+    const float BacktraceScale = DeltaTime / GridCellSize;
+    
+    // Rows are independent: each reads the old field and writes its own row of the new one
+    ParallelFor(Height, [&](int32 Y)
     {
-        for (int32 X = 0; X < GridResolutionX; X++)
+        for (int32 X = 0; X < Width; X++)
         {
-            const FSimplifiedAtmosphericCell& Cell = GetCell(X, Y);
+            const int32 Index = Y * Width + X;
             
             // Semi-Lagrangian advection
-            FVector2D BacktracePos = FVector2D(X, Y) - Cell.WindVector * DeltaTime / GridCellSize;
-            
-            // Bilinear interpolation at backtrace position
-            int32 X0 = FMath::FloorToInt(BacktracePos.X);
-            int32 Y0 = FMath::FloorToInt(BacktracePos.Y);
+            const float BacktraceX = X - WindX[Index] * BacktraceScale;
+            const float BacktraceY = Y - WindY[Index] * BacktraceScale;
             
-            // Clamp to grid bounds
-            X0 = FMath::Clamp(X0, 0, GridResolutionX - 2);
-            Y0 = FMath::Clamp(Y0, 0, GridResolutionY - 2);
+            // Bilinear interpolation at backtrace position, clamped to grid bounds
+            const int32 X0 = FMath::Clamp(FMath::FloorToInt32(BacktraceX), 0, Width - 2);
+            const int32 Y0 = FMath::Clamp(FMath::FloorToInt32(BacktraceY), 0, Height - 2);
             
-            float fx = BacktracePos.X - X0;
-            float fy = BacktracePos.Y - Y0;
+            const float fx = BacktraceX - X0;
+            const float fy = BacktraceY - Y0;
             
             // Interpolate moisture from surrounding cells
-            float M00 = GetCell(X0, Y0).MoistureMass;
-            float M10 = GetCell(X0 + 1, Y0).MoistureMass;
-            float M01 = GetCell(X0, Y0 + 1).MoistureMass;
-            float M11 = GetCell(X0 + 1, Y0 + 1).MoistureMass;
+            const float* Row0 = Moisture + Y0 * Width + X0;
+            const float* Row1 = Row0 + Width;
             
-            NewMoisture[GetGridIndex(X, Y)] =
-                M00 * (1-fx) * (1-fy) +
-                M10 * fx * (1-fy) +
-                M01 * (1-fx) * fy +
-                M11 * fx * fy;
+            Out[Index] =
+                Row0[0] * (1-fx) * (1-fy) +
+                Row0[1] * fx * (1-fy) +
+                Row1[0] * (1-fx) * fy +
+                Row1[1] * fx * fy;
         }
-    }
+    }, GetAtmosphereParallelFlags(Width * Height));
     
-    // Copy back advected values
-    for (int32 i = 0; i < AtmosphericGrid.Num(); i++)
+    // Padding lanes carry over, then publish by swapping buffers (no copy back)
+    for (int32 i = AtmosphericGrid.Num(); i < AtmosphericGrid.NumPadded(); i++)
     {
-        AtmosphericGrid[i].MoistureMass = NewMoisture[i];
+        Out[i] = Moisture[i];
     }
+    Swap(AtmosphericGrid.MoistureMass, NewMoisture);
 }
 
 void UAtmosphericSystem::ProcessEvaporation(float DeltaTime)
 {
-    if (!WaterSystem) return;
+    if (!WaterSystem || SurfaceCache.Num() != AtmosphericGrid.Num()) return;
+    
+    const float* WaterFraction = SurfaceCache.WaterFraction.GetData();
     
-    for (FSimplifiedAtmosphericCell& Cell : AtmosphericGrid)
+    for (int32 Index = 0; Index < AtmosphericGrid.Num(); Index++)
     {
-        FVector WorldPos = GridToWorldCoordinates(Cell.GridX, Cell.GridY);
-        
-        // Check for water presence
-        float WaterDepth = WaterSystem->GetWaterDepthAtPosition(WorldPos);
-        if (WaterDepth > 0.01f)
+        // Evaporation scales with the wet share of the cell's footprint
+        if (WaterFraction[Index] > 0.0f)
         {
             // Calculate evaporation rate based on temperature and wind
-            float EvaporationRate = 0.001f * (Cell.Temperature / 288.15f) *
-                                   (1.0f + Cell.WindVector.Size() / 10.0f);
+            const float WindSpeed = FMath::Sqrt(FMath::Square(AtmosphericGrid.WindX[Index]) + FMath::Square(AtmosphericGrid.WindY[Index]));
+            float EvaporationRate = 0.001f * WaterFraction[Index] * (AtmosphericGrid.Temperature[Index] / 288.15f) *
+                                   (1.0f + WindSpeed / 10.0f);
             
             // Add moisture to atmosphere
-            Cell.MoistureMass += EvaporationRate * DeltaTime;
-            Cell.Humidity = FMath::Min(Cell.Humidity + EvaporationRate * 0.1f * DeltaTime, 1.0f);
+            AtmosphericGrid.MoistureMass[Index] += EvaporationRate * DeltaTime;
+            AtmosphericGrid.Humidity[Index] = FMath::Min(AtmosphericGrid.Humidity[Index] + EvaporationRate * 0.1f * DeltaTime, 1.0f);
         }
     }
 }
@@ -420,18 +458,21 @@ void UAtmosphericSystem::ApplyWindImpulse(FVector2D Location, FVector2D WindVect
 {
     FScopeLock Lock(&GridDataLock);
     
-    for (FSimplifiedAtmosphericCell& Cell : AtmosphericGrid)
+    for (int32 Index = 0; Index < AtmosphericGrid.Num(); Index++)
     {
-        FVector WorldPos = GridToWorldCoordinates(Cell.GridX, Cell.GridY);
+        FVector WorldPos = GridToWorldCoordinates(Index % AtmosphericGrid.GetWidth(), Index / AtmosphericGrid.GetWidth());
         FVector2D CellPos(WorldPos.X, WorldPos.Y);
         
         float Distance = FVector2D::Distance(CellPos, Location);
         if (Distance < Radius)
         {
             float Falloff = 1.0f - (Distance / Radius);
-            Cell.WindVector += WindVector * Strength * Falloff;
+            AtmosphericGrid.WindX[Index] += WindVector.X * Strength * Falloff;
+            AtmosphericGrid.WindY[Index] += WindVector.Y * Strength * Falloff;
         }
     }
+    
+    MarkFieldsChanged();
 }
 
 // ===== DATA QUERY INTERFACE =====
@@ -443,22 +484,14 @@ TArray<FAtmosphericCellData> UAtmosphericSystem::GetCellsInRadius(FVector WorldP
     
     float RadiusSq = Radius * Radius;
     
-    for (const FSimplifiedAtmosphericCell& Cell : AtmosphericGrid)
+    for (int32 Index = 0; Index < AtmosphericGrid.Num(); Index++)
     {
-        FVector CellWorldPos = GridToWorldCoordinates(Cell.GridX, Cell.GridY);
+        FVector CellWorldPos = GridToWorldCoordinates(Index % AtmosphericGrid.GetWidth(), Index / AtmosphericGrid.GetWidth());
         float DistSq = FVector::DistSquared(CellWorldPos, WorldPosition);
         
         if (DistSq <= RadiusSq)
         {
-            FAtmosphericCellData Data;
-            Data.WorldPosition = CellWorldPos;
-            Data.Temperature = Cell.Temperature;
-            Data.Humidity = Cell.Humidity;
-            Data.CloudCover = Cell.CloudCover;
-            Data.PrecipitationRate = Cell.PrecipitationRate;
-            Data.WindVector = Cell.WindVector;
-            Data.MoistureMass = Cell.MoistureMass;
-            Results.Add(Data);
+            Results.Add(MakeCellData(Index, CellWorldPos));
         }
     }
     
@@ -470,19 +503,12 @@ TArray<FAtmosphericCellData> UAtmosphericSystem::GetAllCellsWithClouds(float Min
     FScopeLock Lock(&GridDataLock);
     TArray<FAtmosphericCellData> Results;
     
-    for (const FSimplifiedAtmosphericCell& Cell : AtmosphericGrid)
+    for (int32 Index = 0; Index < AtmosphericGrid.Num(); Index++)
     {
-        if (Cell.CloudCover >= MinCloudCover)
+        if (AtmosphericGrid.CloudCover[Index] >= MinCloudCover)
         {
-            FAtmosphericCellData Data;
-            Data.WorldPosition = GridToWorldCoordinates(Cell.GridX, Cell.GridY);
-            Data.Temperature = Cell.Temperature;
-            Data.Humidity = Cell.Humidity;
-            Data.CloudCover = Cell.CloudCover;
-            Data.PrecipitationRate = Cell.PrecipitationRate;
-            Data.WindVector = Cell.WindVector;
-            Data.MoistureMass = Cell.MoistureMass;
-            Results.Add(Data);
+            FVector WorldPos = GridToWorldCoordinates(Index % AtmosphericGrid.GetWidth(), Index / AtmosphericGrid.GetWidth());
+            Results.Add(MakeCellData(Index, WorldPos));
         }
     }
     
@@ -494,19 +520,12 @@ TArray<FAtmosphericCellData> UAtmosphericSystem::GetAllCellsWithPrecipitation(fl
     FScopeLock Lock(&GridDataLock);
     TArray<FAtmosphericCellData> Results;
     
-    for (const FSimplifiedAtmosphericCell& Cell : AtmosphericGrid)
+    for (int32 Index = 0; Index < AtmosphericGrid.Num(); Index++)
     {
-        if (Cell.PrecipitationRate >= MinRate)
+        if (AtmosphericGrid.PrecipitationRate[Index] >= MinRate)
         {
-            FAtmosphericCellData Data;
-            Data.WorldPosition = GridToWorldCoordinates(Cell.GridX, Cell.GridY);
-            Data.Temperature = Cell.Temperature;
-            Data.Humidity = Cell.Humidity;
-            Data.CloudCover = Cell.CloudCover;
-            Data.PrecipitationRate = Cell.PrecipitationRate;
-            Data.WindVector = Cell.WindVector;
-            Data.MoistureMass = Cell.MoistureMass;
-            Results.Add(Data);
+            FVector WorldPos = GridToWorldCoordinates(Index % AtmosphericGrid.GetWidth(), Index / AtmosphericGrid.GetWidth());
+            Results.Add(MakeCellData(Index, WorldPos));
         }
     }
     
@@ -521,17 +540,19 @@ FAtmosphericCellData UAtmosphericSystem::GetDataAtWorldPosition(FVector WorldPos
     int32 X = FMath::Clamp((int32)GridPos.X, 0, GridResolutionX - 1);
     int32 Y = FMath::Clamp((int32)GridPos.Y, 0, GridResolutionY - 1);
     
-    const FSimplifiedAtmosphericCell& Cell = GetCell(X, Y);
-    
+    return MakeCellData(GetGridIndex(X, Y), GridToWorldCoordinates(X, Y));
+}
+
+FAtmosphericCellData UAtmosphericSystem::MakeCellData(int32 Index, const FVector& WorldPosition) const
+{
     FAtmosphericCellData Data;
-    Data.WorldPosition = GridToWorldCoordinates(X, Y);
-    Data.Temperature = Cell.Temperature;
-    Data.Humidity = Cell.Humidity;
-    Data.CloudCover = Cell.CloudCover;
-    Data.PrecipitationRate = Cell.PrecipitationRate;
-    Data.WindVector = Cell.WindVector;
-    Data.MoistureMass = Cell.MoistureMass;
-    
+    Data.WorldPosition = WorldPosition;
+    Data.Temperature = AtmosphericGrid.Temperature[Index];
+    Data.Humidity = AtmosphericGrid.Humidity[Index];
+    Data.CloudCover = AtmosphericGrid.CloudCover[Index];
+    Data.PrecipitationRate = AtmosphericGrid.PrecipitationRate[Index];
+    Data.WindVector = FVector2D(AtmosphericGrid.WindX[Index], AtmosphericGrid.WindY[Index]);
+    Data.MoistureMass = AtmosphericGrid.MoistureMass[Index];
     return Data;
 }
 
@@ -557,14 +578,15 @@ void UAtmosphericSystem::TransferPrecipitationToSurface()
     
     FScopeLock Lock(&GridDataLock);
     
-    for (const FSimplifiedAtmosphericCell& Cell : AtmosphericGrid)
+    for (int32 Index = 0; Index < AtmosphericGrid.Num(); Index++)
     {
-        if (Cell.PrecipitationRate > 0.0f)
+        const float PrecipitationRate = AtmosphericGrid.PrecipitationRate[Index];
+        if (PrecipitationRate > 0.0f)
         {
-            FVector WorldPos = GridToWorldCoordinates(Cell.GridX, Cell.GridY);
+            FVector WorldPos = GridToWorldCoordinates(Index % AtmosphericGrid.GetWidth(), Index / AtmosphericGrid.GetWidth());
             
             // Transfer to water system via master controller
-            float VolumeToAdd = Cell.PrecipitationRate * GridCellSize * GridCellSize * 0.001f;
+            float VolumeToAdd = PrecipitationRate * GridCellSize * GridCellSize * 0.001f;
             MasterController->TransferAtmosphereToSurface(WorldPos, VolumeToAdd);
         }
     }
@@ -577,14 +599,26 @@ int32 UAtmosphericSystem::GetGridIndex(int32 X, int32 Y) const
     return Y * GridResolutionX + X;
 }
 
-FSimplifiedAtmosphericCell& UAtmosphericSystem::GetCell(int32 X, int32 Y)
+FAtmosphericCellView UAtmosphericSystem::GetCell(int32 X, int32 Y)
 {
     return AtmosphericGrid[GetGridIndex(X, Y)];
 }
 
-const FSimplifiedAtmosphericCell& UAtmosphericSystem::GetCell(int32 X, int32 Y) const
+FSimplifiedAtmosphericCell UAtmosphericSystem::GetCell(int32 X, int32 Y) const
 {
-    return AtmosphericGrid[GetGridIndex(X, Y)];
+    const int32 Index = GetGridIndex(X, Y);
+    
+    FSimplifiedAtmosphericCell Cell;
+    Cell.Temperature = AtmosphericGrid.Temperature[Index];
+    Cell.Humidity = AtmosphericGrid.Humidity[Index];
+    Cell.MoistureMass = AtmosphericGrid.MoistureMass[Index];
+    Cell.CloudCover = AtmosphericGrid.CloudCover[Index];
+    Cell.PrecipitationRate = AtmosphericGrid.PrecipitationRate[Index];
+    Cell.WindVector = FVector2D(AtmosphericGrid.WindX[Index], AtmosphericGrid.WindY[Index]);
+    Cell.Pressure = AtmosphericGrid.Pressure[Index];
+    Cell.GridX = X;
+    Cell.GridY = Y;
+    return Cell;
 }
 
 FVector2D UAtmosphericSystem::WorldToGridCoordinates(FVector WorldPosition) const
@@ -684,30 +718,34 @@ void UAtmosphericSystem::CreateWeatherEffect(FVector2D Location, float Radius, f
     FScopeLock Lock(&GridDataLock);
     
     // Apply weather effect to grid cells within radius
-    for (FSimplifiedAtmosphericCell& Cell : AtmosphericGrid)
+    for (int32 Index = 0; Index < AtmosphericGrid.Num(); Index++)
     {
-        FVector WorldPos = GridToWorldCoordinates(Cell.GridX, Cell.GridY);
+        FVector WorldPos = GridToWorldCoordinates(Index % AtmosphericGrid.GetWidth(), Index / AtmosphericGrid.GetWidth());
         FVector2D CellPos(WorldPos.X, WorldPos.Y);
         
         float Distance = FVector2D::Distance(CellPos, Location);
         if (Distance < Radius)
         {
             float Falloff = 1.0f - (Distance / Radius);
+            float& MoistureMass = AtmosphericGrid.MoistureMass[Index];
+            float& CloudCover = AtmosphericGrid.CloudCover[Index];
             
             // Apply intensity to moisture
             if (Intensity > 0)
             {
-                Cell.MoistureMass += Intensity * Falloff * 0.01f;
-                Cell.CloudCover = FMath::Min(Cell.CloudCover + Intensity * Falloff * 0.1f, 1.0f);
+                MoistureMass += Intensity * Falloff * 0.01f;
+                CloudCover = FMath::Min(CloudCover + Intensity * Falloff * 0.1f, 1.0f);
             }
             else
             {
                 // Negative intensity removes moisture
-                Cell.MoistureMass = FMath::Max(Cell.MoistureMass + Intensity * Falloff * 0.01f, 0.0f);
-                Cell.CloudCover = FMath::Max(Cell.CloudCover + Intensity * Falloff * 0.1f, 0.0f);
+                MoistureMass = FMath::Max(MoistureMass + Intensity * Falloff * 0.01f, 0.0f);
+                CloudCover = FMath::Max(CloudCover + Intensity * Falloff * 0.1f, 0.0f);
             }
         }
     }
+    
+    MarkFieldsChanged();
 }
 
 void UAtmosphericSystem::DebugDrawAtmosphericState() const
@@ -718,26 +756,114 @@ void UAtmosphericSystem::DebugDrawAtmosphericState() const
 
 float UAtmosphericSystem::GetTemperatureAt(FVector WorldPosition) const
 {
-    FAtmosphericCellData Data = GetDataAtWorldPosition(WorldPosition);
-    return Data.Temperature;
+    return GetFieldAt(WorldPosition, EAtmosphericField::Temperature);
 }
 
 float UAtmosphericSystem::GetHumidityAt(FVector WorldPosition) const
 {
-    FAtmosphericCellData Data = GetDataAtWorldPosition(WorldPosition);
-    return Data.Humidity;
+    return GetFieldAt(WorldPosition, EAtmosphericField::Humidity);
 }
 
 float UAtmosphericSystem::GetPrecipitationAt(FVector WorldPosition) const
 {
-    FAtmosphericCellData Data = GetDataAtWorldPosition(WorldPosition);
-    return Data.PrecipitationRate;
+    return GetFieldAt(WorldPosition, EAtmosphericField::Precipitation);
 }
 
 FVector UAtmosphericSystem::GetWindAt(FVector WorldPosition) const
 {
-    FAtmosphericCellData Data = GetDataAtWorldPosition(WorldPosition);
-    return FVector(Data.WindVector.X, Data.WindVector.Y, 0);
+    FScopeLock Lock(&GridDataLock);
+    if (AtmosphericGrid.Num() == 0)
+        return FVector::ZeroVector;
+    
+    FVector2D GridPos = WorldToGridCoordinates(WorldPosition);
+    int32 X = FMath::Clamp((int32)GridPos.X, 0, GridResolutionX - 1);
+    int32 Y = FMath::Clamp((int32)GridPos.Y, 0, GridResolutionY - 1);
+    
+    const int32 Index = GetGridIndex(X, Y);
+    return FVector(AtmosphericGrid.WindX[Index], AtmosphericGrid.WindY[Index], 0);
+}
+
+// ===== BULK SAMPLING =====
+
+float UAtmosphericSystem::GetFieldAt(FVector WorldPosition, EAtmosphericField Field) const
+{
+    // Same cell as GetDataAtWorldPosition, without building a full FAtmosphericCellData
+    // (whose WorldPosition needs a terrain height query)
+    FScopeLock Lock(&GridDataLock);
+    if (AtmosphericGrid.Num() == 0)
+        return 0.0f;
+    
+    FVector2D GridPos = WorldToGridCoordinates(WorldPosition);
+    int32 X = FMath::Clamp((int32)GridPos.X, 0, GridResolutionX - 1);
+    int32 Y = FMath::Clamp((int32)GridPos.Y, 0, GridResolutionY - 1);
+    
+    return AtmosphericGrid.GetField(Field)[GetGridIndex(X, Y)];
+}
+
+
+
+void UAtmosphericSystem::MarkFieldsChanged()
+{
+    FScopeLock Lock(&GridDataLock);
+    FieldVersion++;
+}
+
+void UAtmosphericSystem::GetGridWorldMapping(FVector2D& OutWorldMin, FVector2D& OutGridPerWorld) const
+{
+    // Inverse of WorldToGridCoordinates; unmapped grids collapse every position onto cell (0, 0) like it does
+    OutWorldMin = FVector2D::ZeroVector;
+    OutGridPerWorld = FVector2D::ZeroVector;
+    
+    if (!TargetTerrain || !MasterController) return;
+    
+    FVector TerrainOrigin = TargetTerrain->GetActorLocation();
+    FVector2D WorldDims = MasterController->GetWorldDimensions();
+    float TerrainScale = MasterController->GetTerrainScale();
+    float TerrainWidth = WorldDims.X * TerrainScale;
+    float TerrainHeight = WorldDims.Y * TerrainScale;
+    
+    if (TerrainWidth <= 0.0f || TerrainHeight <= 0.0f) return;
+    
+    OutWorldMin = FVector2D(TerrainOrigin.X - TerrainWidth * 0.5f, TerrainOrigin.Y - TerrainHeight * 0.5f);
+    OutGridPerWorld = FVector2D(GridResolutionX / TerrainWidth, GridResolutionY / TerrainHeight);
+}
+
+FAtmosphericFieldSnapshotRef UAtmosphericSystem::GetFieldSnapshot(EAtmosphericField Field) const
+{
+    check(Field < EAtmosphericField::Count);
+    
+    FScopeLock Lock(&GridDataLock);
+    
+    TSharedPtr<const FAtmosphericFieldSnapshot, ESPMode::ThreadSafe>& Cached = FieldSnapshots[(int32)Field];
+    if (Cached.IsValid() && Cached->Version == FieldVersion)
+    {
+        return Cached.ToSharedRef();
+    }
+    
+    TSharedRef<FAtmosphericFieldSnapshot, ESPMode::ThreadSafe> Snapshot = MakeShared<FAtmosphericFieldSnapshot, ESPMode::ThreadSafe>();
+    Snapshot->Field = Field;
+    Snapshot->Version = FieldVersion;
+    GetGridWorldMapping(Snapshot->WorldMin, Snapshot->GridPerWorld);
+    
+    if (AtmosphericGrid.Num() > 0 && AtmosphericGrid.GetWidth() == GridResolutionX)
+    {
+        // SoA storage: the field is already contiguous, so the copy is a single memcpy
+        Snapshot->GridWidth = AtmosphericGrid.GetWidth();
+        Snapshot->GridHeight = AtmosphericGrid.GetHeight();
+        Snapshot->Values.SetNumUninitialized(AtmosphericGrid.Num());
+        FMemory::Memcpy(Snapshot->Values.GetData(), AtmosphericGrid.GetField(Field).GetData(), AtmosphericGrid.Num() * sizeof(float));
+    }
+    
+    Cached = Snapshot;
+    return Snapshot;
+}
+
+void UAtmosphericSystem::SampleFieldToGrid(EAtmosphericField Field, const FVector2D& TargetOrigin, const FVector2D& TargetSpacing,
+                                           int32 TargetWidth, int32 TargetHeight, TArray<float>& OutValues) const
+{
+    // Lock is held only while (re)building the snapshot; the resample itself runs lock-free
+    FAtmosphericFieldSnapshotRef Snapshot = GetFieldSnapshot(Field);
+    Snapshot->ResampleToGrid(TargetOrigin, TargetSpacing, TargetWidth, TargetHeight, OutValues);
 }
 
 float UAtmosphericSystem::GetAverageWind() const
@@ -745,9 +871,9 @@ float UAtmosphericSystem::GetAverageWind() const
     FScopeLock Lock(&GridDataLock);
     
     FVector2D AvgWind = FVector2D::ZeroVector;
-    for (const FSimplifiedAtmosphericCell& Cell : AtmosphericGrid)
+    for (int32 Index = 0; Index < AtmosphericGrid.Num(); Index++)
     {
-        AvgWind += Cell.WindVector;
+        AvgWind += FVector2D(AtmosphericGrid.WindX[Index], AtmosphericGrid.WindY[Index]);
     }
     
     if (AtmosphericGrid.Num() > 0)
@@ -758,51 +884,125 @@ float UAtmosphericSystem::GetAverageWind() const
     return AvgWind.Size();
 }
 
-const FSimplifiedAtmosphericCell* UAtmosphericSystem::GetCellDirect(int32 X, int32 Y) const
+bool UAtmosphericSystem::GetCellDirect(int32 X, int32 Y, FSimplifiedAtmosphericCell& OutCell) const
 {
-    if (X >= 0 && X < GridResolutionX && Y >= 0 && Y < GridResolutionY)
+    if (X >= 0 && X < GridResolutionX && Y >= 0 && Y < GridResolutionY && AtmosphericGrid.Num() > 0)
     {
-        return &AtmosphericGrid[GetGridIndex(X, Y)];
+        OutCell = GetCell(X, Y);
+        return true;
     }
-    return nullptr;
+    return false;
 }
 
 void UAtmosphericSystem::UpdateCloudPhysics(float DeltaTime)
 {
-    // Cloud physics update
-    for (FSimplifiedAtmosphericCell& Cell : AtmosphericGrid)
+    // Simple cloud evolution based on moisture: build while moist, dissipate otherwise
+    const VectorRegister4Float VMoistThreshold = VectorSetFloat1(0.001f);
+    const VectorRegister4Float VGrowth = VectorSetFloat1(DeltaTime * 0.1f);
+    const VectorRegister4Float VDecay = VectorSetFloat1(DeltaTime * 0.05f);
+    const VectorRegister4Float VOne = VectorOne();
+    const VectorRegister4Float VZero = VectorZeroFloat();
+    
+    const float* Moisture = AtmosphericGrid.MoistureMass.GetData();
+    float* Cloud = AtmosphericGrid.CloudCover.GetData();
+    
+    for (int32 i = 0; i < AtmosphericGrid.NumPadded(); i += FAtmosphericGridSoA::Lanes)
     {
-        // Simple cloud evolution based on moisture
-        if (Cell.MoistureMass > 0.001f)
-        {
-            Cell.CloudCover = FMath::Min(Cell.CloudCover + DeltaTime * 0.1f, 1.0f);
-        }
-        else
-        {
-            Cell.CloudCover = FMath::Max(Cell.CloudCover - DeltaTime * 0.05f, 0.0f);
-        }
+        const VectorRegister4Float C = VectorLoadAligned(Cloud + i);
+        const VectorRegister4Float MoistMask = VectorCompareGT(VectorLoadAligned(Moisture + i), VMoistThreshold);
+        const VectorRegister4Float Grown = VectorMin(VectorAdd(C, VGrowth), VOne);
+        const VectorRegister4Float Decayed = VectorMax(VectorSubtract(C, VDecay), VZero);
+        VectorStoreAligned(VectorSelect(MoistMask, Grown, Decayed), Cloud + i);
     }
 }
 
 void UAtmosphericSystem::ApplyOrographicEffects(float DeltaTime)
 {
-    if (!TargetTerrain) return;
+    if (!TargetTerrain || SurfaceCache.Num() != AtmosphericGrid.Num()) return;
+    
+    const float* MeanHeight = SurfaceCache.MeanHeight.GetData();
     
     // Orographic lift effect
-    for (FSimplifiedAtmosphericCell& Cell : AtmosphericGrid)
+    for (int32 Index = 0; Index < AtmosphericGrid.Num(); Index++)
     {
-        FVector WorldPos = GridToWorldCoordinates(Cell.GridX, Cell.GridY);
-        float Height = TargetTerrain->GetHeightAtPosition(WorldPos);
-        
         // Higher terrain causes more condensation
+        const float Height = MeanHeight[Index];
         if (Height > 100.0f)
         {
             float HeightFactor = Height / 1000.0f;
-            Cell.MoistureMass += HeightFactor * 0.001f * DeltaTime;
+            AtmosphericGrid.MoistureMass[Index] += HeightFactor * 0.001f * DeltaTime;
         }
     }
 }
 
+// ===== SURFACE CACHE =====
+
+void UAtmosphericSystem::MarkSurfaceRegionDirty(const FIntRect& HeightmapRect)
+{
+    FScopeLock Lock(&GridDataLock);
+    SurfaceCache.MarkRegionDirty(HeightmapRect);
+}
+
+void UAtmosphericSystem::MarkAllSurfaceDirty()
+{
+    FScopeLock Lock(&GridDataLock);
+    SurfaceCache.MarkAllDirty();
+}
+
+void UAtmosphericSystem::RefreshSurfaceCache()
+{
+    if (!TargetTerrain || !MasterController || TargetTerrain->HeightMap.Num() == 0) return;
+    
+    FScopeLock Lock(&GridDataLock);
+    
+    const int32 TerrainW = TargetTerrain->TerrainWidth;
+    const int32 TerrainH = TargetTerrain->TerrainHeight;
+    const float TerrainScale = MasterController->GetTerrainScale();
+    if (TerrainW * TerrainH != TargetTerrain->HeightMap.Num() || TerrainScale <= 0.0f) return;
+    
+    // Atmosphere cell edges in heightmap cells, through the same mapping as GridToWorldCoordinates
+    FVector2D WorldMin, GridPerWorld;
+    GetGridWorldMapping(WorldMin, GridPerWorld);
+    if (GridPerWorld.X <= 0.0 || GridPerWorld.Y <= 0.0) return;
+    
+    const FVector TerrainOrigin = TargetTerrain->GetActorLocation();
+    SurfaceColumnEdgesScratch.SetNumUninitialized(GridResolutionX + 1, EAllowShrinking::No);
+    SurfaceRowEdgesScratch.SetNumUninitialized(GridResolutionY + 1, EAllowShrinking::No);
+    for (int32 X = 0; X <= GridResolutionX; X++)
+    {
+        const double WorldX = WorldMin.X + X / GridPerWorld.X;
+        SurfaceColumnEdgesScratch[X] = FMath::FloorToInt32((WorldX - TerrainOrigin.X) / TerrainScale);
+    }
+    for (int32 Y = 0; Y <= GridResolutionY; Y++)
+    {
+        const double WorldY = WorldMin.Y + Y / GridPerWorld.Y;
+        SurfaceRowEdgesScratch[Y] = FMath::FloorToInt32((WorldY - TerrainOrigin.Y) / TerrainScale);
+    }
+    
+    if (!SurfaceCache.MatchesLayout(TerrainW, TerrainH, SurfaceColumnEdgesScratch, SurfaceRowEdgesScratch,
+                                    FWaterSimulationData::ActiveTileSize))
+    {
+        // First use, grid resize or terrain move: rebuild everything
+        SurfaceCache.Initialize(TerrainW, TerrainH, SurfaceColumnEdgesScratch, SurfaceRowEdgesScratch,
+                                FWaterSimulationData::ActiveTileSize);
+    }
+    
+    // Pull water tiles touched since the last refresh
+    TConstArrayView<float> WaterDepths;
+    if (WaterSystem && WaterSystem->SimulationData.IsValid() &&
+        WaterSystem->SimulationData.TerrainWidth == TerrainW &&
+        WaterSystem->SimulationData.WaterDepthMap.Num() == TerrainW * TerrainH)
+    {
+        WaterSystem->SimulationData.ConsumeChangedTiles(EWaterChangeConsumer::AtmosphereSurface, [this](const FIntRect& TileRect)
+        {
+            SurfaceCache.MarkRegionDirty(TileRect);
+        });
+        WaterDepths = WaterSystem->SimulationData.WaterDepthMap;
+    }
+    
+    SurfaceCache.Update(TargetTerrain->HeightMap, WaterDepths);
+}
+
 void UAtmosphericSystem::TriggerStorm(float Intensity, float Duration)
 {
     SetWeather(EWeatherType::Storm, 2.0f);
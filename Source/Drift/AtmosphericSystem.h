@@ -3,6 +3,8 @@
 
 #include "CoreMinimal.h"
 #include "GameFramework/Actor.h"
+#include "AtmosphericGrid.h"
+#include "AtmosphericSurfaceCache.h"
 #include "AtmosphericSystem.generated.h"
 
 // Forward declarations
@@ -38,6 +40,7 @@ enum class ESeason : uint8
 };
 
 // Atmospheric cell data for grid simulation
+// Storage is FAtmosphericGridSoA; this is the by-value compatibility view returned by GetCell()
 USTRUCT(BlueprintType)
 struct FSimplifiedAtmosphericCell
 {
@@ -139,6 +142,9 @@ class DRIFT_API UAtmosphericSystem : public UObject
 {
     GENERATED_BODY()
 
+    // Headless solver benchmark drives the private simulation passes directly
+    friend class UDriftBenchmarkCommandlet;
+
 public:
     UAtmosphericSystem();
 
@@ -248,8 +254,8 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Atmospheric Query")
     FAtmosphericCellData GetDataAtWorldPosition(FVector WorldPos) const;
     
-    // Direct cell access (thread-safe const methods)
-    const FSimplifiedAtmosphericCell* GetCellDirect(int32 X, int32 Y) const;
+    // Direct cell access (copies the cell; false if out of bounds)
+    bool GetCellDirect(int32 X, int32 Y, FSimplifiedAtmosphericCell& OutCell) const;
     
     // Weather state queries
     UFUNCTION(BlueprintCallable, Category = "Weather Query")
@@ -261,13 +267,24 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Weather Query")
     FWeatherData GetFullWeatherState() const { return CurrentWeather; }
     
-    // Simple world-space queries
+    // Simple world-space queries (nearest cell; one lock per call - use snapshots for bulk sampling)
     float GetTemperatureAt(FVector WorldPosition) const;
     float GetHumidityAt(FVector WorldPosition) const;
     float GetPrecipitationAt(FVector WorldPosition) const;
     FVector GetWindAt(FVector WorldPosition) const;
     float GetAverageWind() const;
     
+    // ===== BULK SAMPLING =====
+    // Immutable copy of one field, rebuilt at most once per grid change; sample it from any thread without locks
+    FAtmosphericFieldSnapshotRef GetFieldSnapshot(EAtmosphericField Field) const;
+    
+    // Snapshot + bilinear resample onto a regular world-space grid (sample (I, J) at Origin + (I, J) * Spacing)
+    void SampleFieldToGrid(EAtmosphericField Field, const FVector2D& TargetOrigin, const FVector2D& TargetSpacing,
+                           int32 TargetWidth, int32 TargetHeight, TArray<float>& OutValues) const;
+    
+    // Bumped whenever grid contents change; lets consumers skip resampling an unchanged field
+    uint32 GetFieldVersion() const { return FieldVersion; }
+    
     // Additional methods expected by existing systems
     void CreateWeatherEffect(FVector2D Location, float Radius, float Intensity);
     void DebugDrawAtmosphericState() const;
@@ -304,8 +321,8 @@ public:
     
     // Grid management
     int32 GetGridIndex(int32 X, int32 Y) const;
-    FSimplifiedAtmosphericCell& GetCell(int32 X, int32 Y);
-    const FSimplifiedAtmosphericCell& GetCell(int32 X, int32 Y) const;
+    FAtmosphericCellView GetCell(int32 X, int32 Y);
+    FSimplifiedAtmosphericCell GetCell(int32 X, int32 Y) const;
     FVector2D WorldToGridCoordinates(FVector WorldPosition) const;
     FVector GridToWorldCoordinates(int32 X, int32 Y) const;
     
@@ -316,10 +333,17 @@ public:
     int32 GridWidth = 32;  // Alias
     int32 GridHeight = 32;  // Alias
     
-    // Grid data
-    TArray<FSimplifiedAtmosphericCell> AtmosphericGrid;
+    // Grid data (SoA: one aligned array per field, see FAtmosphericGridSoA)
+    FAtmosphericGridSoA AtmosphericGrid;
     mutable FCriticalSection GridDataLock;
     
+    // Terrain height / surface water per atmosphere cell, refreshed at the start of each physics step
+    const FAtmosphericSurfaceCache& GetSurfaceCache() const { return SurfaceCache; }
+    
+    // Heightmap cells (inclusive) edited since the last step; water changes are pulled from the water system
+    void MarkSurfaceRegionDirty(const FIntRect& HeightmapRect);
+    void MarkAllSurfaceDirty();
+    
     
 private:
 
@@ -345,6 +369,24 @@ private:
     bool bGlobalWindActive = false;
     bool bSystemScaled = false;  // Track if system has been scaled
     
+    // Scratch buffers reused across ticks (avoid per-tick allocation)
+    FAtmosphericFieldArray AdvectedMoistureScratch;
+    TArray<int32> SurfaceColumnEdgesScratch;
+    TArray<int32> SurfaceRowEdgesScratch;
+    
+    // Guarded by GridDataLock
+    FAtmosphericSurfaceCache SurfaceCache;
+    void RefreshSurfaceCache();
+    
+    // Published field snapshots (guarded by GridDataLock), valid while their Version == FieldVersion
+    uint32 FieldVersion = 1;
+    mutable TSharedPtr<const FAtmosphericFieldSnapshot, ESPMode::ThreadSafe> FieldSnapshots[(int32)EAtmosphericField::Count];
+    
+    void MarkFieldsChanged();
+    void GetGridWorldMapping(FVector2D& OutWorldMin, FVector2D& OutGridPerWorld) const;
+    float GetFieldAt(FVector WorldPosition, EAtmosphericField Field) const;
+    FAtmosphericCellData MakeCellData(int32 Index, const FVector& WorldPosition) const;
+    
     // Physics simulation methods
     void UpdateAtmosphericPhysics(float DeltaTime);
     void ProcessCondensationAndPrecipitation(float DeltaTime);
@@ -0,0 +1,215 @@
+// ChunkUpdateScheduler.cpp - Deduplicating priority scheduler for terrain chunk rebuilds
+#include "ChunkUpdateScheduler.h"
+
+void FChunkUpdateScheduler::Reset(int32 NumChunks)
+{
+    FEntry Discard;
+    while (Incoming.Dequeue(Discard))
+    {
+    }
+    NumIncoming.store(0, std::memory_order_release);
+
+    Heap.Reset();
+    HeapPositions.Init(INDEX_NONE, FMath::Max(NumChunks, 0));
+    NextSequence = 0;
+}
+
+void FChunkUpdateScheduler::Enqueue(int32 ChunkIndex, float Priority, uint8 Flags)
+{
+    if (ChunkIndex < 0)
+    {
+        return;
+    }
+
+    FEntry Entry;
+    Entry.ChunkIndex = ChunkIndex;
+    Entry.Priority = Priority;
+    Entry.Flags = Flags;
+    Incoming.Enqueue(Entry);
+    NumIncoming.fetch_add(1, std::memory_order_release);
+}
+
+void FChunkUpdateScheduler::FlushIncoming()
+{
+    FlushIncoming([this](int32 ChunkIndex, float Priority, uint8 Flags)
+    {
+        Push(ChunkIndex, Priority);
+    });
+}
+
+void FChunkUpdateScheduler::FlushIncoming(TFunctionRef<void(int32 ChunkIndex, float Priority, uint8 Flags)> OnRequest)
+{
+    FEntry Entry;
+    while (Incoming.Dequeue(Entry))
+    {
+        NumIncoming.fetch_sub(1, std::memory_order_acq_rel);
+        OnRequest(Entry.ChunkIndex, Entry.Priority, Entry.Flags);
+    }
+}
+
+void FChunkUpdateScheduler::Push(int32 ChunkIndex, float Priority)
+{
+    if (ChunkIndex < 0)
+    {
+        return;
+    }
+
+    // Grow on demand so callers that never called Reset() still work
+    if (ChunkIndex >= HeapPositions.Num())
+    {
+        const int32 OldNum = HeapPositions.Num();
+        HeapPositions.SetNumUninitialized(ChunkIndex + 1);
+        for (int32 i = OldNum; i < HeapPositions.Num(); i++)
+        {
+            HeapPositions[i] = INDEX_NONE;
+        }
+    }
+
+    const int32 Existing = HeapPositions[ChunkIndex];
+    if (Existing != INDEX_NONE)
+    {
+        // Already scheduled: only ever raise the priority (keeps its place among equals)
+        if (Priority > Heap[Existing].Priority)
+        {
+            Heap[Existing].Priority = Priority;
+            SiftUp(Existing);
+        }
+        return;
+    }
+
+    FEntry Entry;
+    Entry.ChunkIndex = ChunkIndex;
+    Entry.Priority = Priority;
+    Entry.Sequence = NextSequence++;
+
+    const int32 HeapIndex = Heap.Add(Entry);
+    HeapPositions[ChunkIndex] = HeapIndex;
+    SiftUp(HeapIndex);
+}
+
+bool FChunkUpdateScheduler::Remove(int32 ChunkIndex)
+{
+    const int32 HeapIndex = FindHeapIndex(ChunkIndex);
+    if (HeapIndex == INDEX_NONE)
+    {
+        return false;
+    }
+
+    RemoveAt(HeapIndex);
+    return true;
+}
+
+bool FChunkUpdateScheduler::Pop(int32& OutChunkIndex, float* OutPriority)
+{
+    if (Heap.Num() == 0)
+    {
+        return false;
+    }
+
+    OutChunkIndex = Heap[0].ChunkIndex;
+    if (OutPriority)
+    {
+        *OutPriority = Heap[0].Priority;
+    }
+
+    RemoveAt(0);
+    return true;
+}
+
+bool FChunkUpdateScheduler::Contains(int32 ChunkIndex) const
+{
+    return FindHeapIndex(ChunkIndex) != INDEX_NONE;
+}
+
+bool FChunkUpdateScheduler::GetPriority(int32 ChunkIndex, float& OutPriority) const
+{
+    const int32 HeapIndex = FindHeapIndex(ChunkIndex);
+    if (HeapIndex == INDEX_NONE)
+    {
+        return false;
+    }
+
+    OutPriority = Heap[HeapIndex].Priority;
+    return true;
+}
+
+int32 FChunkUpdateScheduler::FindHeapIndex(int32 ChunkIndex) const
+{
+    return HeapPositions.IsValidIndex(ChunkIndex) ? HeapPositions[ChunkIndex] : INDEX_NONE;
+}
+
+void FChunkUpdateScheduler::SetAt(int32 HeapIndex, const FEntry& Entry)
+{
+    Heap[HeapIndex] = Entry;
+    HeapPositions[Entry.ChunkIndex] = HeapIndex;
+}
+
+void FChunkUpdateScheduler::RemoveAt(int32 HeapIndex)
+{
+    HeapPositions[Heap[HeapIndex].ChunkIndex] = INDEX_NONE;
+
+    const int32 LastIndex = Heap.Num() - 1;
+    if (HeapIndex != LastIndex)
+    {
+        // Move the last entry into the hole and restore heap order in whichever direction it needs
+        SetAt(HeapIndex, Heap[LastIndex]);
+        Heap.Pop(EAllowShrinking::No);
+        SiftDown(HeapIndex);
+        SiftUp(HeapIndex);
+    }
+    else
+    {
+        Heap.Pop(EAllowShrinking::No);
+    }
+}
+
+void FChunkUpdateScheduler::SiftUp(int32 HeapIndex)
+{
+    const FEntry Entry = Heap[HeapIndex];
+
+    while (HeapIndex > 0)
+    {
+        const int32 ParentIndex = (HeapIndex - 1) / 2;
+        if (!HasPrecedence(Entry, Heap[ParentIndex]))
+        {
+            break;
+        }
+
+        SetAt(HeapIndex, Heap[ParentIndex]);
+        HeapIndex = ParentIndex;
+    }
+
+    SetAt(HeapIndex, Entry);
+}
+
+void FChunkUpdateScheduler::SiftDown(int32 HeapIndex)
+{
+    const int32 Count = Heap.Num();
+    if (HeapIndex >= Count)
+    {
+        return;
+    }
+
+    const FEntry Entry = Heap[HeapIndex];
+
+    while (true)
+    {
+        const int32 LeftIndex = HeapIndex * 2 + 1;
+        if (LeftIndex >= Count)
+        {
+            break;
+        }
+
+        const int32 RightIndex = LeftIndex + 1;
+        const int32 BestChild = (RightIndex < Count && HasPrecedence(Heap[RightIndex], Heap[LeftIndex])) ? RightIndex : LeftIndex;
+        if (!HasPrecedence(Heap[BestChild], Entry))
+        {
+            break;
+        }
+
+        SetAt(HeapIndex, Heap[BestChild]);
+        HeapIndex = BestChild;
+    }
+
+    SetAt(HeapIndex, Entry);
+}
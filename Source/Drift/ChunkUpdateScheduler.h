@@ -0,0 +1,86 @@
+// ChunkUpdateScheduler.h - Deduplicating priority scheduler for terrain chunk rebuilds
+// Indexed binary heap drained on the game thread, fed by a lock-free multi-producer inbox
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Queue.h"
+#include <atomic>
+
+/**
+ * One entry per chunk, highest priority first (FIFO among equal priorities).
+ *
+ * Threading:
+ * - Enqueue() may be called from any thread without locks; requests land in an MPSC
+ *   queue and are merged into the heap by FlushIncoming(). Owners that keep per-chunk
+ *   state alongside the queue can tag requests with Flags and handle them in the
+ *   FlushIncoming() callback, so that state is only ever touched on the consumer thread.
+ * - Everything else is consumer-side and must run on the thread that drains the
+ *   scheduler (the game thread for ADynamicTerrain).
+ *
+ * Re-queuing a chunk that is already scheduled keeps the higher of the two priorities,
+ * so every insert, priority raise, removal and pop is O(log n) and the queue never holds
+ * duplicates.
+ */
+class DRIFT_API FChunkUpdateScheduler
+{
+public:
+    // Priority used for plain "this chunk is dirty" marks
+    static constexpr float BackgroundPriority = 0.0f;
+
+    // Drops everything and sizes the chunk lookup table
+    void Reset(int32 NumChunks = 0);
+
+    // Any thread, lock-free: the request becomes visible after the next FlushIncoming()
+    void Enqueue(int32 ChunkIndex, float Priority = BackgroundPriority, uint8 Flags = 0);
+
+    // Consumer thread: merges requests from other threads into the heap
+    void FlushIncoming();
+
+    // Consumer thread: hands each request from other threads to OnRequest instead (which usually Push()es it)
+    void FlushIncoming(TFunctionRef<void(int32 ChunkIndex, float Priority, uint8 Flags)> OnRequest);
+
+    // Consumer thread: insert, or raise the priority of an already scheduled chunk
+    void Push(int32 ChunkIndex, float Priority = BackgroundPriority);
+
+    // Consumer thread: returns true if the chunk was scheduled
+    bool Remove(int32 ChunkIndex);
+
+    // Consumer thread: takes the highest priority chunk
+    bool Pop(int32& OutChunkIndex, float* OutPriority = nullptr);
+
+    // Consumer thread queries
+    bool Contains(int32 ChunkIndex) const;
+    bool GetPriority(int32 ChunkIndex, float& OutPriority) const;
+    int32 Num() const { return Heap.Num(); }
+
+    // Any thread: true when nothing is scheduled or waiting in the inbox
+    bool IsEmpty() const { return Heap.Num() == 0 && NumIncoming.load(std::memory_order_acquire) == 0; }
+
+private:
+    struct FEntry
+    {
+        int32 ChunkIndex = INDEX_NONE;
+        float Priority = 0.0f;
+        uint32 Sequence = 0;
+        uint8 Flags = 0;                // Caller tag, only carried through the inbox
+    };
+
+    // True if A should be popped before B
+    static bool HasPrecedence(const FEntry& A, const FEntry& B)
+    {
+        return A.Priority > B.Priority || (A.Priority == B.Priority && A.Sequence < B.Sequence);
+    }
+
+    void SiftUp(int32 HeapIndex);
+    void SiftDown(int32 HeapIndex);
+    void SetAt(int32 HeapIndex, const FEntry& Entry);
+    void RemoveAt(int32 HeapIndex);
+    int32 FindHeapIndex(int32 ChunkIndex) const;
+
+    TArray<FEntry> Heap;
+    TArray<int32> HeapPositions;        // ChunkIndex -> heap slot, INDEX_NONE when not scheduled
+    uint32 NextSequence = 0;
+
+    TQueue<FEntry, EQueueMode::Mpsc> Incoming;
+    std::atomic<int32> NumIncoming{0};
+};
@@ -0,0 +1,232 @@
+// DEMFileReader.cpp - Memory-mapped file access and big-endian sample decoding for DEM import
+#include "DEMFileReader.h"
+#include "HAL/PlatformFileManager.h"
+#include "Async/MappedFileHandle.h"
+#include "Math/VectorRegister.h"
+
+namespace
+{
+    // Regions are mapped from an offset rounded down to this, which satisfies every platform's mapping granularity
+    constexpr int64 DEMMapAlignment = 64 * 1024;
+
+    constexpr int16 SRTMNoDataSample = -32768;
+
+    FORCEINLINE void DecodeSampleScalar(const uint8* Sample, float* Dst, float NoDataFill, FDEMSampleRange& Range)
+    {
+        const int16 Raw = (int16)(((uint16)Sample[0] << 8) | Sample[1]);
+        if (Raw == SRTMNoDataSample)
+        {
+            *Dst = NoDataFill;
+            Range.NumNoData++;
+            return;
+        }
+
+        const float Value = (float)Raw;
+        *Dst = Value;
+        Range.Min = FMath::Min(Range.Min, Value);
+        Range.Max = FMath::Max(Range.Max, Value);
+    }
+
+    FORCEINLINE void ReduceSampleRange(const VectorRegister4Float& MinValues, const VectorRegister4Float& MaxValues, FDEMSampleRange& Range)
+    {
+        float MinLanes[4];
+        float MaxLanes[4];
+        VectorStore(MinValues, MinLanes);
+        VectorStore(MaxValues, MaxLanes);
+        for (int32 Lane = 0; Lane < 4; Lane++)
+        {
+            Range.Min = FMath::Min(Range.Min, MinLanes[Lane]);
+            Range.Max = FMath::Max(Range.Max, MaxLanes[Lane]);
+        }
+    }
+}
+
+// ============================================================================
+// FILE READER
+// ============================================================================
+
+FDEMFileReader::FDEMFileReader() = default;
+
+FDEMFileReader::~FDEMFileReader()
+{
+    Close();
+}
+
+bool FDEMFileReader::Open(const FString& FilePath)
+{
+    Close();
+
+    IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+    FileSize = PlatformFile.FileSize(*FilePath);
+    if (FileSize < 0)
+    {
+        return false;
+    }
+
+    FOpenMappedResult MappedResult = PlatformFile.OpenMappedEx(*FilePath);
+    if (MappedResult.HasValue())
+    {
+        MappedHandle = MappedResult.StealValue();
+        return true;
+    }
+
+    // No mapping on this platform (or for this file): read requested ranges instead
+    FileHandle.Reset(PlatformFile.OpenRead(*FilePath));
+    if (!FileHandle.IsValid())
+    {
+        FileSize = -1;
+        return false;
+    }
+    return true;
+}
+
+void FDEMFileReader::Close()
+{
+    // Regions must go before the handle they were mapped from
+    MappedRegion.Reset();
+    MappedHandle.Reset();
+    FileHandle.Reset();
+    FallbackBuffer.Empty();
+    FileSize = -1;
+}
+
+const uint8* FDEMFileReader::View(int64 Offset, int64 Size)
+{
+    if (!IsOpen() || Offset < 0 || Size <= 0 || Offset + Size > FileSize)
+    {
+        return nullptr;
+    }
+
+    if (MappedHandle.IsValid())
+    {
+        MappedRegion.Reset();
+        const int64 AlignedOffset = AlignDown(Offset, DEMMapAlignment);
+        MappedRegion.Reset(MappedHandle->MapRegion(AlignedOffset, Offset + Size - AlignedOffset));
+        return MappedRegion.IsValid() ? MappedRegion->GetMappedPtr() + (Offset - AlignedOffset) : nullptr;
+    }
+
+    FallbackBuffer.SetNumUninitialized(Size, EAllowShrinking::No);
+    return ReadInto(Offset, Size, FallbackBuffer.GetData()) ? FallbackBuffer.GetData() : nullptr;
+}
+
+bool FDEMFileReader::ReadInto(int64 Offset, int64 Size, void* Dst)
+{
+    if (!IsOpen() || Offset < 0 || Size < 0 || Offset + Size > FileSize)
+    {
+        return false;
+    }
+
+    if (MappedHandle.IsValid())
+    {
+        const uint8* Src = View(Offset, Size);
+        if (!Src)
+        {
+            return false;
+        }
+        FMemory::Memcpy(Dst, Src, Size);
+        MappedRegion.Reset();
+        return true;
+    }
+
+    return FileHandle->Seek(Offset) && FileHandle->Read(static_cast<uint8*>(Dst), Size);
+}
+
+// ============================================================================
+// SAMPLE DECODING
+// ============================================================================
+
+void DecodeBigEndianInt16(const uint8* Src, float* Dst, int32 Count, float NoDataFill, FDEMSampleRange& OutRange)
+{
+    int32 Index = 0;
+
+    if (Count >= 8)
+    {
+        const VectorRegister4Int LowByteMask = VectorIntSet1(0xFF);
+        const VectorRegister4Int HighBitsMask = VectorIntSet1(~0xFF);
+        const VectorRegister4Float VNoData = VectorSetFloat1((float)SRTMNoDataSample);
+        const VectorRegister4Float VFill = VectorSetFloat1(NoDataFill);
+        const VectorRegister4Float VBig = VectorSetFloat1(FLT_MAX);
+        const VectorRegister4Float VNegBig = VectorSetFloat1(-FLT_MAX);
+        VectorRegister4Float MinValues = VBig;
+        VectorRegister4Float MaxValues = VNegBig;
+
+        for (; Index + 8 <= Count; Index += 8)
+        {
+            // Each 32-bit lane holds two big-endian samples: bytes 0-1 (even) and 2-3 (odd).
+            // Shift the wanted high byte to the top and back down arithmetically to sign-extend it.
+            const VectorRegister4Int Packed = VectorIntLoad(Src + Index * 2);
+            const VectorRegister4Int Even = VectorIntOr(
+                VectorShiftRightImmArithmetic(VectorShiftLeftImm(Packed, 24), 16),
+                VectorIntAnd(VectorShiftRightImmLogical(Packed, 8), LowByteMask));
+            const VectorRegister4Int Odd = VectorIntOr(
+                VectorIntAnd(VectorShiftRightImmArithmetic(VectorShiftLeftImm(Packed, 8), 16), HighBitsMask),
+                VectorShiftRightImmLogical(Packed, 24));
+
+            const VectorRegister4Float EvenValues = VectorIntToFloat(Even);
+            const VectorRegister4Float OddValues = VectorIntToFloat(Odd);
+            const VectorRegister4Float Values[2] = {
+                VectorSwizzle(VectorShuffle(EvenValues, OddValues, 0, 1, 0, 1), 0, 2, 1, 3),
+                VectorSwizzle(VectorShuffle(EvenValues, OddValues, 2, 3, 2, 3), 0, 2, 1, 3) };
+
+            for (int32 Half = 0; Half < 2; Half++)
+            {
+                const VectorRegister4Float NoDataMask = VectorCompareEQ(Values[Half], VNoData);
+                VectorStore(VectorSelect(NoDataMask, VFill, Values[Half]), Dst + Index + Half * 4);
+                MinValues = VectorMin(MinValues, VectorSelect(NoDataMask, VBig, Values[Half]));
+                MaxValues = VectorMax(MaxValues, VectorSelect(NoDataMask, VNegBig, Values[Half]));
+
+                const uint32 NoDataBits = (uint32)VectorMaskBits(NoDataMask);
+                if (NoDataBits != 0)
+                {
+                    OutRange.NumNoData += FMath::CountBits(NoDataBits);
+                }
+            }
+        }
+
+        ReduceSampleRange(MinValues, MaxValues, OutRange);
+    }
+
+    for (; Index < Count; Index++)
+    {
+        DecodeSampleScalar(Src + Index * 2, Dst + Index, NoDataFill, OutRange);
+    }
+}
+
+void DecodeBigEndianInt16Strided(const uint8* Src, int32 SampleStep, float* Dst, int32 Count, float NoDataFill,
+                                 FDEMSampleRange& OutRange)
+{
+    if (SampleStep == 1)
+    {
+        DecodeBigEndianInt16(Src, Dst, Count, NoDataFill, OutRange);
+        return;
+    }
+
+    for (int32 Index = 0; Index < Count; Index++)
+    {
+        DecodeSampleScalar(Src + (int64)Index * SampleStep * 2, Dst + Index, NoDataFill, OutRange);
+    }
+}
+
+void AccumulateSampleRange(const float* Data, int64 Count, FDEMSampleRange& OutRange)
+{
+    int64 Index = 0;
+
+    if (Count >= 4)
+    {
+        VectorRegister4Float MinValues = VectorSetFloat1(FLT_MAX);
+        VectorRegister4Float MaxValues = VectorSetFloat1(-FLT_MAX);
+        for (; Index + 4 <= Count; Index += 4)
+        {
+            const VectorRegister4Float Values = VectorLoad(Data + Index);
+            MinValues = VectorMin(MinValues, Values);
+            MaxValues = VectorMax(MaxValues, Values);
+        }
+        ReduceSampleRange(MinValues, MaxValues, OutRange);
+    }
+
+    for (; Index < Count; Index++)
+    {
+        OutRange.Min = FMath::Min(OutRange.Min, Data[Index]);
+        OutRange.Max = FMath::Max(OutRange.Max, Data[Index]);
+    }
+}
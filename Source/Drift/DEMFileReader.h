@@ -0,0 +1,71 @@
+// DEMFileReader.h - Memory-mapped file access and big-endian sample decoding for DEM import
+#pragma once
+
+#include "CoreMinimal.h"
+
+class IFileHandle;
+class IMappedFileHandle;
+class IMappedFileRegion;
+
+// Elevation range of decoded samples; NoData samples are counted but left out of Min/Max
+struct FDEMSampleRange
+{
+    float Min = FLT_MAX;
+    float Max = -FLT_MAX;
+    int64 NumNoData = 0;
+
+    bool HasValues() const { return Min <= Max; }
+
+    void Merge(const FDEMSampleRange& Other)
+    {
+        Min = FMath::Min(Min, Other.Min);
+        Max = FMath::Max(Max, Other.Max);
+        NumNoData += Other.NumNoData;
+    }
+};
+
+/**
+ * Read-only view of a DEM file that maps just the byte range a loader asks for, so only the
+ * pages actually decoded are ever read from disk and nothing is copied into an intermediate
+ * file buffer. Platforms that cannot map files fall back to reading the requested range
+ * (only that range) into an internal buffer.
+ */
+class DRIFT_API FDEMFileReader
+{
+public:
+    FDEMFileReader();
+    ~FDEMFileReader();
+
+    bool Open(const FString& FilePath);
+    void Close();
+
+    bool IsOpen() const { return FileSize >= 0; }
+    bool IsMapped() const { return MappedHandle.IsValid(); }
+    int64 GetSize() const { return FileSize; }
+
+    // Bytes [Offset, Offset + Size) of the file, valid until the next View(), ReadInto() or Close(); null if out of range or unreadable
+    const uint8* View(int64 Offset, int64 Size);
+
+    // Copies bytes [Offset, Offset + Size) straight into Dst (one copy, no intermediate buffer)
+    bool ReadInto(int64 Offset, int64 Size, void* Dst);
+
+private:
+    TUniquePtr<IMappedFileHandle> MappedHandle;
+    TUniquePtr<IMappedFileRegion> MappedRegion;
+    TUniquePtr<IFileHandle> FileHandle;
+    TArray64<uint8> FallbackBuffer;
+    int64 FileSize = -1;
+};
+
+/**
+ * Decodes Count big-endian signed 16-bit samples (SRTM HGT layout) to floats, eight at a time.
+ * NoData samples (-32768) are written as NoDataFill and counted in OutRange instead of widening it.
+ */
+DRIFT_API void DecodeBigEndianInt16(const uint8* Src, float* Dst, int32 Count, float NoDataFill, FDEMSampleRange& OutRange);
+
+// As above for every SampleStep-th sample starting at Src (decimated reads)
+DRIFT_API void DecodeBigEndianInt16Strided(const uint8* Src, int32 SampleStep, float* Dst, int32 Count, float NoDataFill,
+                                           FDEMSampleRange& OutRange);
+
+// Range of Count floats, four at a time (RAW and other float sources without NoData)
+DRIFT_API void AccumulateSampleRange(const float* Data, int64 Count, FDEMSampleRange& OutRange);
@@ -3,15 +3,44 @@
 // Zero external dependencies - uses only UE5 built-in modules
 
 #include "DEMImporter.h"
+#include "DEMFileReader.h"
 #include "MasterController.h"
 #include "DynamicTerrain.h"
 #include "Misc/FileHelper.h"
 #include "Misc/Paths.h"
+#include "HAL/FileManager.h"
 #include "HAL/PlatformFileManager.h"
+#include "Async/ParallelFor.h"
 #include "IImageWrapper.h"
 #include "IImageWrapperModule.h"
 #include "Modules/ModuleManager.h"
 
+namespace
+{
+    // Output rows per ParallelFor work item when decoding HGT windows
+    constexpr int32 SRTMDecodeBandRows = 16;
+
+    // Absorbs floating-point error when a window edge lands exactly on a sample
+    constexpr double SRTMWindowEpsilon = 1.0e-6;
+
+    // Output columns [OutBegin, OutBegin + Count) come from one tile column, starting at LocalColumn
+    struct FSRTMColumnSpan
+    {
+        int32 OutBegin = 0;
+        int32 Count = 0;
+        int32 TileX = 0;
+        int32 LocalColumn = 0;
+    };
+
+    // Mapped rows [FirstLocalRow, ...] of one tile; Rows is null for tiles missing from the directory
+    struct FSRTMTileView
+    {
+        TUniquePtr<FDEMFileReader> Reader;
+        const uint8* Rows = nullptr;
+        int32 FirstLocalRow = 0;
+    };
+}
+
 UDEMImporter::UDEMImporter()
 {
     UE_LOG(LogTemp, Log, TEXT("DEMImporter: UE5-native implementation initialized"));
@@ -89,7 +118,13 @@ bool UDEMImporter::ImportDEMWithSettings(const FString& FilePath, EDEMFormat For
         return false;
     }
     
-    // Post-processing
+    ApplyImportPostProcessing();
+    
+    return true;
+}
+
+void UDEMImporter::ApplyImportPostProcessing()
+{
     if (CurrentSettings.bInterpolateNoData && Metadata.bHasNoDataValue)
     {
         UE_LOG(LogTemp, Log, TEXT("Interpolating NoData values..."));
@@ -131,7 +166,97 @@ bool UDEMImporter::ImportDEMWithSettings(const FString& FilePath, EDEMFormat For
     
     UE_LOG(LogTemp, Verbose, TEXT("=== DEM Import Complete ==="));
     UE_LOG(LogTemp, Log, TEXT("%s"), *Metadata.ToString());
+}
+
+bool UDEMImporter::ImportSRTMMosaic(const FString& TileDirectory, FVector2D WindowMin, FVector2D WindowMax,
+                                    const FDEMImportSettings& Settings)
+{
+    if (!FPaths::DirectoryExists(TileDirectory))
+    {
+        UE_LOG(LogTemp, Error, TEXT("SRTM tile directory not found: %s"), *TileDirectory);
+        return false;
+    }
+    
+    TArray<FString> TileFiles;
+    IFileManager::Get().FindFiles(TileFiles, *FPaths::Combine(TileDirectory, TEXT("*.hgt")), true, false);
+    IFileManager::Get().FindFiles(TileFiles, *FPaths::Combine(TileDirectory, TEXT("*.HGT")), true, false);
+    
+    // Index tiles by south-west corner; every tile must share one resolution
+    TMap<FIntPoint, FString> Tiles;
+    int32 SamplesPerSide = 0;
+    FIntPoint TileMin(MAX_int32, MAX_int32);
+    FIntPoint TileMax(MIN_int32, MIN_int32);
+    for (const FString& TileFile : TileFiles)
+    {
+        int32 TileLatitude = 0;
+        int32 TileLongitude = 0;
+        if (!ParseHGTTileName(TileFile, TileLatitude, TileLongitude))
+        {
+            UE_LOG(LogTemp, Warning, TEXT("Skipping %s: not an SRTM tile name"), *TileFile);
+            continue;
+        }
+        
+        const FString TilePath = FPaths::Combine(TileDirectory, TileFile);
+        const int32 TileSamples = FMath::FloorToInt(FMath::Sqrt(IFileManager::Get().FileSize(*TilePath) / 2.0));
+        if (SamplesPerSide == 0)
+        {
+            SamplesPerSide = TileSamples;
+        }
+        if (TileSamples != SamplesPerSide || TileSamples < 2)
+        {
+            UE_LOG(LogTemp, Warning, TEXT("Skipping %s: %d samples per side, mosaic uses %d"), *TileFile, TileSamples, SamplesPerSide);
+            continue;
+        }
+        
+        const FIntPoint Corner(TileLongitude, TileLatitude);
+        Tiles.Add(Corner, TilePath);
+        TileMin = TileMin.ComponentMin(Corner);
+        TileMax = TileMax.ComponentMax(Corner);
+    }
+    
+    if (Tiles.Num() == 0)
+    {
+        UE_LOG(LogTemp, Error, TEXT("No SRTM tiles found in %s"), *TileDirectory);
+        return false;
+    }
+    
+    if (WindowMin == WindowMax)
+    {
+        WindowMin = FVector2D(TileMin.X, TileMin.Y);
+        WindowMax = FVector2D(TileMax.X + 1, TileMax.Y + 1);
+    }
+    
+    if (WindowMax.X <= WindowMin.X || WindowMax.Y <= WindowMin.Y)
+    {
+        UE_LOG(LogTemp, Error, TEXT("Invalid SRTM window (%.4f, %.4f) - (%.4f, %.4f)"),
+               WindowMin.X, WindowMin.Y, WindowMax.X, WindowMax.Y);
+        return false;
+    }
+    
+    // Skip samples evenly while the window still spans at least the target grid
+    const int32 SamplesPerDegree = SamplesPerSide - 1;
+    const double WindowColumns = (WindowMax.X - WindowMin.X) * SamplesPerDegree;
+    const double WindowRows = (WindowMax.Y - WindowMin.Y) * SamplesPerDegree;
+    int32 SampleStep = 1;
+    if (Settings.TargetWidth > 1 && Settings.TargetHeight > 1)
+    {
+        SampleStep = FMath::Max(1, FMath::Min(FMath::FloorToInt(WindowColumns / (Settings.TargetWidth - 1)),
+                                              FMath::FloorToInt(WindowRows / (Settings.TargetHeight - 1))));
+    }
+    
+    CurrentSettings = Settings;
+    Metadata.SourceFile = TileDirectory;
+    
+    UE_LOG(LogTemp, Log, TEXT("Importing SRTM mosaic: %d tiles from %s, window (%.4f, %.4f) - (%.4f, %.4f), every %d sample(s)"),
+           Tiles.Num(), *TileDirectory, WindowMin.X, WindowMin.Y, WindowMax.X, WindowMax.Y, SampleStep);
+    
+    if (!LoadSRTMWindow(Tiles, SamplesPerSide, WindowMin, WindowMax, SampleStep))
+    {
+        UE_LOG(LogTemp, Error, TEXT("Failed to load SRTM mosaic"));
+        return false;
+    }
     
+    ApplyImportPostProcessing();
     return true;
 }
 
@@ -146,94 +271,245 @@ bool UDEMImporter::LoadSRTM_HGT(const FString& FilePath)
     // - SRTM-1: 3601x3601 pixels (1 arc-second resolution ~30m)
     // - SRTM-3: 1201x1201 pixels (3 arc-second resolution ~90m)
     
-    // Parse filename for coordinates
     FString Filename = FPaths::GetBaseFilename(FilePath);
     
-    float Latitude = 0.0f;
-    float Longitude = 0.0f;
-    
-    if (Filename.Len() >= 7)
+    int32 Latitude = 0;
+    int32 Longitude = 0;
+    if (!ParseHGTTileName(FilePath, Latitude, Longitude))
     {
-        // Example: "N37W122" → Lat=37°N, Lon=122°W
-        FString LatStr = Filename.Mid(1, 2);
-        FString LonStr = Filename.Mid(4, 3);
-        
-        Latitude = FCString::Atof(*LatStr);
-        Longitude = FCString::Atof(*LonStr);
-        
-        if (Filename[0] == 'S') Latitude = -Latitude;
-        if (Filename[3] == 'W') Longitude = -Longitude;
+        UE_LOG(LogTemp, Log, TEXT("HGT filename %s has no tile coordinates, assuming (0, 0)"), *Filename);
     }
     
-    // Load file
-    TArray<uint8> FileData;
-    if (!FFileHelper::LoadFileToArray(FileData, *FilePath))
+    // Determine size from file size (each sample is 2 bytes)
+    const int64 FileSize = IFileManager::Get().FileSize(*FilePath);
+    int32 NumSamples = FMath::FloorToInt(FMath::Sqrt(FMath::Max<int64>(FileSize, 0) / 2.0));
+    
+    if (NumSamples < 2)
     {
         UE_LOG(LogTemp, Error, TEXT("Failed to load HGT file: %s"), *FilePath);
         return false;
     }
     
-    // Determine size from file size (each sample is 2 bytes)
-    int32 NumSamples = FMath::FloorToInt(FMath::Sqrt(FileData.Num() / 2.0));
-    
     if (NumSamples != 1201 && NumSamples != 3601)
     {
         UE_LOG(LogTemp, Log, TEXT("Unusual HGT size: %d (expected 1201 or 3601)"), NumSamples);
     }
     
-    Metadata.Width = NumSamples;
-    Metadata.Height = NumSamples;
+    // A single tile is the one-tile mosaic covering exactly its own degree
+    TMap<FIntPoint, FString> Tiles;
+    Tiles.Add(FIntPoint(Longitude, Latitude), FilePath);
+    if (!LoadSRTMWindow(Tiles, NumSamples, FVector2D(Longitude, Latitude), FVector2D(Longitude + 1, Latitude + 1), 1))
+    {
+        UE_LOG(LogTemp, Error, TEXT("Failed to load HGT file: %s"), *FilePath);
+        return false;
+    }
     
-    // Set geographic bounds
-    Metadata.LatLonMin = FVector2D(Longitude, Latitude);
-    Metadata.LatLonMax = FVector2D(Longitude + 1.0f, Latitude + 1.0f);
+    UE_LOG(LogTemp, Log, TEXT("Loaded SRTM HGT: %s at (%d°, %d°)"),
+           *Filename, Latitude, Longitude);
+    UE_LOG(LogTemp, Log, TEXT("  Resolution: %dx%d (~%.0fm per pixel)"),
+           NumSamples, NumSamples, Metadata.MetersPerPixel);
     
-    // Calculate resolution
-    if (NumSamples == 3601)
+    return true;
+}
+
+bool UDEMImporter::ParseHGTTileName(const FString& FilePath, int32& OutLatitude, int32& OutLongitude)
+{
+    // Example: "N37W122" -> Lat=37°N, Lon=122°W (south-west corner of the tile)
+    const FString Name = FPaths::GetBaseFilename(FilePath).ToUpper();
+    if (Name.Len() < 7 || (Name[0] != 'N' && Name[0] != 'S') || (Name[3] != 'E' && Name[3] != 'W'))
     {
-        Metadata.MetersPerPixel = 30.0f; // SRTM-1: ~30m
+        return false;
     }
-    else if (NumSamples == 1201)
+    
+    const FString LatStr = Name.Mid(1, 2);
+    const FString LonStr = Name.Mid(4, 3);
+    if (!LatStr.IsNumeric() || !LonStr.IsNumeric())
     {
-        Metadata.MetersPerPixel = 90.0f; // SRTM-3: ~90m
+        return false;
     }
-    else
+    
+    OutLatitude = FCString::Atoi(*LatStr);
+    OutLongitude = FCString::Atoi(*LonStr);
+    
+    if (Name[0] == 'S') OutLatitude = -OutLatitude;
+    if (Name[3] == 'W') OutLongitude = -OutLongitude;
+    return true;
+}
+
+bool UDEMImporter::LoadSRTMWindow(const TMap<FIntPoint, FString>& Tiles, int32 SamplesPerSide,
+                                  const FVector2D& WindowMin, const FVector2D& WindowMax, int32 SampleStep)
+{
+    // Global sample grid over the window's tiles: SamplesPerDegree intervals per degree, rows running
+    // north to south from the northern edge (HGT order); neighbouring tiles share their edge samples
+    const int32 SamplesPerDegree = SamplesPerSide - 1;
+    const int64 RowBytes = (int64)SamplesPerSide * 2;
+    const int32 OriginLongitude = FMath::FloorToInt(WindowMin.X + SRTMWindowEpsilon);
+    const int32 OriginLatitude = FMath::CeilToInt(WindowMax.Y - SRTMWindowEpsilon);
+    
+    const int32 FirstColumn = FMath::Max(0, FMath::FloorToInt((WindowMin.X - OriginLongitude) * SamplesPerDegree + SRTMWindowEpsilon));
+    const int32 LastColumn = FMath::CeilToInt((WindowMax.X - OriginLongitude) * SamplesPerDegree - SRTMWindowEpsilon);
+    const int32 FirstRow = FMath::Max(0, FMath::FloorToInt((OriginLatitude - WindowMax.Y) * SamplesPerDegree + SRTMWindowEpsilon));
+    const int32 LastRow = FMath::CeilToInt((OriginLatitude - WindowMin.Y) * SamplesPerDegree - SRTMWindowEpsilon);
+    if (SamplesPerDegree < 1 || LastColumn <= FirstColumn || LastRow <= FirstRow)
     {
-        Metadata.MetersPerPixel = 111320.0f / NumSamples; // degrees to meters
+        return false;
     }
     
-    Metadata.ProjectionSystem = TEXT("WGS84");
-    Metadata.NoDataValue = -32768.0f;
-    Metadata.bHasNoDataValue = true;
+    SampleStep = FMath::Max(1, SampleStep);
+    const int32 OutWidth = (LastColumn - FirstColumn) / SampleStep + 1;
+    const int32 OutHeight = (LastRow - FirstRow) / SampleStep + 1;
     
-    // Read 16-bit big-endian data
-    HeightData.SetNum(NumSamples * NumSamples);
-    Metadata.MinElevation = FLT_MAX;
-    Metadata.MaxElevation = -FLT_MAX;
+    // A sample on a tile edge is read from the tile before it when the window ends there
+    const int32 LastTileX = (LastColumn - 1) / SamplesPerDegree;
+    const int32 LastTileY = (LastRow - 1) / SamplesPerDegree;
+    const int32 NumTilesX = LastTileX + 1;
     
-    for (int32 i = 0; i < NumSamples * NumSamples; i++)
+    TArray<FSRTMColumnSpan> ColumnSpans;
+    for (int32 OutX = 0; OutX < OutWidth; OutX++)
     {
-        // Big-endian 16-bit signed integer
-        int16 RawHeight = (FileData[i * 2] << 8) | FileData[i * 2 + 1];
-        float Height = (float)RawHeight;
-        
-        if (RawHeight == -32768)
+        const int32 Column = FirstColumn + OutX * SampleStep;
+        const int32 TileX = FMath::Min(Column / SamplesPerDegree, LastTileX);
+        if (ColumnSpans.Num() == 0 || ColumnSpans.Last().TileX != TileX)
         {
-            Height = 0.0f; // NoData - will interpolate later if requested
+            FSRTMColumnSpan& Span = ColumnSpans.AddDefaulted_GetRef();
+            Span.OutBegin = OutX;
+            Span.TileX = TileX;
+            Span.LocalColumn = Column - TileX * SamplesPerDegree;
         }
-        else
+        ColumnSpans.Last().Count++;
+    }
+    
+    TArray<int32> RowTileY;
+    TArray<int32> RowLocal;
+    RowTileY.SetNumUninitialized(OutHeight);
+    RowLocal.SetNumUninitialized(OutHeight);
+    TArray<FIntPoint> TileRowRanges;   // Per tile row: [first, last] local row read
+    TileRowRanges.Init(FIntPoint(MAX_int32, -1), LastTileY + 1);
+    for (int32 OutY = 0; OutY < OutHeight; OutY++)
+    {
+        const int32 Row = FirstRow + OutY * SampleStep;
+        const int32 TileY = FMath::Min(Row / SamplesPerDegree, LastTileY);
+        RowTileY[OutY] = TileY;
+        RowLocal[OutY] = Row - TileY * SamplesPerDegree;
+        TileRowRanges[TileY].X = FMath::Min(TileRowRanges[TileY].X, RowLocal[OutY]);
+        TileRowRanges[TileY].Y = FMath::Max(TileRowRanges[TileY].Y, RowLocal[OutY]);
+    }
+    
+    // Map just the rows each tile contributes
+    TArray<FSRTMTileView> TileViews;
+    TileViews.SetNum(NumTilesX * (LastTileY + 1));
+    int32 NumMissingTiles = 0;
+    for (int32 TileY = 0; TileY <= LastTileY; TileY++)
+    {
+        if (TileRowRanges[TileY].Y < 0)
         {
-            Metadata.MinElevation = FMath::Min(Metadata.MinElevation, Height);
-            Metadata.MaxElevation = FMath::Max(Metadata.MaxElevation, Height);
+            continue;
         }
         
-        HeightData[i] = Height;
+        for (int32 TileX = 0; TileX < NumTilesX; TileX++)
+        {
+            const FIntPoint Corner(OriginLongitude + TileX, OriginLatitude - TileY - 1);
+            const FString* TilePath = Tiles.Find(Corner);
+            FSRTMTileView& View = TileViews[TileY * NumTilesX + TileX];
+            
+            if (TilePath)
+            {
+                View.Reader = MakeUnique<FDEMFileReader>();
+                View.FirstLocalRow = TileRowRanges[TileY].X;
+                if (View.Reader->Open(*TilePath) && View.Reader->GetSize() >= RowBytes * SamplesPerSide)
+                {
+                    View.Rows = View.Reader->View(View.FirstLocalRow * RowBytes,
+                                                  (TileRowRanges[TileY].Y - View.FirstLocalRow + 1) * RowBytes);
+                }
+                if (!View.Rows)
+                {
+                    UE_LOG(LogTemp, Error, TEXT("Failed to read SRTM tile %s"), **TilePath);
+                    return false;
+                }
+            }
+            else
+            {
+                NumMissingTiles++;
+            }
+        }
     }
     
-    UE_LOG(LogTemp, Log, TEXT("Loaded SRTM HGT: %s at (%.2f°, %.2f°)"),
-           *Filename, Latitude, Longitude);
-    UE_LOG(LogTemp, Log, TEXT("  Resolution: %dx%d (~%.0fm per pixel)"),
-           NumSamples, NumSamples, Metadata.MetersPerPixel);
+    // Decode rows in parallel bands, each with its own elevation range
+    HeightData.SetNumUninitialized((int64)OutWidth * OutHeight);
+    const int32 NumBands = FMath::DivideAndRoundUp(OutHeight, SRTMDecodeBandRows);
+    TArray<FDEMSampleRange> BandRanges;
+    BandRanges.SetNum(NumBands);
+    
+    ParallelFor(NumBands, [&](int32 BandIndex)
+    {
+        FDEMSampleRange& Range = BandRanges[BandIndex];
+        const int32 EndY = FMath::Min((BandIndex + 1) * SRTMDecodeBandRows, OutHeight);
+        for (int32 OutY = BandIndex * SRTMDecodeBandRows; OutY < EndY; OutY++)
+        {
+            float* OutRow = HeightData.GetData() + (int64)OutY * OutWidth;
+            for (const FSRTMColumnSpan& Span : ColumnSpans)
+            {
+                const FSRTMTileView& View = TileViews[RowTileY[OutY] * NumTilesX + Span.TileX];
+                if (!View.Rows)
+                {
+                    // SRTM leaves out tiles that are all ocean
+                    FMemory::Memzero(OutRow + Span.OutBegin, Span.Count * sizeof(float));
+                    Range.Min = FMath::Min(Range.Min, 0.0f);
+                    Range.Max = FMath::Max(Range.Max, 0.0f);
+                    continue;
+                }
+                
+                const uint8* Src = View.Rows + (RowLocal[OutY] - View.FirstLocalRow) * RowBytes + (int64)Span.LocalColumn * 2;
+                
+                // NoData - will interpolate later if requested
+                DecodeBigEndianInt16Strided(Src, SampleStep, OutRow + Span.OutBegin, Span.Count, 0.0f, Range);
+            }
+        }
+    });
+    
+    FDEMSampleRange Range;
+    for (const FDEMSampleRange& BandRange : BandRanges)
+    {
+        Range.Merge(BandRange);
+    }
+    
+    // Metadata covers the samples actually kept
+    Metadata.Width = OutWidth;
+    Metadata.Height = OutHeight;
+    Metadata.LatLonMin = FVector2D(
+        OriginLongitude + (double)FirstColumn / SamplesPerDegree,
+        OriginLatitude - (double)(FirstRow + (OutHeight - 1) * SampleStep) / SamplesPerDegree);
+    Metadata.LatLonMax = FVector2D(
+        OriginLongitude + (double)(FirstColumn + (OutWidth - 1) * SampleStep) / SamplesPerDegree,
+        OriginLatitude - (double)FirstRow / SamplesPerDegree);
+    
+    if (SamplesPerSide == 3601)
+    {
+        Metadata.MetersPerPixel = 30.0f * SampleStep; // SRTM-1: ~30m
+    }
+    else if (SamplesPerSide == 1201)
+    {
+        Metadata.MetersPerPixel = 90.0f * SampleStep; // SRTM-3: ~90m
+    }
+    else
+    {
+        Metadata.MetersPerPixel = 111320.0f / SamplesPerSide * SampleStep; // degrees to meters
+    }
+    
+    Metadata.ProjectionSystem = TEXT("WGS84");
+    Metadata.NoDataValue = -32768.0f;
+    Metadata.bHasNoDataValue = true;
+    Metadata.MinElevation = Range.HasValues() ? Range.Min : 0.0f;
+    Metadata.MaxElevation = Range.HasValues() ? Range.Max : 0.0f;
+    
+    if (NumMissingTiles > 0)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("SRTM window: %d tile(s) missing, filled with sea level"), NumMissingTiles);
+    }
+    if (Range.NumNoData > 0)
+    {
+        UE_LOG(LogTemp, Log, TEXT("SRTM window: %lld NoData samples"), Range.NumNoData);
+    }
     
     return true;
 }
@@ -440,9 +716,10 @@ bool UDEMImporter::LoadPNG16(const FString& FilePath)
 
 bool UDEMImporter::LoadTIFF(const FString& FilePath)
 {
-    // Load TIFF using UE5's built-in IImageWrapper
-    TArray<uint8> RawFileData;
-    if (!FFileHelper::LoadFileToArray(RawFileData, *FilePath))
+    // Load TIFF using UE5's built-in IImageWrapper, handing it the mapped file instead of a loaded copy
+    FDEMFileReader Reader;
+    const uint8* FileBytes = Reader.Open(FilePath) ? Reader.View(0, Reader.GetSize()) : nullptr;
+    if (!FileBytes)
     {
         UE_LOG(LogTemp, Error, TEXT("Failed to load TIFF file: %s"), *FilePath);
         return false;
@@ -455,7 +732,9 @@ bool UDEMImporter::LoadTIFF(const FString& FilePath)
     TSharedPtr<IImageWrapper> ImageWrapper =
         ImageWrapperModule.CreateImageWrapper(EImageFormat::TIFF);
     
-    if (!ImageWrapper.IsValid() || !ImageWrapper->SetCompressed(RawFileData.GetData(), RawFileData.Num()))
+    const bool bCompressedSet = ImageWrapper.IsValid() && ImageWrapper->SetCompressed(FileBytes, Reader.GetSize());
+    Reader.Close();   // The wrapper keeps its own copy of the compressed bytes
+    if (!bCompressedSet)
     {
         UE_LOG(LogTemp, Error, TEXT("Failed to decompress TIFF"));
         return false;
@@ -534,13 +813,10 @@ bool UDEMImporter::LoadTIFF(const FString& FilePath)
     }
     
     // Calculate elevation range
-    Metadata.MinElevation = FLT_MAX;
-    Metadata.MaxElevation = -FLT_MAX;
-    for (float Height : HeightData)
-    {
-        Metadata.MinElevation = FMath::Min(Metadata.MinElevation, Height);
-        Metadata.MaxElevation = FMath::Max(Metadata.MaxElevation, Height);
-    }
+    FDEMSampleRange Range;
+    AccumulateSampleRange(HeightData.GetData(), HeightData.Num(), Range);
+    Metadata.MinElevation = Range.Min;
+    Metadata.MaxElevation = Range.Max;
     
     // Try to load geographic metadata from world file
     if (!LoadTIFFWorldFile(FilePath))
@@ -649,38 +925,39 @@ bool UDEMImporter::ParseWorldFile(const FString& WorldFilePath)
 
 bool UDEMImporter::LoadRAW(const FString& FilePath)
 {
-    // Assume square RAW file with 32-bit floats
-    TArray<uint8> FileData;
-    if (!FFileHelper::LoadFileToArray(FileData, *FilePath))
+    // Assume square RAW file with 32-bit floats, read straight into HeightData (no whole-file buffer)
+    FDEMFileReader Reader;
+    if (!Reader.Open(FilePath))
     {
         UE_LOG(LogTemp, Error, TEXT("Failed to load RAW file: %s"), *FilePath);
         return false;
     }
     
-    int32 NumFloats = FileData.Num() / sizeof(float);
-    int32 Size = FMath::FloorToInt(FMath::Sqrt((float)NumFloats));
+    const int64 NumFloats = Reader.GetSize() / sizeof(float);
+    int32 Size = FMath::FloorToInt(FMath::Sqrt((double)NumFloats));
     
-    if (Size * Size != NumFloats)
+    if ((int64)Size * Size != NumFloats)
     {
-        UE_LOG(LogTemp, Error, TEXT("RAW file is not square: %d floats"), NumFloats);
+        UE_LOG(LogTemp, Error, TEXT("RAW file is not square: %lld floats"), NumFloats);
         return false;
     }
     
     Metadata.Width = Size;
     Metadata.Height = Size;
     
-    HeightData.SetNum(NumFloats);
-    FMemory::Memcpy(HeightData.GetData(), FileData.GetData(), FileData.Num());
-    
-    // Calculate min/max
-    Metadata.MinElevation = FLT_MAX;
-    Metadata.MaxElevation = -FLT_MAX;
-    for (float Height : HeightData)
+    HeightData.SetNumUninitialized(NumFloats);
+    if (!Reader.ReadInto(0, NumFloats * sizeof(float), HeightData.GetData()))
     {
-        Metadata.MinElevation = FMath::Min(Metadata.MinElevation, Height);
-        Metadata.MaxElevation = FMath::Max(Metadata.MaxElevation, Height);
+        UE_LOG(LogTemp, Error, TEXT("Failed to read RAW file: %s"), *FilePath);
+        return false;
     }
     
+    // Calculate min/max
+    FDEMSampleRange Range;
+    AccumulateSampleRange(HeightData.GetData(), HeightData.Num(), Range);
+    Metadata.MinElevation = Range.Min;
+    Metadata.MaxElevation = Range.Max;
+    
     // No geographic info - use pixel coordinates
     Metadata.LatLonMin = FVector2D(0, 0);
     Metadata.LatLonMax = FVector2D(Size, Size);
@@ -174,6 +174,7 @@ struct FDEMImportSettings
  *
  * Features:
  * - Geographic coordinate support (lat/lon)
+ * - Multi-tile SRTM mosaics, reading only the requested window from memory-mapped tiles
  * - Automatic resampling to target resolution
  * - Multiple interpolation methods
  * - NoData handling
@@ -218,6 +219,22 @@ public:
     bool ImportDEMWithSettings(const FString& FilePath, EDEMFormat Format,
                                const FDEMImportSettings& Settings);
     
+    /**
+     * Import a lat/lon window from a directory of 1°x1° SRTM HGT tiles (N37W122.hgt, ...)
+     * stitched into one grid. Tiles are memory mapped and only the rows and columns inside
+     * the window are decoded; when the window holds many more samples than
+     * Settings.TargetWidth x TargetHeight, every Nth sample is read so the grid stays at or
+     * just above that size. Tiles missing from the directory (open ocean) read as sea level.
+     * @param TileDirectory - Folder of HGT tiles, all SRTM-1 or all SRTM-3
+     * @param WindowMin - South-west corner (longitude, latitude); equal to WindowMax to use every tile found
+     * @param WindowMax - North-east corner (longitude, latitude)
+     * @param Settings - Import and processing settings
+     * @return true if import successful
+     */
+    UFUNCTION(BlueprintCallable, Category = "DEM Import")
+    bool ImportSRTMMosaic(const FString& TileDirectory, FVector2D WindowMin, FVector2D WindowMax,
+                          const FDEMImportSettings& Settings);
+    
     // ===== DATA ACCESS =====
     
     /**
@@ -376,6 +393,18 @@ private:
     bool LoadTIFF(const FString& FilePath);
     bool LoadRAW(const FString& FilePath);
     
+    // ===== SRTM TILE WINDOWS =====
+    
+    /** Decodes the window (lon/lat corners) from tiles keyed by south-west corner (lon, lat), keeping every SampleStep-th sample */
+    bool LoadSRTMWindow(const TMap<FIntPoint, FString>& Tiles, int32 SamplesPerSide,
+                        const FVector2D& WindowMin, const FVector2D& WindowMax, int32 SampleStep);
+    
+    /** Parses the south-west corner from an HGT file name such as N37W122 */
+    static bool ParseHGTTileName(const FString& FilePath, int32& OutLatitude, int32& OutLongitude);
+    
+    /** NoData fill, normalization, scale/offset and inversion shared by every import path */
+    void ApplyImportPostProcessing();
+    
     // ===== TIFF WORLD FILE SUPPORT =====
     
     bool LoadTIFFWorldFile(const FString& TIFFPath);
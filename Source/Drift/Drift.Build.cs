@@ -42,7 +42,8 @@ public class Drift : ModuleRules
         // ========== PRIVATE DEPENDENCIES ==========
         PrivateDependencyModuleNames.AddRange(new string[] {
             "UMG",
-            "ToolMenus"
+            "ToolMenus",
+            "Json"
         });
 
         // ========== EDITOR-ONLY DEPENDENCIES ==========
@@ -0,0 +1,427 @@
+// DriftBenchmarkCommandlet.cpp - Headless solver throughput benchmark
+// Runs the water, atmosphere, soil moisture and CPU erosion passes on synthetic worlds without the editor or a map
+#include "DriftBenchmarkCommandlet.h"
+#include "WaterSystem.h"
+#include "TerrainErosionKernel.h"
+#include "AtmosphericSystem.h"
+#include "GeologyController.h"
+#include "MasterController.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "Async/TaskGraphInterfaces.h"
+#include "HAL/PlatformMemory.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+#include "UObject/Package.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogDriftBenchmark, Log, All);
+
+namespace DriftBenchmark
+{
+    // Fixed 60 Hz step so runs are comparable regardless of machine speed
+    static constexpr float StepDeltaTime = 1.0f / 60.0f;
+
+    // Atmosphere cells per side relative to the terrain (513 -> 32, the shipping default)
+    static constexpr int32 TerrainCellsPerAtmosphereCell = 16;
+
+    // Largest height difference (cm) allowed between the erosion kernel and its scalar reference
+    static constexpr float ErosionParityTolerance = 1.0e-3f;
+
+    // Same for suspended sediment (the height tolerance times the default SedimentPerErodedHeight)
+    static constexpr float ErosionSedimentParityTolerance = 1.0e-5f;
+
+    // Accumulated wall time of one solver pass
+    struct FPassTimer
+    {
+        const TCHAR* Name;
+        int64 CellsPerStep = 0;
+        uint64 Cycles = 0;
+
+        template <typename FunctionType>
+        void Run(FunctionType&& Function)
+        {
+            const uint64 Start = FPlatformTime::Cycles64();
+            Function();
+            Cycles += FPlatformTime::Cycles64() - Start;
+        }
+
+        TSharedRef<FJsonObject> ToJson(int32 NumSteps) const
+        {
+            const double Seconds = FPlatformTime::ToSeconds64(Cycles);
+            const double TotalCells = double(CellsPerStep) * NumSteps;
+
+            TSharedRef<FJsonObject> Json = MakeShared<FJsonObject>();
+            Json->SetNumberField(TEXT("cells_per_step"), double(CellsPerStep));
+            Json->SetNumberField(TEXT("total_ms"), Seconds * 1000.0);
+            Json->SetNumberField(TEXT("ms_per_step"), Seconds * 1000.0 / NumSteps);
+            Json->SetNumberField(TEXT("cells_per_sec"), Seconds > 0.0 ? TotalCells / Seconds : 0.0);
+            Json->SetNumberField(TEXT("ns_per_cell"), TotalCells > 0.0 ? Seconds * 1.0e9 / TotalCells : 0.0);
+            return Json;
+        }
+    };
+
+    // Rolling hills from a few seeded sine octaves plus small per-cell noise (heights in cm)
+    static void BuildHeightmap(TArray<float>& OutHeights, int32 Width, int32 Height, FRandomStream& Random)
+    {
+        float Frequencies[4];
+        float Amplitudes[4];
+        float PhasesX[4];
+        float PhasesY[4];
+        for (int32 Octave = 0; Octave < 4; Octave++)
+        {
+            Frequencies[Octave] = (2.0f * PI / Width) * (2 << Octave) * Random.FRandRange(0.8f, 1.2f);
+            Amplitudes[Octave] = 3000.0f / (1 << Octave);
+            PhasesX[Octave] = Random.FRandRange(0.0f, 2.0f * PI);
+            PhasesY[Octave] = Random.FRandRange(0.0f, 2.0f * PI);
+        }
+
+        OutHeights.SetNumUninitialized(Width * Height);
+        for (int32 Y = 0; Y < Height; Y++)
+        {
+            for (int32 X = 0; X < Width; X++)
+            {
+                float Value = 0.0f;
+                for (int32 Octave = 0; Octave < 4; Octave++)
+                {
+                    Value += Amplitudes[Octave] *
+                             FMath::Sin(X * Frequencies[Octave] + PhasesX[Octave]) *
+                             FMath::Cos(Y * Frequencies[Octave] + PhasesY[Octave]);
+                }
+                OutHeights[Y * Width + X] = Value + Random.FRandRange(-5.0f, 5.0f);
+            }
+        }
+    }
+
+    // Seeded circular water sources, roughly one per 64x64 area, so the sparse path sees realistic coverage
+    static void SeedWater(FWaterSimulationData& Data, FRandomStream& Random)
+    {
+        const int32 Width = Data.TerrainWidth;
+        const int32 Height = Data.TerrainHeight;
+        const int32 NumSources = FMath::Max(1, (Width / 64) * (Height / 64));
+
+        for (int32 Source = 0; Source < NumSources; Source++)
+        {
+            const int32 CenterX = Random.RandRange(0, Width - 1);
+            const int32 CenterY = Random.RandRange(0, Height - 1);
+            const int32 Radius = Random.RandRange(4, 24);
+            const float Depth = Random.FRandRange(5.0f, 50.0f);
+
+            for (int32 Y = FMath::Max(0, CenterY - Radius); Y <= FMath::Min(Height - 1, CenterY + Radius); Y++)
+            {
+                for (int32 X = FMath::Max(0, CenterX - Radius); X <= FMath::Min(Width - 1, CenterX + Radius); X++)
+                {
+                    const float Distance = FMath::Sqrt(float(FMath::Square(X - CenterX) + FMath::Square(Y - CenterY)));
+                    if (Distance <= Radius)
+                    {
+                        Data.WaterDepthMap[Y * Width + X] += Depth * (1.0f - Distance / Radius);
+                    }
+                }
+            }
+        }
+
+        // Give the sediment pass something to move
+        for (int32 i = 0; i < Data.SedimentMap.Num(); i++)
+        {
+            if (Data.WaterDepthMap[i] > 0.0f)
+            {
+                Data.SedimentMap[i] = Random.FRandRange(0.0f, 2.0f);
+            }
+        }
+    }
+
+    // Erosion inputs over the current water buffers (the solver swaps them, so rebuild every step)
+    static FTerrainErosionInputs MakeErosionInputs(const FWaterSimulationData& Data, const TArray<float>& Hardness)
+    {
+        FTerrainErosionInputs Inputs;
+        Inputs.WaterDepth = Data.WaterDepthMap.GetData();
+        Inputs.VelocityX = Data.WaterVelocityX.GetData();
+        Inputs.VelocityY = Data.WaterVelocityY.GetData();
+        Inputs.Hardness = Hardness.GetData();
+        return Inputs;
+    }
+
+    static const TCHAR* GetWorldSizeName(ETerrainWorldSize Size)
+    {
+        switch (Size)
+        {
+        case ETerrainWorldSize::Small:   return TEXT("Small");
+        case ETerrainWorldSize::Medium:  return TEXT("Medium");
+        case ETerrainWorldSize::Large:   return TEXT("Large");
+        case ETerrainWorldSize::Massive: return TEXT("Massive");
+        default:                         return TEXT("Unknown");
+        }
+    }
+}
+
+UDriftBenchmarkCommandlet::UDriftBenchmarkCommandlet()
+{
+    IsClient = false;
+    IsServer = false;
+    IsEditor = false;
+    LogToConsole = true;
+    ShowErrorCount = true;
+}
+
+int32 UDriftBenchmarkCommandlet::Main(const FString& Params)
+{
+    int32 NumSteps = 120;
+    int32 Seed = 1337;
+    FParse::Value(*Params, TEXT("Steps="), NumSteps);
+    FParse::Value(*Params, TEXT("Seed="), Seed);
+    NumSteps = FMath::Max(1, NumSteps);
+
+    bUseParallelSolver = !FParse::Param(*Params, TEXT("NoParallel"));
+    bUseSparseSimulation = !FParse::Param(*Params, TEXT("NoSparse"));
+    bUseVectorKernel = !FParse::Param(*Params, TEXT("NoVectorKernel"));
+
+    FString SizesParam = TEXT("Small,Medium,Large,Massive");
+    FParse::Value(*Params, TEXT("Sizes="), SizesParam, false);
+
+    TArray<ETerrainWorldSize> Sizes;
+    TArray<FString> SizeNames;
+    SizesParam.ParseIntoArray(SizeNames, TEXT(","));
+    for (const FString& SizeName : SizeNames)
+    {
+        const ETerrainWorldSize AllSizes[] = { ETerrainWorldSize::Small, ETerrainWorldSize::Medium,
+                                               ETerrainWorldSize::Large, ETerrainWorldSize::Massive };
+        bool bFound = false;
+        for (ETerrainWorldSize Size : AllSizes)
+        {
+            if (SizeName.TrimStartAndEnd().Equals(DriftBenchmark::GetWorldSizeName(Size), ESearchCase::IgnoreCase))
+            {
+                Sizes.Add(Size);
+                bFound = true;
+            }
+        }
+        if (!bFound)
+        {
+            UE_LOG(LogDriftBenchmark, Error, TEXT("Unknown world size '%s' (expected Small, Medium, Large or Massive)"), *SizeName);
+            return 1;
+        }
+    }
+
+    FString OutputPath = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("Benchmarks"), TEXT("DriftSolverBenchmark.json"));
+    FParse::Value(*Params, TEXT("Output="), OutputPath);
+
+    // Transient game world so the terrain/geology actors can be spawned (BeginPlay never runs)
+    UWorld* World = UWorld::CreateWorld(EWorldType::Game, false, TEXT("DriftBenchmarkWorld"));
+    FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+    WorldContext.SetCurrentWorld(World);
+
+    TArray<TSharedPtr<FJsonValue>> Results;
+    for (ETerrainWorldSize Size : Sizes)
+    {
+        Results.Add(MakeShared<FJsonValueObject>(RunWorldSize(World, Size, NumSteps, Seed)));
+    }
+
+    GEngine->DestroyWorldContext(World);
+    World->DestroyWorld(false);
+
+    TSharedRef<FJsonObject> Root = MakeShared<FJsonObject>();
+    Root->SetNumberField(TEXT("steps"), NumSteps);
+    Root->SetNumberField(TEXT("seed"), Seed);
+    Root->SetNumberField(TEXT("delta_time"), DriftBenchmark::StepDeltaTime);
+    Root->SetBoolField(TEXT("parallel_solver"), bUseParallelSolver);
+    Root->SetBoolField(TEXT("sparse_simulation"), bUseSparseSimulation);
+    Root->SetBoolField(TEXT("vector_kernel"), bUseVectorKernel);
+    Root->SetNumberField(TEXT("worker_threads"), FTaskGraphInterface::Get().GetNumWorkerThreads());
+    Root->SetStringField(TEXT("platform"), FPlatformProperties::IniPlatformName());
+    Root->SetNumberField(TEXT("process_peak_used_physical_bytes"), double(FPlatformMemory::GetStats().PeakUsedPhysical));
+    Root->SetArrayField(TEXT("results"), Results);
+
+    FString Json;
+    FJsonSerializer::Serialize(Root, TJsonWriterFactory<>::Create(&Json));
+
+    UE_LOG(LogDriftBenchmark, Display, TEXT("%s"), *Json);
+    if (!FFileHelper::SaveStringToFile(Json, *OutputPath))
+    {
+        UE_LOG(LogDriftBenchmark, Error, TEXT("Failed to write benchmark results to %s"), *OutputPath);
+        return 1;
+    }
+
+    UE_LOG(LogDriftBenchmark, Display, TEXT("Benchmark results written to %s"), *OutputPath);
+    return bErosionParityFailed ? 1 : 0;
+}
+
+TSharedPtr<FJsonObject> UDriftBenchmarkCommandlet::RunWorldSize(UWorld* World, ETerrainWorldSize Size, int32 NumSteps, int32 Seed)
+{
+    using namespace DriftBenchmark;
+
+    FRandomStream Random(Seed);
+
+    // ===== TERRAIN =====
+    ADynamicTerrain* Terrain = World->SpawnActor<ADynamicTerrain>();
+    const FWorldSizeConfig Config = Terrain->GetWorldConfigForSize(Size);
+    const int32 Width = Config.TerrainWidth;
+    const int32 Height = Config.TerrainHeight;
+    Terrain->TerrainWidth = Width;
+    Terrain->TerrainHeight = Height;
+    BuildHeightmap(Terrain->HeightMap, Width, Height, Random);
+
+    // ===== WATER =====
+    UWaterSystem* Water = NewObject<UWaterSystem>(GetTransientPackage());
+    Water->OwnerTerrain = Terrain;
+    Water->CachedMasterController = nullptr;  // Edge drainage is not reported to a water budget
+    Water->bUseParallelWaterSolver = bUseParallelSolver;
+    Water->bUseSparseWaterSimulation = bUseSparseSimulation;
+    Water->bUseVectorizedFlowKernel = bUseVectorKernel;
+    Water->SimulationData.Initialize(Width, Height);
+    SeedWater(Water->SimulationData, Random);
+
+    // ===== ATMOSPHERE =====
+    UAtmosphericSystem* Atmosphere = NewObject<UAtmosphericSystem>(GetTransientPackage());
+    Atmosphere->GridResolutionX = FMath::Max(8, Width / TerrainCellsPerAtmosphereCell);
+    Atmosphere->GridResolutionY = FMath::Max(8, Height / TerrainCellsPerAtmosphereCell);
+    Atmosphere->InitializeAtmosphericGrid();
+    for (int32 i = 0; i < Atmosphere->AtmosphericGrid.Num(); i++)
+    {
+        Atmosphere->AtmosphericGrid.MoistureMass[i] = Random.FRandRange(0.0f, 1.0f);
+        Atmosphere->AtmosphericGrid.WindX[i] = Random.FRandRange(-10.0f, 10.0f);
+        Atmosphere->AtmosphericGrid.WindY[i] = Random.FRandRange(-10.0f, 10.0f);
+    }
+
+    // ===== GEOLOGY =====
+    AMasterWorldController* Master = World->SpawnActor<AMasterWorldController>();
+    AGeologyController* Geology = World->SpawnActor<AGeologyController>();
+    Geology->TargetTerrain = Terrain;
+    Geology->MasterController = Master;
+    Geology->InitializeGeologyGrid();
+    for (FSimplifiedGeology& Cell : Geology->GeologyGrid)
+    {
+        Cell.SoilMoisture = Random.FRandRange(0.05f, 0.9f);
+        Cell.Hardness = Random.FRandRange(0.0f, 1.0f);
+    }
+
+    // ===== EROSION =====
+    // Hardness at terrain resolution, nearest geology cell (as the terrain resamples it)
+    TArray<float> Hardness;
+    Hardness.SetNumUninitialized(Width * Height);
+    for (int32 Y = 0; Y < Height; Y++)
+    {
+        const int32 GeoY = FMath::Clamp((int32)((int64)Y * Geology->GeologyGridHeight / Height), 0, Geology->GeologyGridHeight - 1);
+        for (int32 X = 0; X < Width; X++)
+        {
+            const int32 GeoX = FMath::Clamp((int32)((int64)X * Geology->GeologyGridWidth / Width), 0, Geology->GeologyGridWidth - 1);
+            Hardness[Y * Width + X] = Geology->GeologyGrid[GeoY * Geology->GeologyGridWidth + GeoX].Hardness;
+        }
+    }
+
+    FTerrainErosionKernel Erosion;
+    Erosion.bParallel = bUseParallelSolver;
+    Erosion.bVectorized = bUseVectorKernel;
+
+    FTerrainErosionParams ErosionParams;
+    ErosionParams.TerrainScale = Terrain->GetTerrainScale();
+    ErosionParams.ErosionRate = Terrain->GPUErosionRate;
+    ErosionParams.DepositionRate = Terrain->GPUDepositionRate;
+    ErosionParams.DeltaTime = StepDeltaTime;
+    ErosionParams.SedimentPerErodedHeight = Terrain->CPUErosionSedimentPerHeight;
+
+    // ===== TIMED STEPS =====
+    const int64 WaterCells = int64(Width) * Height;
+    FPassTimer CalculateFlowTimer{ TEXT("CalculateWaterFlow"), WaterCells };
+    FPassTimer ApplyFlowTimer{ TEXT("ApplyWaterFlow"), WaterCells };
+    FPassTimer SedimentTimer{ TEXT("ApplySedimentTransport"), WaterCells };
+    FPassTimer ActiveTilesTimer{ TEXT("ActiveTileBookkeeping"), WaterCells };
+    FPassTimer AdvectTimer{ TEXT("AdvectMoisture"), Atmosphere->AtmosphericGrid.Num() };
+    FPassTimer SoilTimer{ TEXT("ProcessSoilMoistureTick"), Geology->GeologyGrid.Num() };
+    FPassTimer ErosionTimer{ TEXT("CPUErosion"), WaterCells };
+
+    int64 TotalActiveTiles = 0;
+    int32 SteadyStateAllocations = 0;
+    for (int32 Step = 0; Step < NumSteps; Step++)
+    {
+        Water->SimulationData.BeginStepAllocationTracking();
+
+        ActiveTilesTimer.Run([&]() { Water->SimulationData.BuildActiveSpans(Water->bUseSparseWaterSimulation); });
+        TotalActiveTiles += Water->SimulationData.GetNumActiveTiles();
+
+        CalculateFlowTimer.Run([&]() { Water->CalculateWaterFlow(StepDeltaTime); });
+        ApplyFlowTimer.Run([&]() { Water->ApplyWaterFlow(StepDeltaTime); });
+        SedimentTimer.Run([&]() { Water->ApplySedimentTransport(StepDeltaTime); });
+        ActiveTilesTimer.Run([&]() { Water->RefreshActiveTiles(); });
+        AdvectTimer.Run([&]() { Atmosphere->AdvectMoisture(StepDeltaTime); });
+        SoilTimer.Run([&]() { Geology->ProcessSoilMoistureTick(StepDeltaTime); });
+        ErosionTimer.Run([&]()
+        {
+            Erosion.Execute(Terrain->HeightMap.GetData(), Width, Height, MakeErosionInputs(Water->SimulationData, Hardness),
+                            ErosionParams, Water->SimulationData.SedimentMap.GetData());
+        });
+
+        // The first step sizes every persistent buffer; after that the solver should not allocate
+        if (Step > 0)
+        {
+            SteadyStateAllocations += Water->SimulationData.StepAllocationCount;
+        }
+    }
+
+    // ===== EROSION PARITY =====
+    // Checked on the aged world, so the water has real velocities and the terrain real slopes
+    const FTerrainErosionParity ErosionParity = Erosion.MeasureParity(Terrain->HeightMap, Water->SimulationData.SedimentMap.GetData(),
+                                                                      Width, Height, MakeErosionInputs(Water->SimulationData, Hardness),
+                                                                      ErosionParams);
+    const bool bErosionParityPassed = ErosionParity.MaxHeightError <= ErosionParityTolerance &&
+                                      ErosionParity.MaxSedimentError <= ErosionSedimentParityTolerance;
+    if (!bErosionParityPassed)
+    {
+        UE_LOG(LogDriftBenchmark, Error, TEXT("%s: CPU erosion differs from the shader reference by %g cm height (tolerance %g), %g sediment (tolerance %g)"),
+               GetWorldSizeName(Size), ErosionParity.MaxHeightError, ErosionParityTolerance,
+               ErosionParity.MaxSedimentError, ErosionSedimentParityTolerance);
+        bErosionParityFailed = true;
+    }
+
+    // ===== REPORT =====
+    const FWaterSimulationData& Data = Water->SimulationData;
+    const int64 SolverBufferBytes =
+        Data.WaterDepthMap.GetAllocatedSize() + Data.WaterVelocityX.GetAllocatedSize() +
+        Data.WaterVelocityY.GetAllocatedSize() + Data.SedimentMap.GetAllocatedSize() +
+        Data.FoamMap.GetAllocatedSize() + Data.WaterDepthBack.GetAllocatedSize() +
+        Data.WaterVelocityXBack.GetAllocatedSize() + Data.WaterVelocityYBack.GetAllocatedSize() +
+        Data.SedimentBack.GetAllocatedSize() + Data.PreviousDepthMap.GetAllocatedSize() +
+        Data.PaddedSurfaceMap.GetAllocatedSize() + Terrain->HeightMap.GetAllocatedSize() +
+        Atmosphere->AtmosphericGrid.GetAllocatedSize() + Geology->GeologyGrid.GetAllocatedSize() +
+        Erosion.GetAllocatedSize() + Hardness.GetAllocatedSize();
+
+    TSharedRef<FJsonObject> Passes = MakeShared<FJsonObject>();
+    for (const FPassTimer* Timer : { &CalculateFlowTimer, &ApplyFlowTimer, &SedimentTimer, &ActiveTilesTimer, &AdvectTimer, &SoilTimer, &ErosionTimer })
+    {
+        Passes->SetObjectField(Timer->Name, Timer->ToJson(NumSteps));
+    }
+
+    TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+    Result->SetStringField(TEXT("world_size"), GetWorldSizeName(Size));
+    Result->SetNumberField(TEXT("terrain_width"), Width);
+    Result->SetNumberField(TEXT("terrain_height"), Height);
+    Result->SetNumberField(TEXT("atmosphere_width"), Atmosphere->GridResolutionX);
+    Result->SetNumberField(TEXT("atmosphere_height"), Atmosphere->GridResolutionY);
+    Result->SetNumberField(TEXT("geology_cells"), Geology->GeologyGrid.Num());
+    Result->SetNumberField(TEXT("average_active_tiles"), double(TotalActiveTiles) / NumSteps);
+    Result->SetNumberField(TEXT("steady_state_allocations"), SteadyStateAllocations);
+    Result->SetNumberField(TEXT("solver_buffer_bytes"), double(SolverBufferBytes));
+    Result->SetNumberField(TEXT("erosion_parity_max_error_cm"), ErosionParity.MaxHeightError);
+    Result->SetNumberField(TEXT("erosion_parity_max_sediment_error"), ErosionParity.MaxSedimentError);
+    Result->SetBoolField(TEXT("erosion_parity_passed"), bErosionParityPassed);
+    Result->SetNumberField(TEXT("process_peak_used_physical_bytes"), double(FPlatformMemory::GetStats().PeakUsedPhysical));
+    Result->SetObjectField(TEXT("passes"), Passes);
+
+    UE_LOG(LogDriftBenchmark, Display, TEXT("%s (%dx%d): flow %.2f ms/step, apply %.2f ms/step, sediment %.2f ms/step, erosion %.2f ms/step"),
+           GetWorldSizeName(Size), Width, Height,
+           FPlatformTime::ToSeconds64(CalculateFlowTimer.Cycles) * 1000.0 / NumSteps,
+           FPlatformTime::ToSeconds64(ApplyFlowTimer.Cycles) * 1000.0 / NumSteps,
+           FPlatformTime::ToSeconds64(SedimentTimer.Cycles) * 1000.0 / NumSteps,
+           FPlatformTime::ToSeconds64(ErosionTimer.Cycles) * 1000.0 / NumSteps);
+
+    // Release this size's worlds before the next (larger) one is built
+    Geology->Destroy();
+    Master->Destroy();
+    Terrain->Destroy();
+    Water->MarkAsGarbage();
+    Atmosphere->MarkAsGarbage();
+    CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+
+    return Result;
+}
@@ -30,6 +30,8 @@
 #include "WaterController.h"  // CRITICAL: Add WaterController include
 #include "GeologyController.h"
 #include "TemporalManager.h"
+#include "GridIndexBufferCache.h"
+#include "TerrainNoiseGenerator.h"
 
 using namespace DriftConstants;  // Use named constants
 
@@ -170,6 +172,17 @@ void ADynamicTerrain::BeginPlay()
     }
 }
 
+void ADynamicTerrain::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    // Background mesh builds own no UObjects, but must finish before their batches are freed
+    CancelChunkMeshBuilds();
+
+    // Height readback slots are written by render commands
+    DiscardGPUHeightReadbacks();
+    
+    Super::EndPlay(EndPlayReason);
+}
+
 // 1.4 TICK
 
 void ADynamicTerrain::Tick(float DeltaTime)
@@ -179,6 +192,18 @@ void ADynamicTerrain::Tick(float DeltaTime)
     // Reset frame counters
     TotalChunkUpdatesThisFrame = 0;
     
+    // Upload chunk meshes finished by background tasks since last frame
+    if (InFlightChunkMeshBuilds.Num() > 0)
+    {
+        ApplyCompletedChunkMeshBuilds();
+    }
+    
+    // Send CPU height edits the upload ring had no free slot for when they were made
+    if (!GPUHeightDirtyRegions.IsEmpty())
+    {
+        UploadDirtyHeightsToGPU();
+    }
+    
     // Update frustum culling (needed for both modes)
     if (bEnableFrustumCulling)
     {
@@ -189,6 +214,12 @@ void ADynamicTerrain::Tick(float DeltaTime)
     switch (CurrentComputeMode)
     {
         case ETerrainComputeMode::CPU:
+            // Same erosion as the compute shader, run on HeightMap (queues the chunks it touches)
+            if (bEnableGPUErosion)
+            {
+                ExecuteCPUErosion(DeltaTime);
+            }
+
             // Normal CPU processing
             ProcessPendingChunkUpdates();
             break;
@@ -222,6 +253,9 @@ void ADynamicTerrain::Tick(float DeltaTime)
                 }
             }
 
+            // Apply height readbacks the GPU has finished since last frame (never waits)
+            PollGPUHeightReadbacks();
+
             // SLOW SYNC: Full sync with validation and mesh updates (0.5s)
             // This handles mesh rebuilds and is expensive - keep it slow
             if (bGPUDataDirty)
@@ -236,8 +270,8 @@ void ADynamicTerrain::Tick(float DeltaTime)
                 }
             }
 
-            // Process any chunks that need mesh regeneration (queued by SyncGPUToCPU)
-            if (PendingChunkUpdates.Num() > 0)
+            // Process any chunks that need mesh regeneration (queued by PollGPUHeightReadbacks)
+            if (!ChunkUpdateScheduler.IsEmpty())
             {
                 ProcessPendingChunkUpdates();
             }
@@ -357,6 +391,7 @@ void ADynamicTerrain::ValidateGPUUpload()
     if (InvalidCount > 0)
     {
         UE_LOG(LogTemp, Error, TEXT("Fixed %d invalid height values!"), InvalidCount);
+        NotifyAllHeightsChanged();
     }
     
     // Clamp extreme values
@@ -370,6 +405,7 @@ void ADynamicTerrain::ValidateGPUUpload()
         {
             HeightMap[i] = FMath::Clamp(HeightMap[i], -MaxAllowedHeight, MaxAllowedHeight);
         }
+        NotifyAllHeightsChanged();
     }
 }
 
@@ -517,7 +553,8 @@ void ADynamicTerrain::InitializeChunks()
 {
     UE_LOG(LogTemp, Log, TEXT("Initializing chunk system with %dx%d chunks"), ChunksX, ChunksY);
     
-    // Clear existing chunks
+    // Clear existing chunks (in-flight builds target the old layout)
+    CancelChunkMeshBuilds();
     TerrainChunks.Empty();
     
     // Track statistics for batched logging
@@ -662,9 +699,10 @@ void ADynamicTerrain::GenerateProceduralTerrain()
             // Combine waves with different amplitudes
             float CombinedHeight = (Wave1 + Wave2 + Wave3 + Ridge) * MaxTerrainHeight * 0.3f;
             
-            SetHeightSafe(X, Y, CombinedHeight);
+            SetHeightUnnotified(X, Y, CombinedHeight);
         }
     }
+    NotifyAllHeightsChanged();
     
     UE_LOG(LogTemp, Log, TEXT("Sinusoidal terrain generation complete - ready for water flow"));
 }
@@ -679,9 +717,10 @@ void ADynamicTerrain::GenerateSimpleTerrain()
         for (int32 X = 0; X < TerrainWidth; X++)
         {
             float Height = FMath::Sin(X * 0.05f) * FMath::Cos(Y * 0.05f) * 300.0f;
-            SetHeightSafe(X, Y, Height);
+            SetHeightUnnotified(X, Y, Height);
         }
     }
+    NotifyAllHeightsChanged();
     
     // FIXED: Don't mark ALL chunks - they get updated automatically during generation
     UE_LOG(LogTemp, Log, TEXT("Simple terrain generated - chunks will update as needed"));
@@ -710,6 +749,35 @@ void ADynamicTerrain::GenerateProceduralTerrainWithSettings(int32 Seed, float He
         UE_LOG(LogTemp, Log, TEXT("Generated RANDOM seed %d"), Seed);
     }
     
+    if (ProceduralGenerator == ETerrainNoiseGenerator::FractalNoise)
+    {
+        if (HeightMap.Num() != TerrainWidth * TerrainHeight)
+        {
+            UE_LOG(LogTemp, Error, TEXT("HeightMap size %d does not match %dx%d - skipping generation"),
+                   HeightMap.Num(), TerrainWidth, TerrainHeight);
+            return;
+        }
+        
+        // Same base frequency convention as the sinusoidal path (NoiseScl * 100 cycles across the map)
+        FTerrainNoiseSettings NoiseSettings;
+        NoiseSettings.Seed = Seed;
+        NoiseSettings.Octaves = Octaves;
+        NoiseSettings.BaseFrequency = NoiseScl * 100.0f;
+        NoiseSettings.Lacunarity = NoiseLacunarity;
+        NoiseSettings.Gain = NoiseGain;
+        NoiseSettings.Amplitude = HeightVar * HeightMultiplier; // USE EXPOSED PROPERTY
+        NoiseSettings.RidgeBlend = RidgeBlend;
+        NoiseSettings.DomainWarpStrength = DomainWarpStrength;
+        
+        const double StartTime = FPlatformTime::Seconds();
+        FTerrainNoiseGenerator::Generate(NoiseSettings, TerrainWidth, TerrainHeight, HeightMap);
+        NotifyAllHeightsChanged();
+        
+        UE_LOG(LogTemp, Log, TEXT("Fractal terrain %dx%d generated in %.1f ms"),
+               TerrainWidth, TerrainHeight, (FPlatformTime::Seconds() - StartTime) * 1000.0);
+        return;
+    }
+    
     // Generate with parameters
     for (int32 Y = 0; Y < TerrainHeight; Y++)
     {
@@ -739,9 +807,10 @@ void ADynamicTerrain::GenerateProceduralTerrainWithSettings(int32 Seed, float He
                 Frequency *= 2.0f;
             }
             
-            SetHeightSafe(X, Y, Height);
+            SetHeightUnnotified(X, Y, Height);
         }
     }
+    NotifyAllHeightsChanged();
     
     UE_LOG(LogTemp, Verbose, TEXT("=== TERRAIN GENERATION COMPLETE ==="));
     UE_LOG(LogTemp, Verbose, TEXT("Effective max height: ~%.0f meters"), HeightVar * HeightMultiplier * 2.0f);
@@ -754,9 +823,8 @@ void ADynamicTerrain::ResetTerrainFully()
     UE_LOG(LogTemp, Log, TEXT("Performing full terrain reset..."));
 
     // CRITICAL: Clear ALL queues first to prevent zombie chunks
-    PendingChunkUpdates.Empty();
+    ChunkUpdateScheduler.Reset();
     PendingWaterChunkUpdates.Empty();
-    PriorityChunkQueue.Empty();
     
     // Reset frame counter
     TotalChunkUpdatesThisFrame = 0;
@@ -980,9 +1048,8 @@ void ADynamicTerrain::PerformCleanGeneration(bool bInitializeSystems)
     TerrainChunks.Empty();
     
     // Clear ALL pending update queues to prevent leftover chunk processing
-    PendingChunkUpdates.Empty();
+    ChunkUpdateScheduler.Reset();
     PendingWaterChunkUpdates.Empty();
-    PriorityChunkQueue.Empty();
     TotalChunkUpdatesThisFrame = 0;
 
     // ROUTER: Check if we have map definition
@@ -1164,6 +1231,7 @@ bool ADynamicTerrain::ApplyHeightData(const TArray<float>& HeightData,
     // Direct copy to heightmap
     FMemory::Memcpy(HeightMap.GetData(), CleanedData.GetData(),
                     CleanedData.Num() * sizeof(float));
+    NotifyAllHeightsChanged();
     
     UE_LOG(LogTemp, Log, TEXT("Height data copied to terrain heightmap"));
     
@@ -1395,14 +1463,13 @@ void ADynamicTerrain::ModifyTerrain(FVector WorldPosition, float Radius, float S
 
     if (bUseGPUTerrain)
     {
-        // Upload our edit to GPU and WAIT for it to complete
-        SyncCPUToGPU();
-        FlushRenderingCommands();
+        // ModifyTerrainAtIndex already queued the edited region's upload; render commands run in
+        // order, so the next compute dispatch sees it without waiting here
 
         // Mark the time of this edit - used to protect against sync overwrites
         LastUserEditTime = GetWorld() ? GetWorld()->GetTimeSeconds() : 0.0f;
 
-        UE_LOG(LogTemp, Warning, TEXT("BRUSH EDIT: Uploaded to GPU, edit protected until %.2f"), LastUserEditTime + 0.5f);
+        UE_LOG(LogTemp, Warning, TEXT("BRUSH EDIT: GPU upload queued, edit protected until %.2f"), LastUserEditTime + 0.5f);
     }
 }
 
@@ -1422,6 +1489,9 @@ void ADynamicTerrain::ModifyTerrainAtIndex(int32 X, int32 Y, float Radius, float
     int32 IntRadius = FMath::CeilToInt(Radius);
     TSet<int32> AffectedChunks;
     
+    // Bounds of the cells actually changed (inclusive)
+    FIntRect BrushRect(TerrainWidth, TerrainHeight, -1, -1);
+    
     // Modify terrain in circular pattern
     for (int32 OffsetY = -IntRadius; OffsetY <= IntRadius; OffsetY++)
     {
@@ -1446,6 +1516,7 @@ void ADynamicTerrain::ModifyTerrainAtIndex(int32 X, int32 Y, float Radius, float
                             HeightMap[Index] + HeightChange,
                             MinTerrainHeight, MaxTerrainHeight
                         );
+                        BrushRect.Include(FIntPoint(CurrentX, CurrentY));
                         
                         int32 ChunkIndex = GetChunkIndexFromCoordinates(CurrentX, CurrentY);
                         if (ChunkIndex >= 0)
@@ -1458,15 +1529,55 @@ void ADynamicTerrain::ModifyTerrainAtIndex(int32 X, int32 Y, float Radius, float
         }
     }
     
-    // ===== CRITICAL: Include neighbors for boundary stitching =====
-    TSet<int32> ChunksToUpdate = AffectedChunks;
+    if (BrushRect.Max.X < BrushRect.Min.X)
+    {
+        return;
+    }
+    
+    NotifyHeightRegionChanged(BrushRect);
+    
+    TSet<int32> ChunksToUpdate;
     
-    for (int32 ChunkIndex : AffectedChunks)
+    if (bUseIncrementalChunkUpdates)
     {
-        TArray<int32> Neighbors = GetNeighboringChunks(ChunkIndex, false);
-        for (int32 NeighborIndex : Neighbors)
+        // ===== DIRTY RECT: Patch only the touched vertices of every chunk that shares them =====
+        // Grow by one cell: neighbouring normals read the edited heights
+        FIntRect DirtyRect(
+            FMath::Max(BrushRect.Min.X - 1, 0), FMath::Max(BrushRect.Min.Y - 1, 0),
+            FMath::Min(BrushRect.Max.X + 1, TerrainWidth - 1), FMath::Min(BrushRect.Max.Y + 1, TerrainHeight - 1));
+        
+        TSet<int32> OverlappingChunks;
+        CollectChunksInRect(DirtyRect, OverlappingChunks);
+        for (int32 ChunkIndex : OverlappingChunks)
+        {
+            if (!UpdateChunkRegion(ChunkIndex, DirtyRect))
+            {
+                ChunksToUpdate.Add(ChunkIndex);   // No current cached mesh: full rebuild below
+            }
+        }
+        
+        if (ChunksToUpdate.Num() == 0)
+        {
+            if (bUseGPUTerrain)
+            {
+                MarkHeightsDirtyForGPU(BrushRect);
+                UploadDirtyHeightsToGPU();
+            }
+            return;
+        }
+    }
+    else
+    {
+        // ===== CRITICAL: Include neighbors for boundary stitching =====
+        ChunksToUpdate = AffectedChunks;
+        
+        for (int32 ChunkIndex : AffectedChunks)
         {
-            ChunksToUpdate.Add(NeighborIndex);
+            TArray<int32> Neighbors = GetNeighboringChunks(ChunkIndex, false);
+            for (int32 NeighborIndex : Neighbors)
+            {
+                ChunksToUpdate.Add(NeighborIndex);
+            }
         }
     }
     
@@ -1506,11 +1617,7 @@ void ADynamicTerrain::ModifyTerrainAtIndex(int32 X, int32 Y, float Radius, float
         // Queue remaining with VERY high priority (process next frame)
         for (int32 ChunkIndex : RemainingChunks)
         {
-            FChunkUpdateRequest Request;
-            Request.ChunkIndex = ChunkIndex;
-            Request.Priority = 95.0f; // Very high
-            Request.RequestTime = GetCachedFrameTime();
-            PriorityChunkQueue.Add(Request);
+            ChunkUpdateScheduler.Push(ChunkIndex, 95.0f); // Very high
         }
     }
     else
@@ -1519,28 +1626,59 @@ void ADynamicTerrain::ModifyTerrainAtIndex(int32 X, int32 Y, float Radius, float
         UE_LOG(LogTemp, Warning, TEXT("CPU: Massive brush - %d chunks, staged update"),
                ChunksToUpdate.Num());
         
-        int32 ImmediateSize = 30;
+        int32 ImmediateSize = bUseAsyncChunkMeshBuilds ? MaxAsyncChunkBuildsPerFrame : 30;
         
-        for (int32 i = 0; i < FMath::Min(ImmediateSize, ChunkArray.Num()); i++)
+        if (bUseAsyncChunkMeshBuilds)
+        {
+            TArray<int32> ImmediateChunks(ChunkArray.GetData(), FMath::Min(ImmediateSize, ChunkArray.Num()));
+            DispatchChunkMeshBuilds(ImmediateChunks);
+        }
+        else
         {
-            UpdateChunk(ChunkArray[i]);
-            PendingChunkUpdates.Remove(ChunkArray[i]);
+            for (int32 i = 0; i < FMath::Min(ImmediateSize, ChunkArray.Num()); i++)
+            {
+                UpdateChunk(ChunkArray[i]);
+                ChunkUpdateScheduler.Remove(ChunkArray[i]);
+            }
         }
         
         // Queue remaining
         for (int32 i = ImmediateSize; i < ChunkArray.Num(); i++)
         {
-            FChunkUpdateRequest Request;
-            Request.ChunkIndex = ChunkArray[i];
-            Request.Priority = 90.0f - (i * 0.02f);
-            Request.RequestTime = GetCachedFrameTime();
-            PriorityChunkQueue.Add(Request);
+            ChunkUpdateScheduler.Push(ChunkArray[i], 90.0f - (i * 0.02f));
         }
     }
     
     if (bUseGPUTerrain)
     {
-        SyncCPUToGPU();
+        MarkHeightsDirtyForGPU(BrushRect);
+        UploadDirtyHeightsToGPU();
+    }
+}
+
+void ADynamicTerrain::CollectChunksInRect(const FIntRect& CellRect, TSet<int32>& OutChunks) const
+{
+    // Overlapping chunks share border vertices, so test every chunk whose range can reach the rect
+    const int32 Stride = FMath::Max(ChunkSize - ChunkOverlap, 1);
+    const int32 MinChunkX = FMath::Clamp((CellRect.Min.X - ChunkSize) / Stride, 0, ChunksX - 1);
+    const int32 MaxChunkX = FMath::Clamp(CellRect.Max.X / Stride, 0, ChunksX - 1);
+    const int32 MinChunkY = FMath::Clamp((CellRect.Min.Y - ChunkSize) / Stride, 0, ChunksY - 1);
+    const int32 MaxChunkY = FMath::Clamp(CellRect.Max.Y / Stride, 0, ChunksY - 1);
+    
+    for (int32 ChunkY = MinChunkY; ChunkY <= MaxChunkY; ChunkY++)
+    {
+        for (int32 ChunkX = MinChunkX; ChunkX <= MaxChunkX; ChunkX++)
+        {
+            int32 StartX, StartY, EndX, EndY;
+            GetChunkVertexRange(ChunkX, ChunkY, StartX, StartY, EndX, EndY);
+            if (CellRect.Max.X < StartX || CellRect.Min.X >= EndX ||
+                CellRect.Max.Y < StartY || CellRect.Min.Y >= EndY)
+            {
+                continue;
+            }
+            
+            OutChunks.Add(ChunkY * ChunksX + ChunkX);
+        }
     }
 }
 
@@ -1563,18 +1701,32 @@ void ADynamicTerrain::GenerateChunkMesh(int32 ChunkX, int32 ChunkY)
         return;
     }
     
-    FTerrainChunk& Chunk = TerrainChunks[ChunkIndex];
-    if (!Chunk.MeshComponent)
+    if (!TerrainChunks[ChunkIndex].MeshComponent)
     {
         UE_LOG(LogTemp, Error, TEXT("Chunk mesh component is null for chunk %d,%d"), ChunkX, ChunkY);
         return;
     }
     
+    // Synchronous path: same snapshot/build/apply stages the async pipeline uses, run inline
+    FChunkMeshBuildInput Input;
+    MakeChunkMeshBuildInput(ChunkIndex, Input);
+    
+    // Supersede any in-flight build so its older result is dropped when it lands
+    if (ChunkMeshGenerations.IsValidIndex(ChunkIndex))
+    {
+        Input.Generation = ++ChunkMeshGenerations[ChunkIndex];
+    }
+    
+    FChunkMeshBuildResult Result;
+    BuildChunkMeshData(Input, Result);
+    ApplyChunkMeshResult(Result);
+}
+
+void ADynamicTerrain::GetChunkVertexRange(int32 ChunkX, int32 ChunkY, int32& OutStartX, int32& OutStartY, int32& OutEndX, int32& OutEndY) const
+{
     // CRITICAL FIX: Use consistent ChunkSize calculation with enhanced overlap
     int32 StartX = ChunkX * (ChunkSize - ChunkOverlap);
     int32 StartY = ChunkY * (ChunkSize - ChunkOverlap);
-    int32 EndX = FMath::Min(StartX + ChunkSize, TerrainWidth);
-    int32 EndY = FMath::Min(StartY + ChunkSize, TerrainHeight);
     
     // BOUNDARY VALIDATION: Ensure chunks actually overlap with neighbors
     if (ChunkX > 0)
@@ -1597,83 +1749,210 @@ void ADynamicTerrain::GenerateChunkMesh(int32 ChunkX, int32 ChunkY)
         }
     }
     
-    TArray<FVector> Vertices;
-    TArray<int32> Triangles;
-    TArray<FVector> Normals;
-    TArray<FVector2D> UVs;
-    TArray<FLinearColor> VertexColors;
+    OutStartX = StartX;
+    OutStartY = StartY;
+    OutEndX = FMath::Min(StartX + ChunkSize, TerrainWidth);
+    OutEndY = FMath::Min(StartY + ChunkSize, TerrainHeight);
+}
+
+void ADynamicTerrain::MakeChunkMeshBuildInput(int32 ChunkIndex, FChunkMeshBuildInput& OutInput) const
+{
+    const FTerrainChunk& Chunk = TerrainChunks[ChunkIndex];
     
-    // Generate vertices for this chunk
-    for (int32 Y = StartY; Y < EndY; Y++)
+    int32 StartX, StartY, EndX, EndY;
+    GetChunkVertexRange(Chunk.ChunkX, Chunk.ChunkY, StartX, StartY, EndX, EndY);
+    
+    OutInput.ChunkIndex = ChunkIndex;
+    OutInput.Generation = ChunkMeshGenerations.IsValidIndex(ChunkIndex) ? ChunkMeshGenerations[ChunkIndex] : 0;
+    OutInput.StartX = StartX;
+    OutInput.StartY = StartY;
+    OutInput.ChunkWidth = FMath::Max(0, EndX - StartX);
+    OutInput.ChunkHeight = FMath::Max(0, EndY - StartY);
+    OutInput.LOD = bEnableAdvancedLOD ? FMath::Clamp(Chunk.LOD, 0, MaxChunkLOD) : 0;
+    OutInput.bSkirts = bEnableAdvancedLOD;
+    OutInput.MinSkirtDepth = LODSkirtDepth;
+    OutInput.TerrainScale = TerrainScale;
+    OutInput.MaxTerrainHeight = MaxTerrainHeight;
+    
+    // GPU Rendering Mode: Generate FLAT mesh, material WPO handles height
+    // This eliminates expensive mesh regeneration when erosion changes heights
+    OutInput.bFlatMesh = bUseGPUHeightmapRendering && bGPUInitialized;
+    OutInput.bUpNormals = bUseGPUHeightmapRendering;
+    
+    OutInput.Heights.Reset();
+    if (OutInput.bFlatMesh || OutInput.ChunkWidth == 0 || OutInput.ChunkHeight == 0)
     {
-        for (int32 X = StartX; X < EndX; X++)
+        return;
+    }
+    
+    // Copy the chunk plus a one-cell border so normals never read outside the snapshot
+    const int32 PaddedWidth = OutInput.ChunkWidth + 2;
+    const int32 PaddedHeight = OutInput.ChunkHeight + 2;
+    OutInput.Heights.SetNumUninitialized(PaddedWidth * PaddedHeight);
+    
+    for (int32 PY = 0; PY < PaddedHeight; PY++)
+    {
+        const int32 Y = StartY + PY - 1;
+        const bool bRowInside = Y >= 0 && Y < TerrainHeight;
+        float* Row = OutInput.Heights.GetData() + PY * PaddedWidth;
+        
+        for (int32 PX = 0; PX < PaddedWidth; PX++)
         {
-            float Height;
-
-            // GPU Rendering Mode: Generate FLAT mesh, material WPO handles height
-            // This eliminates expensive mesh regeneration when erosion changes heights
-            if (bUseGPUHeightmapRendering && bGPUInitialized)
-            {
-                Height = 0.0f;  // Flat mesh - WPO will displace
-            }
-            else
-            {
-                Height = GetHeightSafe(X, Y);  // Traditional CPU-baked heights
-            }
+            const int32 X = StartX + PX - 1;
+            Row[PX] = (bRowInside && X >= 0 && X < TerrainWidth) ? HeightMap[Y * TerrainWidth + X] : GetHeightSafe(X, Y);
+        }
+    }
+}
 
+void ADynamicTerrain::BuildChunkMeshData(const FChunkMeshBuildInput& Input, FChunkMeshBuildResult& OutResult)
+{
+    // Runs on any thread: touches nothing but the input snapshot and the output buffers
+    OutResult.ChunkIndex = Input.ChunkIndex;
+    OutResult.Generation = Input.Generation;
+    
+    const int32 ChunkWidth = Input.ChunkWidth;
+    const int32 ChunkHeight = Input.ChunkHeight;
+    const int32 PaddedWidth = ChunkWidth + 2;
+    const bool bHasHeights = Input.Heights.Num() == PaddedWidth * (ChunkHeight + 2);
+    
+    // LOD N keeps every (1 << N)th vertex of the full-resolution grid, plus the last row and column
+    const int32 MeshWidth = FGridIndexBufferCache::GetLODVertexCount(ChunkWidth, Input.LOD);
+    const int32 MeshHeight = FGridIndexBufferCache::GetLODVertexCount(ChunkHeight, Input.LOD);
+    const int32 NumSkirtVertices = Input.bSkirts ? FGridIndexBufferCache::GetNumPerimeterVertices(MeshWidth, MeshHeight) : 0;
+    const int32 NumVertices = MeshWidth * MeshHeight + NumSkirtVertices;
+    
+    OutResult.Vertices.Reset(NumVertices);
+    OutResult.Normals.Reset(NumVertices);
+    OutResult.UVs.Reset(NumVertices);
+    OutResult.VertexColors.Reset(NumVertices);
+    OutResult.StartX = Input.StartX;
+    OutResult.StartY = Input.StartY;
+    OutResult.ChunkWidth = ChunkWidth;
+    OutResult.ChunkHeight = ChunkHeight;
+    OutResult.LOD = Input.LOD;
+    OutResult.bSkirts = Input.bSkirts;
+    OutResult.bHeightsBaked = bHasHeights && !Input.bFlatMesh && !Input.bUpNormals;
+    
+    // Generate vertices for this chunk (full-resolution coordinates, so every LOD shares positions and UVs)
+    for (int32 MeshY = 0; MeshY < MeshHeight; MeshY++)
+    {
+        const int32 Y = FGridIndexBufferCache::GetLODVertexCoordinate(ChunkHeight, Input.LOD, MeshY);
+        for (int32 MeshX = 0; MeshX < MeshWidth; MeshX++)
+        {
+            const int32 X = FGridIndexBufferCache::GetLODVertexCoordinate(ChunkWidth, Input.LOD, MeshX);
+            const int32 PaddedIndex = (Y + 1) * PaddedWidth + (X + 1);
+            float Height = (bHasHeights && !Input.bFlatMesh) ? Input.Heights[PaddedIndex] : 0.0f;
+            
             // Local position within chunk (relative to chunk origin)
-            FVector LocalPosition = FVector(
-                (X - StartX) * TerrainScale,
-                (Y - StartY) * TerrainScale,
-                Height
-            );
-
-            Vertices.Add(LocalPosition);
-
+            OutResult.Vertices.Add(FVector(X * Input.TerrainScale, Y * Input.TerrainScale, Height));
+            
             // Calculate normal (for GPU mode, material will recalculate from heightmap)
-            FVector Normal = bUseGPUHeightmapRendering ? FVector::UpVector : CalculateVertexNormal(X, Y);
-            Normals.Add(Normal);
-
+            FVector Normal = FVector::UpVector;
+            if (!Input.bUpNormals && bHasHeights)
+            {
+                Normal = ComputeGridNormal(
+                    Input.Heights[PaddedIndex - 1], Input.Heights[PaddedIndex + 1],
+                    Input.Heights[PaddedIndex - PaddedWidth], Input.Heights[PaddedIndex + PaddedWidth],
+                    Input.TerrainScale);
+            }
+            OutResult.Normals.Add(Normal);
+            
             // UV0: Local UVs for chunk texturing
-            float U = (float)(X - StartX) / (EndX - StartX - 1);
-            float V = (float)(Y - StartY) / (EndY - StartY - 1);
-            UVs.Add(FVector2D(U, V));
-
+            float U = (float)X / (ChunkWidth - 1);
+            float V = (float)Y / (ChunkHeight - 1);
+            OutResult.UVs.Add(FVector2D(U, V));
+            
             // Height-based vertex colors (for GPU mode, use 0 as placeholder)
-            float NormalizedHeight = bUseGPUHeightmapRendering ? 0.0f : Height / MaxTerrainHeight;
-            FLinearColor VertexColor = GetHeightBasedColor(NormalizedHeight);
-            VertexColors.Add(VertexColor);
+            float NormalizedHeight = Input.bUpNormals ? 0.0f : Height / Input.MaxTerrainHeight;
+            OutResult.VertexColors.Add(GetHeightBasedColor(NormalizedHeight));
         }
     }
     
-    // Generate triangles for this chunk
-    int32 ChunkWidth = EndX - StartX;
-    int32 ChunkHeight = EndY - StartY;
-    
-    for (int32 Y = 0; Y < ChunkHeight - 1; Y++)
+    // Skirt ring: copies of the perimeter vertices pushed down far enough to cover any crack
+    OutResult.SkirtDepth = 0.0f;
+    if (NumSkirtVertices > 0)
     {
-        for (int32 X = 0; X < ChunkWidth - 1; X++)
+        OutResult.SkirtDepth = Input.MinSkirtDepth;
+        if (bHasHeights && !Input.bFlatMesh)
         {
-            int32 BottomLeft = Y * ChunkWidth + X;
-            int32 BottomRight = Y * ChunkWidth + (X + 1);
-            int32 TopLeft = (Y + 1) * ChunkWidth + X;
-            int32 TopRight = (Y + 1) * ChunkWidth + (X + 1);
-
-            // First triangle
-            Triangles.Add(BottomLeft);
-            Triangles.Add(TopLeft);
-            Triangles.Add(BottomRight);
+            OutResult.SkirtDepth += GetChunkEdgeHeightRange(Input);
+        }
+        
+        for (int32 Ring = 0; Ring < NumSkirtVertices; Ring++)
+        {
+            const int32 EdgeVertex = FGridIndexBufferCache::GetPerimeterVertex(MeshWidth, MeshHeight, Ring);
+            OutResult.Vertices.Add(OutResult.Vertices[EdgeVertex] - FVector(0.0f, 0.0f, OutResult.SkirtDepth));
+            OutResult.Normals.Add(OutResult.Normals[EdgeVertex]);
+            OutResult.UVs.Add(OutResult.UVs[EdgeVertex]);
+            OutResult.VertexColors.Add(OutResult.VertexColors[EdgeVertex]);
+        }
+    }
+    
+    // Triangles come from the shared index buffer cache at apply time
+}
 
-            // Second triangle
-            Triangles.Add(BottomRight);
-            Triangles.Add(TopLeft);
-            Triangles.Add(TopRight);
+float ADynamicTerrain::GetChunkEdgeHeightRange(const FChunkMeshBuildInput& Input)
+{
+    // Between two lattice points of the coarsest LOD, every LOD's edge (and the full-resolution
+    // edge) stays inside the heights of that span, so its range bounds the crack against any neighbour
+    const int32 PaddedWidth = Input.ChunkWidth + 2;
+    auto HeightAt = [&Input, PaddedWidth](int32 X, int32 Y)
+    {
+        return Input.Heights[(Y + 1) * PaddedWidth + (X + 1)];
+    };
+    
+    float MaxRange = 0.0f;
+    auto ScanEdge = [&MaxRange, &HeightAt](int32 Length, TFunctionRef<float(int32)> EdgeHeight)
+    {
+        const int32 NumSpans = FGridIndexBufferCache::GetLODVertexCount(Length, MaxChunkLOD) - 1;
+        for (int32 Span = 0; Span < NumSpans; Span++)
+        {
+            const int32 Begin = FGridIndexBufferCache::GetLODVertexCoordinate(Length, MaxChunkLOD, Span);
+            const int32 End = FGridIndexBufferCache::GetLODVertexCoordinate(Length, MaxChunkLOD, Span + 1);
+            float MinHeight = EdgeHeight(Begin);
+            float MaxHeight = MinHeight;
+            for (int32 i = Begin + 1; i <= End; i++)
+            {
+                const float Height = EdgeHeight(i);
+                MinHeight = FMath::Min(MinHeight, Height);
+                MaxHeight = FMath::Max(MaxHeight, Height);
+            }
+            MaxRange = FMath::Max(MaxRange, MaxHeight - MinHeight);
         }
+    };
+    
+    const int32 LastX = Input.ChunkWidth - 1;
+    const int32 LastY = Input.ChunkHeight - 1;
+    ScanEdge(Input.ChunkWidth, [&HeightAt](int32 X) { return HeightAt(X, 0); });
+    ScanEdge(Input.ChunkWidth, [&HeightAt, LastY](int32 X) { return HeightAt(X, LastY); });
+    ScanEdge(Input.ChunkHeight, [&HeightAt](int32 Y) { return HeightAt(0, Y); });
+    ScanEdge(Input.ChunkHeight, [&HeightAt, LastX](int32 Y) { return HeightAt(LastX, Y); });
+    
+    return MaxRange;
+}
+
+void ADynamicTerrain::ApplyChunkMeshResult(const FChunkMeshBuildResult& Result)
+{
+    if (!TerrainChunks.IsValidIndex(Result.ChunkIndex))
+    {
+        return;
+    }
+    
+    FTerrainChunk& Chunk = TerrainChunks[Result.ChunkIndex];
+    if (!Chunk.MeshComponent)
+    {
+        return;
     }
     
-    // Create the mesh section
+    const int32 ChunkX = Chunk.ChunkX;
+    const int32 ChunkY = Chunk.ChunkY;
+    
+    // Create the mesh section (index list is shared by every chunk of this size)
+    TSharedRef<const TArray<int32>, ESPMode::ThreadSafe> Triangles =
+        FGridIndexBufferCache::Get().GetIndexBuffer(Result.ChunkWidth, Result.ChunkHeight, Result.LOD, Result.bSkirts);
+    
     Chunk.MeshComponent->CreateMeshSection_LinearColor(
-        0, Vertices, Triangles, Normals, UVs, VertexColors,
+        0, Result.Vertices, *Triangles, Result.Normals, Result.UVs, Result.VertexColors,
         TArray<FProcMeshTangent>(), true
     );
 
@@ -1738,24 +2017,154 @@ void ADynamicTerrain::GenerateChunkMesh(int32 ChunkX, int32 ChunkY)
     // Update chunk status
     Chunk.bNeedsUpdate = false;
     Chunk.LastUpdateTime = GetCachedFrameTime();
+    
+    // Remember the layout for dirty-rect updates (the section itself holds the vertices)
+    if (ChunkMeshLayouts.Num() != TerrainChunks.Num())
+    {
+        ChunkMeshLayouts.SetNum(TerrainChunks.Num());
+    }
+    FChunkMeshLayout& Layout = ChunkMeshLayouts[Result.ChunkIndex];
+    Layout.Generation = Result.Generation;
+    Layout.StartX = Result.StartX;
+    Layout.StartY = Result.StartY;
+    Layout.ChunkWidth = Result.ChunkWidth;
+    Layout.ChunkHeight = Result.ChunkHeight;
+    Layout.LOD = Result.LOD;
+    Layout.SkirtDepth = Result.SkirtDepth;
+    Layout.bSkirts = Result.bSkirts;
+    Layout.bHeightsBaked = Result.bHeightsBaked;
 }
 
-
-// 4.2 CHUNK UPDATE PIPELINE
-
-void ADynamicTerrain::UpdateChunk(int32 ChunkIndex)
+bool ADynamicTerrain::UpdateChunkRegion(int32 ChunkIndex, const FIntRect& HeightRect)
 {
-    if (!TerrainChunks.IsValidIndex(ChunkIndex))
+    if (!TerrainChunks.IsValidIndex(ChunkIndex) || !ChunkMeshLayouts.IsValidIndex(ChunkIndex))
     {
-        return;
+        return false;
     }
-
+    
     FTerrainChunk& Chunk = TerrainChunks[ChunkIndex];
-    GenerateChunkMesh(Chunk.ChunkX, Chunk.ChunkY);
+    const FChunkMeshLayout& Layout = ChunkMeshLayouts[ChunkIndex];
+    FProcMeshSection* Section = Chunk.MeshComponent ? Chunk.MeshComponent->GetProcMeshSection(0) : nullptr;
+    
+    // The section must hold the newest requested geometry, baked from CPU heights, at the current layout
+    const uint32 RequestedGeneration = ChunkMeshGenerations.IsValidIndex(ChunkIndex) ? ChunkMeshGenerations[ChunkIndex] : 0;
+    const int32 MeshWidth = FGridIndexBufferCache::GetLODVertexCount(Layout.ChunkWidth, Layout.LOD);
+    const int32 MeshHeight = FGridIndexBufferCache::GetLODVertexCount(Layout.ChunkHeight, Layout.LOD);
+    const int32 NumGridVertices = MeshWidth * MeshHeight;
+    const int32 NumSkirtVertices = Layout.bSkirts ? FGridIndexBufferCache::GetNumPerimeterVertices(MeshWidth, MeshHeight) : 0;
+    if (!Section || !Layout.bHeightsBaked || Layout.Generation != RequestedGeneration ||
+        Section->ProcVertexBuffer.Num() != NumGridVertices + NumSkirtVertices || NumGridVertices == 0)
+    {
+        return false;
+    }
+    
+    int32 StartX, StartY, EndX, EndY;
+    GetChunkVertexRange(Chunk.ChunkX, Chunk.ChunkY, StartX, StartY, EndX, EndY);
+    if (StartX != Layout.StartX || StartY != Layout.StartY ||
+        EndX - StartX != Layout.ChunkWidth || EndY - StartY != Layout.ChunkHeight)
+    {
+        return false;
+    }
+    
+    // Clip to this chunk's vertices (inclusive bounds)
+    const int32 MinX = FMath::Max(HeightRect.Min.X, StartX);
+    const int32 MinY = FMath::Max(HeightRect.Min.Y, StartY);
+    const int32 MaxX = FMath::Min(HeightRect.Max.X, EndX - 1);
+    const int32 MaxY = FMath::Min(HeightRect.Max.Y, EndY - 1);
+    if (MinX > MaxX || MinY > MaxY)
+    {
+        return true;
+    }
+    
+    // Mesh vertices whose lattice coordinates fall inside the rect (every vertex at LOD 0)
+    auto FirstMeshVertexAtOrAfter = [](int32 Length, int32 LOD, int32 Coordinate)
+    {
+        const int32 Step = 1 << LOD;
+        const int32 Count = FGridIndexBufferCache::GetLODVertexCount(Length, LOD);
+        return FMath::Min((Coordinate + Step - 1) / Step, Count - 1);
+    };
+    const int32 MeshMinX = FirstMeshVertexAtOrAfter(Layout.ChunkWidth, Layout.LOD, MinX - StartX);
+    const int32 MeshMinY = FirstMeshVertexAtOrAfter(Layout.ChunkHeight, Layout.LOD, MinY - StartY);
+    
+    TArray<FProcMeshVertex>& VertexBuffer = Section->ProcVertexBuffer;
+    for (int32 MeshY = MeshMinY; MeshY < MeshHeight; MeshY++)
+    {
+        const int32 Y = StartY + FGridIndexBufferCache::GetLODVertexCoordinate(Layout.ChunkHeight, Layout.LOD, MeshY);
+        if (Y > MaxY)
+        {
+            break;
+        }
+        if (Y < MinY)
+        {
+            continue;
+        }
+        
+        for (int32 MeshX = MeshMinX; MeshX < MeshWidth; MeshX++)
+        {
+            const int32 X = StartX + FGridIndexBufferCache::GetLODVertexCoordinate(Layout.ChunkWidth, Layout.LOD, MeshX);
+            if (X > MaxX)
+            {
+                break;
+            }
+            if (X < MinX)
+            {
+                continue;
+            }
+            
+            FProcMeshVertex& Vertex = VertexBuffer[MeshY * MeshWidth + MeshX];
+            const float Height = GetHeightSafe(X, Y);
+            
+            // Colour converted the same way CreateMeshSection_LinearColor did
+            Vertex.Position.Z = Height;
+            Vertex.Normal = CalculateVertexNormal(X, Y);
+            Vertex.Color = GetHeightBasedColor(Height / MaxTerrainHeight).ToFColor(false);
+        }
+    }
+    
+    // Skirt vertices follow their perimeter vertex (the depth stays as built until the next full rebuild)
+    for (int32 Ring = 0; Ring < NumSkirtVertices; Ring++)
+    {
+        const FProcMeshVertex& EdgeVertex = VertexBuffer[FGridIndexBufferCache::GetPerimeterVertex(MeshWidth, MeshHeight, Ring)];
+        FProcMeshVertex& SkirtVertex = VertexBuffer[NumGridVertices + Ring];
+        SkirtVertex.Position.Z = EdgeVertex.Position.Z - Layout.SkirtDepth;
+        SkirtVertex.Normal = EdgeVertex.Normal;
+        SkirtVertex.Color = EdgeVertex.Color;
+    }
+    
+    // UpdateMeshSection takes plain arrays and pushes the whole buffer to the render thread (and
+    // refreshes bounds/collision); these are transient, the section stays the only copy
+    const int32 NumVertices = VertexBuffer.Num();
+    TArray<FVector> Positions;
+    TArray<FVector> Normals;
+    TArray<FColor> Colors;
+    Positions.SetNumUninitialized(NumVertices);
+    Normals.SetNumUninitialized(NumVertices);
+    Colors.SetNumUninitialized(NumVertices);
+    for (int32 i = 0; i < NumVertices; i++)
+    {
+        Positions[i] = VertexBuffer[i].Position;
+        Normals[i] = VertexBuffer[i].Normal;
+        Colors[i] = VertexBuffer[i].Color;
+    }
+    
+    // Positions, normals and colours only; UVs and the shared index buffer are unchanged
+    Chunk.MeshComponent->UpdateMeshSection(
+        0, Positions, Normals, TArray<FVector2D>(), Colors, TArray<FProcMeshTangent>()
+    );
+    
+    Chunk.bNeedsUpdate = false;
+    Chunk.LastUpdateTime = GetCachedFrameTime();
+    ChunkUpdateScheduler.Remove(ChunkIndex);
+    TotalChunkUpdatesThisFrame++;
+    
+    return true;
+}
 
+void ADynamicTerrain::BindChunkGPUMaterialParams(FTerrainChunk& Chunk)
+{
     // CRITICAL: Update material parameters for GPU rendering mode
     // Without this, the flat mesh won't have heightmap texture binding or UV transforms
-    if (bUseGPUHeightmapRendering && bGPUInitialized && HeightRenderTexture)
+    if (bUseGPUHeightmapRendering && bGPUInitialized && HeightRenderTexture && Chunk.MeshComponent)
     {
         UMaterialInstanceDynamic* DynMaterial = Cast<UMaterialInstanceDynamic>(
             Chunk.MeshComponent->GetMaterial(0)
@@ -1765,73 +2174,186 @@ void ADynamicTerrain::UpdateChunk(int32 ChunkIndex)
             UpdateGPUChunkMaterialParams(DynMaterial, Chunk);
         }
     }
-
-    TotalChunkUpdatesThisFrame++;
 }
 
+// 4.1b ASYNC CHUNK MESH BUILDS
 
-void ADynamicTerrain::MarkChunkForUpdate(int32 ChunkIndex)
+void ADynamicTerrain::DispatchChunkMeshBuilds(const TArray<int32>& ChunkIndices)
 {
-    if (TerrainChunks.IsValidIndex(ChunkIndex))
+    if (ChunkIndices.Num() == 0)
     {
-        PendingChunkUpdates.Add(ChunkIndex);
-        TerrainChunks[ChunkIndex].bNeedsUpdate = true;
+        return;
     }
-}
-
-
-void ADynamicTerrain::RequestPriorityChunkUpdate(int32 ChunkIndex, float Priority)
-{
-    if (!TerrainChunks.IsValidIndex(ChunkIndex)) return;
-    
-    // CRITICAL FIX: Get neighboring chunks to prevent tears
-    TArray<int32> ChunkGroup = GetNeighboringChunks(ChunkIndex, false); // Only direct neighbors
-    ChunkGroup.Insert(ChunkIndex, 0); // Main chunk gets highest priority
     
-    // Remove all chunks from old pending system
-    for (int32 GroupChunkIndex : ChunkGroup)
+    if (ChunkMeshGenerations.Num() != TerrainChunks.Num())
     {
-        PendingChunkUpdates.Remove(GroupChunkIndex);
+        ChunkMeshGenerations.SetNumZeroed(TerrainChunks.Num());
     }
     
-    // Add entire group to priority queue with slight priority offset
-    for (int32 i = 0; i < ChunkGroup.Num(); i++)
+    TUniquePtr<FChunkMeshBuildBatch> Batch = MakeUnique<FChunkMeshBuildBatch>();
+    Batch->Inputs.Reserve(ChunkIndices.Num());
+    
+    // Snapshot on the game thread; the newest generation wins if a chunk is rebuilt before this lands
+    for (int32 ChunkIndex : ChunkIndices)
     {
-        FChunkUpdateRequest Request;
-        Request.ChunkIndex = ChunkGroup[i];
-        Request.Priority = Priority - (i * 0.1f); // Main chunk gets highest priority
-        Request.RequestTime = GetCachedFrameTime();
-        
-        PriorityChunkQueue.Add(Request);
-        if (TerrainChunks.IsValidIndex(ChunkGroup[i]))
+        if (!TerrainChunks.IsValidIndex(ChunkIndex) || !TerrainChunks[ChunkIndex].MeshComponent)
         {
-            TerrainChunks[ChunkGroup[i]].bNeedsUpdate = true;
+            continue;
         }
+        
+        ++ChunkMeshGenerations[ChunkIndex];
+        MakeChunkMeshBuildInput(ChunkIndex, Batch->Inputs.AddDefaulted_GetRef());
+        ChunkUpdateScheduler.Remove(ChunkIndex);
     }
-}
-
-
-float ADynamicTerrain::CalculateChunkDistance(int32 ChunkIndex, FVector FromPosition) const
-{
-    if (!TerrainChunks.IsValidIndex(ChunkIndex)) return 99999.0f;
     
-    FVector ChunkWorldPos = GetChunkWorldPosition(ChunkIndex);
-    return FVector::Dist(FromPosition, ChunkWorldPos);
-}
-
-
-// 4.3 WATER-SPECIFIC CHUNK UPDATES
-
-void ADynamicTerrain::MarkChunkForWaterUpdate(int32 ChunkIndex)
-{
-    if (TerrainChunks.IsValidIndex(ChunkIndex))
+    if (Batch->Inputs.Num() == 0)
     {
-        PendingWaterChunkUpdates.Add(ChunkIndex);
+        return;
     }
+    
+    Batch->Results.SetNum(Batch->Inputs.Num());
+    
+    FChunkMeshBuildBatch* BatchPtr = Batch.Get();
+    Batch->Task = UE::Tasks::Launch(UE_SOURCE_LOCATION, [BatchPtr]()
+    {
+        ParallelFor(BatchPtr->Inputs.Num(), [BatchPtr](int32 i)
+        {
+            BuildChunkMeshData(BatchPtr->Inputs[i], BatchPtr->Results[i]);
+        });
+    });
+    
+    InFlightChunkMeshBuilds.Add(MoveTemp(Batch));
 }
 
-
-void ADynamicTerrain::BatchUpdateWaterChunks(const TArray<int32>& ChunkIndices)
+void ADynamicTerrain::ApplyCompletedChunkMeshBuilds()
+{
+    // Apply in dispatch order and stop at the first unfinished batch so results never land out of order
+    int32 NumApplied = 0;
+    while (NumApplied < InFlightChunkMeshBuilds.Num() && InFlightChunkMeshBuilds[NumApplied]->Task.IsCompleted())
+    {
+        FChunkMeshBuildBatch& Batch = *InFlightChunkMeshBuilds[NumApplied];
+        
+        for (FChunkMeshBuildResult& Result : Batch.Results)
+        {
+            // A newer build (async or synchronous) superseded this one
+            if (!ChunkMeshGenerations.IsValidIndex(Result.ChunkIndex) ||
+                ChunkMeshGenerations[Result.ChunkIndex] != Result.Generation)
+            {
+                continue;
+            }
+            
+            ApplyChunkMeshResult(Result);
+            BindChunkGPUMaterialParams(TerrainChunks[Result.ChunkIndex]);
+            TotalChunkUpdatesThisFrame++;
+        }
+        
+        NumApplied++;
+    }
+    
+    if (NumApplied > 0)
+    {
+        InFlightChunkMeshBuilds.RemoveAt(0, NumApplied);
+    }
+}
+
+void ADynamicTerrain::CancelChunkMeshBuilds()
+{
+    // Tasks only reference their own batch, so waiting is all that is needed before freeing it
+    for (const TUniquePtr<FChunkMeshBuildBatch>& Batch : InFlightChunkMeshBuilds)
+    {
+        Batch->Task.Wait();
+    }
+    InFlightChunkMeshBuilds.Empty();
+    ChunkMeshGenerations.Reset();
+    ChunkMeshLayouts.Reset();
+}
+
+
+// 4.2 CHUNK UPDATE PIPELINE
+
+void ADynamicTerrain::UpdateChunk(int32 ChunkIndex)
+{
+    if (!TerrainChunks.IsValidIndex(ChunkIndex))
+    {
+        return;
+    }
+
+    FTerrainChunk& Chunk = TerrainChunks[ChunkIndex];
+    GenerateChunkMesh(Chunk.ChunkX, Chunk.ChunkY);
+    BindChunkGPUMaterialParams(Chunk);
+
+    TotalChunkUpdatesThisFrame++;
+}
+
+
+void ADynamicTerrain::MarkChunkForUpdate(int32 ChunkIndex)
+{
+    // Safe from worker threads: off the game thread only the index goes through the lock-free
+    // inbox, and ProcessPendingChunkUpdates() comes back here on the game thread to set the flag
+    if (!IsInGameThread())
+    {
+        ChunkUpdateScheduler.Enqueue(ChunkIndex);
+        return;
+    }
+
+    if (TerrainChunks.IsValidIndex(ChunkIndex))
+    {
+        ChunkUpdateScheduler.Push(ChunkIndex);
+        TerrainChunks[ChunkIndex].bNeedsUpdate = true;
+    }
+}
+
+
+void ADynamicTerrain::RequestPriorityChunkUpdate(int32 ChunkIndex, float Priority)
+{
+    // Off the game thread, as above: the neighbour group is expanded when the inbox is drained
+    if (!IsInGameThread())
+    {
+        ChunkUpdateScheduler.Enqueue(ChunkIndex, Priority, ChunkRequestWithNeighbors);
+        return;
+    }
+
+    if (!TerrainChunks.IsValidIndex(ChunkIndex)) return;
+    
+    // CRITICAL FIX: Get neighboring chunks to prevent tears
+    TArray<int32> ChunkGroup = GetNeighboringChunks(ChunkIndex, false); // Only direct neighbors
+    ChunkGroup.Insert(ChunkIndex, 0); // Main chunk gets highest priority
+    
+    // Schedule entire group with slight priority offset (already queued chunks keep the higher priority)
+    for (int32 i = 0; i < ChunkGroup.Num(); i++)
+    {
+        const float GroupPriority = Priority - (i * 0.1f); // Main chunk gets highest priority
+        ChunkUpdateScheduler.Push(ChunkGroup[i], GroupPriority);
+        
+        if (TerrainChunks.IsValidIndex(ChunkGroup[i]))
+        {
+            TerrainChunks[ChunkGroup[i]].bNeedsUpdate = true;
+        }
+    }
+}
+
+
+float ADynamicTerrain::CalculateChunkDistance(int32 ChunkIndex, FVector FromPosition) const
+{
+    if (!TerrainChunks.IsValidIndex(ChunkIndex)) return 99999.0f;
+    
+    FVector ChunkWorldPos = GetChunkWorldPosition(ChunkIndex);
+    return FVector::Dist(FromPosition, ChunkWorldPos);
+}
+
+
+// 4.3 WATER-SPECIFIC CHUNK UPDATES
+
+void ADynamicTerrain::MarkChunkForWaterUpdate(int32 ChunkIndex)
+{
+    if (TerrainChunks.IsValidIndex(ChunkIndex))
+    {
+        PendingWaterChunkUpdates.Add(ChunkIndex);
+    }
+}
+
+
+void ADynamicTerrain::BatchUpdateWaterChunks(const TArray<int32>& ChunkIndices)
 {
     if (!bEnablePrecipitationOptimization)
     {
@@ -1935,7 +2457,7 @@ void ADynamicTerrain::ProcessPendingWaterChunkUpdates()
  *
  * Dependencies:
  * - Called from Tick() after frustum culling
- * - Requires PriorityChunkQueue and PendingChunkUpdates to be populated
+ * - Drains ChunkUpdateScheduler (requests from other threads are merged first)
  */
 
 
@@ -1943,7 +2465,37 @@ void ADynamicTerrain::ProcessPendingWaterChunkUpdates()
 
 void ADynamicTerrain::ProcessPendingChunkUpdates()
 {
-    int32 TotalUpdatesNeeded = PriorityChunkQueue.Num() + PendingChunkUpdates.Num();
+    // Merge requests posted from other threads (flags and neighbour groups are set here, on
+    // the game thread), then drain highest priority first
+    ChunkUpdateScheduler.FlushIncoming([this](int32 RequestedChunk, float Priority, uint8 Flags)
+    {
+        if (Flags & ChunkRequestWithNeighbors)
+        {
+            RequestPriorityChunkUpdate(RequestedChunk, Priority);
+        }
+        else
+        {
+            MarkChunkForUpdate(RequestedChunk);
+        }
+    });
+    
+    int32 ChunkIndex = INDEX_NONE;
+    
+    // Async: mesh building is off the game thread, so drain a much larger slice in one batch
+    if (bUseAsyncChunkMeshBuilds)
+    {
+        TArray<int32> ChunksToBuild;
+        while (ChunksToBuild.Num() < MaxAsyncChunkBuildsPerFrame && ChunkUpdateScheduler.Pop(ChunkIndex))
+        {
+            ChunksToBuild.Add(ChunkIndex);
+        }
+        
+        DispatchChunkMeshBuilds(ChunksToBuild);
+        ProcessPendingWaterChunkUpdates();
+        return;
+    }
+    
+    int32 TotalUpdatesNeeded = ChunkUpdateScheduler.Num();
     
     int32 UpdatesThisFrame;
     if (TotalUpdatesNeeded > 50)
@@ -1956,98 +2508,31 @@ void ADynamicTerrain::ProcessPendingChunkUpdates()
         UpdatesThisFrame = MaxUpdatesPerFrame;
     
     int32 ProcessedThisFrame = 0;
+    float BasePriority = 0.0f;
     
-    if (PriorityChunkQueue.Num() > 0)
+    while (ProcessedThisFrame < UpdatesThisFrame && ChunkUpdateScheduler.Pop(ChunkIndex, &BasePriority))
     {
-        PriorityChunkQueue.Sort();
+        // ===== Group queued neighbors of similar priority (within 1.0) so shared borders update together =====
+        TArray<int32> ChunkGroup;
+        ChunkGroup.Add(ChunkIndex);
         
-        // ===== NEW: Group chunks by proximity =====
-        TSet<int32> ProcessedChunks;
-        
-        while (ProcessedThisFrame < UpdatesThisFrame && PriorityChunkQueue.Num() > 0)
+        for (int32 NeighborIndex : GetNeighboringChunks(ChunkIndex, false))
         {
-            int32 ChunkIndex = PriorityChunkQueue[0].ChunkIndex;
-            
-            if (ProcessedChunks.Contains(ChunkIndex))
-            {
-                PriorityChunkQueue.RemoveAt(0);
-                continue;
-            }
-            
-            // Get this chunk + its neighbors
-            TArray<int32> ChunkGroup;
-            ChunkGroup.Add(ChunkIndex);
-            
-            // Check if neighbors are in queue with similar priority
-            float BasePriority = PriorityChunkQueue[0].Priority;
-            TArray<int32> Neighbors = GetNeighboringChunks(ChunkIndex, false);
-            
-            for (int32 NeighborIndex : Neighbors)
-            {
-                // Find neighbor in priority queue
-                for (int32 i = 1; i < FMath::Min(8, PriorityChunkQueue.Num()); i++)
-                {
-                    if (PriorityChunkQueue[i].ChunkIndex == NeighborIndex)
-                    {
-                        float PriorityDiff = FMath::Abs(BasePriority - PriorityChunkQueue[i].Priority);
-                        
-                        // If neighbor has similar priority (within 1.0), group it
-                        if (PriorityDiff < 1.0f)
-                        {
-                            ChunkGroup.Add(NeighborIndex);
-                        }
-                        break;
-                    }
-                }
-            }
+            if (ProcessedThisFrame + ChunkGroup.Num() >= UpdatesThisFrame)
+                break;
             
-            // Update entire group atomically
-            if (ChunkGroup.Num() <= 5 && (ProcessedThisFrame + ChunkGroup.Num()) <= UpdatesThisFrame)
-            {
-                // Can fit entire group this frame
-                UpdateChunkGroupAtomic(ChunkGroup);
-                ProcessedThisFrame += ChunkGroup.Num();
-                
-                // Mark as processed
-                for (int32 Idx : ChunkGroup)
-                {
-                    ProcessedChunks.Add(Idx);
-                }
-                
-                // Remove from queue
-                PriorityChunkQueue.RemoveAll([&ProcessedChunks](const FChunkUpdateRequest& Req) {
-                    return ProcessedChunks.Contains(Req.ChunkIndex);
-                });
-            }
-            else
+            float NeighborPriority = 0.0f;
+            if (ChunkUpdateScheduler.GetPriority(NeighborIndex, NeighborPriority) &&
+                FMath::Abs(BasePriority - NeighborPriority) < 1.0f)
             {
-                // Just update the main chunk
-                UpdateChunk(ChunkIndex);
-                ProcessedThisFrame++;
-                ProcessedChunks.Add(ChunkIndex);
-                PriorityChunkQueue.RemoveAt(0);
+                ChunkUpdateScheduler.Remove(NeighborIndex);
+                ChunkGroup.Add(NeighborIndex);
             }
         }
-    }
-    
-    // Standard pending updates
-    int32 RemainingCapacity = UpdatesThisFrame - ProcessedThisFrame;
-    if (RemainingCapacity > 0 && PendingChunkUpdates.Num() > 0)
-    {
-        TArray<int32> ChunksToUpdate;
-        for (int32 ChunkIndex : PendingChunkUpdates)
-        {
-            ChunksToUpdate.Add(ChunkIndex);
-            if (ChunksToUpdate.Num() >= RemainingCapacity)
-                break;
-        }
         
-        for (int32 ChunkIndex : ChunksToUpdate)
-        {
-            PendingChunkUpdates.Remove(ChunkIndex);
-            UpdateChunk(ChunkIndex);
-            ProcessedThisFrame++;
-        }
+        // Update entire group atomically
+        UpdateChunkGroupAtomic(ChunkGroup);
+        ProcessedThisFrame += ChunkGroup.Num();
     }
     
     ProcessPendingWaterChunkUpdates();
@@ -2244,6 +2729,14 @@ float ADynamicTerrain::GetHeightSafe(int32 X, int32 Y) const
 }
 
 void ADynamicTerrain::SetHeightSafe(int32 X, int32 Y, float Height)
+{
+    if (SetHeightUnnotified(X, Y, Height))
+    {
+        NotifyHeightRegionChanged(FIntRect(X, Y, X, Y));
+    }
+}
+
+bool ADynamicTerrain::SetHeightUnnotified(int32 X, int32 Y, float Height)
 {
     if (X >= 0 && X < TerrainWidth && Y >= 0 && Y < TerrainHeight && HeightMap.Num() > 0)
     {
@@ -2251,8 +2744,26 @@ void ADynamicTerrain::SetHeightSafe(int32 X, int32 Y, float Height)
         if (Index >= 0 && Index < HeightMap.Num())
         {
             HeightMap[Index] = Height;
+            return true;
         }
     }
+    return false;
+}
+
+void ADynamicTerrain::NotifyHeightRegionChanged(const FIntRect& CellRect)
+{
+    if (AtmosphericSystem)
+    {
+        AtmosphericSystem->MarkSurfaceRegionDirty(CellRect);
+    }
+}
+
+void ADynamicTerrain::NotifyAllHeightsChanged()
+{
+    if (AtmosphericSystem)
+    {
+        AtmosphericSystem->MarkAllSurfaceDirty();
+    }
 }
 
 // 5.3 NORMAL CALCULATION & COLORS
@@ -2265,9 +2776,14 @@ FVector ADynamicTerrain::CalculateVertexNormal(int32 X, int32 Y) const
     float HeightD = GetHeightSafe(X, Y - 1);     // Down
     float HeightU = GetHeightSafe(X, Y + 1);     // Up
     
+    return ComputeGridNormal(HeightL, HeightR, HeightD, HeightU, TerrainScale);
+}
+
+FVector ADynamicTerrain::ComputeGridNormal(float HeightL, float HeightR, float HeightD, float HeightU, float GridSpacing)
+{
     // Calculate gradient vectors
-    FVector TangentX = FVector(2.0f * TerrainScale, 0.0f, HeightR - HeightL);
-    FVector TangentY = FVector(0.0f, 2.0f * TerrainScale, HeightU - HeightD);
+    FVector TangentX = FVector(2.0f * GridSpacing, 0.0f, HeightR - HeightL);
+    FVector TangentY = FVector(0.0f, 2.0f * GridSpacing, HeightU - HeightD);
     
     // Cross product to get normal
     FVector Normal = FVector::CrossProduct(TangentX, TangentY);
@@ -2276,7 +2792,7 @@ FVector ADynamicTerrain::CalculateVertexNormal(int32 X, int32 Y) const
     return Normal;
 }
 
-FLinearColor ADynamicTerrain::GetHeightBasedColor(float NormalizedHeight) const
+FLinearColor ADynamicTerrain::GetHeightBasedColor(float NormalizedHeight)
 {
     // Height-based color blending for terrain materials
     if (NormalizedHeight < 0.2f)
@@ -2642,7 +3158,7 @@ void ADynamicTerrain::UpdatePerformanceStats(float DeltaTime)
         if (GEngine)
         {
             float CurrentFPS = 1.0f / DeltaTime;
-            int32 PendingUpdates = PendingChunkUpdates.Num();
+            int32 PendingUpdates = ChunkUpdateScheduler.Num();
             
             // Pre-allocate debug strings to reduce GC pressure
             CachedDebugStringBuffer = FString::Printf(TEXT("FPS: %.1f"), CurrentFPS);
@@ -3057,13 +3573,20 @@ void ADynamicTerrain::ValidateChunkBoundary(int32 ChunkIndex)
 
 void ADynamicTerrain::UpdateChunkGroupAtomic(const TArray<int32>& ChunkIndices)
 {
+    // Async: one batch is applied as a unit on the frame it completes, which keeps the same guarantee
+    if (bUseAsyncChunkMeshBuilds)
+    {
+        DispatchChunkMeshBuilds(ChunkIndices);
+        return;
+    }
+    
     // Atomic update: process all chunks in single frame to prevent tears
     for (int32 ChunkIndex : ChunkIndices)
     {
         if (TerrainChunks.IsValidIndex(ChunkIndex))
         {
             UpdateChunk(ChunkIndex);
-            PendingChunkUpdates.Remove(ChunkIndex);
+            ChunkUpdateScheduler.Remove(ChunkIndex);
             TerrainChunks[ChunkIndex].bNeedsUpdate = false;
         }
     }
@@ -3263,7 +3786,7 @@ int32 ADynamicTerrain::CalculateChunkLOD(int32 ChunkIndex, FVector CameraLocatio
         BaseLOD = FMath::Max(0, BaseLOD - 1); // Higher detail for water
     }
     
-    return FMath::Clamp(BaseLOD, 0, 3);
+    return FMath::Clamp(BaseLOD, 0, MaxChunkLOD);
 }
 
 
@@ -3276,18 +3799,24 @@ void ADynamicTerrain::UpdateChunkLOD(int32 ChunkIndex, int32 NewLOD)
     
     FTerrainChunk& Chunk = TerrainChunks[ChunkIndex];
     
-    // Only update if LOD changed significantly
-    static TMap<int32, int32> LastKnownLODs;
-    int32* LastLOD = LastKnownLODs.Find(ChunkIndex);
-    if (LastLOD && *LastLOD == NewLOD)
+    // Only rebuild when the level actually changes
+    NewLOD = FMath::Clamp(NewLOD, 0, MaxChunkLOD);
+    if (Chunk.LOD == NewLOD)
     {
         return;
     }
     
-    LastKnownLODs.Add(ChunkIndex, NewLOD);
+    Chunk.LOD = NewLOD;
     
-    // Update chunk with new LOD
-    GenerateChunkMesh(Chunk.ChunkX, Chunk.ChunkY);
+    // Rebuild at the new LOD through the normal update path (batched off the game thread in async mode)
+    if (bUseAsyncChunkMeshBuilds)
+    {
+        ChunkUpdateScheduler.Push(ChunkIndex);
+    }
+    else
+    {
+        GenerateChunkMesh(Chunk.ChunkX, Chunk.ChunkY);
+    }
     
     UE_LOG(LogTemp, VeryVerbose, TEXT("Updated chunk %d LOD to %d"), ChunkIndex, NewLOD);
 }
@@ -3331,10 +3860,11 @@ void ADynamicTerrain::SetComputeMode(ETerrainComputeMode NewMode)
             TransferHeightmapFromGPU();
         }
         CurrentComputeMode = ETerrainComputeMode::CPU;
+        CPUErosionHardness.Reset();  // Resampled from the current geology on the next erosion step
         
         for (int32 i = 0; i < TerrainChunks.Num(); i++)
         {
-            PendingChunkUpdates.Add(i);
+            ChunkUpdateScheduler.Push(i);
         }
         UE_LOG(LogTemp, Warning, TEXT("Switched to CPU mode"));
     }
@@ -3430,6 +3960,18 @@ void ADynamicTerrain::CreateGPUResources()
     HardnessRenderTexture->bCanCreateUAV = true;  // Enable UAV
     HardnessRenderTexture->UpdateResourceImmediate();
     
+    // Per-tile height change flags for partial readback; created all set so the first sync reads everything
+    ErosionActivityTexture = NewObject<UTextureRenderTarget2D>(this);
+    ErosionActivityTexture->ClearColor = FLinearColor::White;
+    ErosionActivityTexture->InitCustomFormat(
+        FMath::DivideAndRoundUp(GPUTextureWidth, ErosionActivityTileSize),
+        FMath::DivideAndRoundUp(GPUTextureHeight, ErosionActivityTileSize),
+        PF_R32_FLOAT,
+        false
+    );
+    ErosionActivityTexture->bCanCreateUAV = true;
+    ErosionActivityTexture->UpdateResourceImmediate(true);
+    
     // Create normal render texture with UAV support
     NormalRenderTexture = NewObject<UTextureRenderTarget2D>(this);
     NormalRenderTexture->InitCustomFormat(
@@ -3450,6 +3992,8 @@ void ADynamicTerrain::CreateGPUResources()
 
 void ADynamicTerrain::ReleaseGPUResources()
 {
+    DiscardGPUHeightReadbacks();
+
     // Release double-buffered height textures
     if (HeightRenderTexture_A)
     {
@@ -3488,6 +4032,12 @@ void ADynamicTerrain::ReleaseGPUResources()
         HardnessRenderTexture = nullptr;
     }
 
+    if (ErosionActivityTexture)
+    {
+        ErosionActivityTexture->ReleaseResource();
+        ErosionActivityTexture = nullptr;
+    }
+
     if (NormalRenderTexture)
     {
         NormalRenderTexture->ReleaseResource();
@@ -3844,6 +4394,15 @@ void ADynamicTerrain::TransferHeightmapToGPU()
 
             UE_LOG(LogTemp, Warning, TEXT("TransferHeightmapToGPU: All buffers uploaded (A, B, WaterHeight)"));
         });
+
+    // Everything is on the GPU now, so partial uploads start from a clean slate
+    const int32 DirtyWidth = FMath::Min(TerrainWidth, GPUTextureWidth);
+    const int32 DirtyHeight = FMath::Min(TerrainHeight, GPUTextureHeight);
+    if (!GPUHeightDirtyRegions.Matches(DirtyWidth, DirtyHeight))
+    {
+        GPUHeightDirtyRegions.Initialize(DirtyWidth, DirtyHeight, ChunkSize);
+    }
+    GPUHeightDirtyRegions.Clear();
 }
 
 // Verification function to confirm GPU upload succeeded
@@ -3942,53 +4501,121 @@ void ADynamicTerrain::SyncCPUToGPU()
     if (!HeightRenderTexture || HeightMap.Num() == 0)
         return;
 
-    // CRITICAL: HeightRenderTexture uses PF_FloatRGBA which is 16-bit HALF floats (FFloat16Color)
-    // NOT 32-bit floats (FLinearColor)! Using wrong format causes data corruption.
-    TArray<FFloat16Color> GPUHeightData;
-    GPUHeightData.SetNum(GPUTextureWidth * GPUTextureHeight);
+    // Full resync: everything the partial path would send, in one go
+    MarkHeightsDirtyForGPU(FIntRect(0, 0, TerrainWidth - 1, TerrainHeight - 1));
+    UploadDirtyHeightsToGPU();
+}
+
+void ADynamicTerrain::MarkHeightsDirtyForGPU(const FIntRect& CellRect)
+{
+    const int32 Width = FMath::Min(TerrainWidth, GPUTextureWidth);
+    const int32 Height = FMath::Min(TerrainHeight, GPUTextureHeight);
+    if (!GPUHeightDirtyRegions.Matches(Width, Height))
+    {
+        // Starts fully dirty: nothing is known about what the texture holds yet
+        GPUHeightDirtyRegions.Initialize(Width, Height, ChunkSize);
+    }
+    GPUHeightDirtyRegions.MarkRect(CellRect);
+    StampHeightEditTiles(CellRect);
+}
 
-    // Initialize to zero height
-    for (int32 i = 0; i < GPUHeightData.Num(); i++)
+void ADynamicTerrain::StampHeightEditTiles(const FIntRect& CellRect)
+{
+    const int32 TilesX = FMath::DivideAndRoundUp(GPUTextureWidth, ErosionActivityTileSize);
+    const int32 TilesY = FMath::DivideAndRoundUp(GPUTextureHeight, ErosionActivityTileSize);
+    if (TilesX <= 0 || TilesY <= 0)
+    {
+        return;
+    }
+    if (HeightEditTileGenerations.Num() != TilesX * TilesY)
     {
-        GPUHeightData[i] = FFloat16Color(FLinearColor(0.0f, 0.0f, 0.0f, 1.0f));
+        HeightEditTileGenerations.Init(0, TilesX * TilesY);
     }
 
-    // Copy CPU heightmap to GPU buffer (height in R channel)
-    for (int32 Y = 0; Y < TerrainHeight; Y++)
+    const int32 MinTileX = FMath::Clamp(CellRect.Min.X / ErosionActivityTileSize, 0, TilesX - 1);
+    const int32 MinTileY = FMath::Clamp(CellRect.Min.Y / ErosionActivityTileSize, 0, TilesY - 1);
+    const int32 MaxTileX = FMath::Clamp(CellRect.Max.X / ErosionActivityTileSize, 0, TilesX - 1);
+    const int32 MaxTileY = FMath::Clamp(CellRect.Max.Y / ErosionActivityTileSize, 0, TilesY - 1);
+
+    HeightEditGeneration++;
+    for (int32 TileY = MinTileY; TileY <= MaxTileY; TileY++)
     {
-        for (int32 X = 0; X < TerrainWidth; X++)
+        for (int32 TileX = MinTileX; TileX <= MaxTileX; TileX++)
         {
-            int32 CPUIndex = Y * TerrainWidth + X;
-            int32 GPUIndex = Y * GPUTextureWidth + X;
+            HeightEditTileGenerations[TileY * TilesX + TileX] = HeightEditGeneration;
+        }
+    }
+}
 
-            if (CPUIndex < HeightMap.Num() && GPUIndex < GPUHeightData.Num())
+void ADynamicTerrain::UploadDirtyHeightsToGPU()
+{
+    if (!HeightRenderTexture || GPUHeightDirtyRegions.IsEmpty() || HeightMap.Num() < TerrainWidth * TerrainHeight)
+    {
+        return;
+    }
+
+    FTextureRenderTargetResource* HeightResource = HeightRenderTexture->GetRenderTargetResource();
+    if (!HeightResource)
+    {
+        return;
+    }
+
+    // CRITICAL: HeightRenderTexture uses PF_FloatRGBA which is 16-bit HALF floats (FFloat16Color)
+    // NOT 32-bit floats (FLinearColor)! Using wrong format causes data corruption.
+    // Regions are packed back to back, each with its own tight row pitch
+    const int64 NumBytes = GPUHeightDirtyRegions.GetNumDirtyTexels() * sizeof(FFloat16Color);
+    FGPUUploadStagingRing::FSlot* Slot = GPUHeightUploadRing.Acquire(NumBytes);
+    if (!Slot)
+    {
+        return;   // Every slot still in flight: regions stay dirty for the next tick
+    }
+    GPUHeightDirtyRegions.Consume(Slot->Regions);
+
+    FFloat16Color* Texel = reinterpret_cast<FFloat16Color*>(Slot->Data.GetData());
+    int64 NumTexels = 0;
+    for (const FUpdateTextureRegion2D& Region : Slot->Regions)
+    {
+        for (uint32 Row = 0; Row < Region.Height; Row++)
+        {
+            const float* Source = HeightMap.GetData() + (int64)(Region.SrcY + Row) * TerrainWidth + Region.SrcX;
+            for (uint32 Column = 0; Column < Region.Width; Column++)
             {
-                GPUHeightData[GPUIndex] = FFloat16Color(FLinearColor(HeightMap[CPUIndex], 0.0f, 0.0f, 1.0f));
+                // Height in R channel only (convert to half-float)
+                *Texel++ = FFloat16Color(FLinearColor(Source[Column], 0.0f, 0.0f, 1.0f));
             }
         }
+        NumTexels += int64(Region.Width) * Region.Height;
+
+        // Readbacks issued before this upload reaches the GPU must not overwrite these cells either
+        StampHeightEditTiles(FIntRect(Region.DestX, Region.DestY,
+                                      Region.DestX + Region.Width - 1, Region.DestY + Region.Height - 1));
     }
 
+    // The slot stays untouched until the ring's fence passes, so the render thread reads it in place
+    const FGPUUploadStagingRing::FSlot* UploadSlot = Slot;
     ENQUEUE_RENDER_COMMAND(UploadHeightToGPU)(
-        [this, GPUHeightData](FRHICommandListImmediate& RHICmdList)
+        [UploadSlot, HeightResource](FRHICommandListImmediate& RHICmdList)
         {
-            FTextureRHIRef TextureRHI = HeightRenderTexture->GetRenderTargetResource()->GetRenderTargetTexture();
+            FTextureRHIRef TextureRHI = HeightResource->GetRenderTargetTexture();
             if (!TextureRHI) return;
 
-            // Stride for RGBA half-float texture (4 half-floats = 8 bytes per pixel)
-            uint32 Stride = GPUTextureWidth * sizeof(FFloat16Color);
-            FUpdateTextureRegion2D Region(0, 0, 0, 0, GPUTextureWidth, GPUTextureHeight);
-
-            RHICmdList.UpdateTexture2D(
-                TextureRHI,
-                0,  // Mip level
-                Region,
-                Stride,
-                (const uint8*)GPUHeightData.GetData()
-            );
+            // Each region's texels start at Source, so the RHI must not apply SrcX/SrcY on top
+            const uint8* Source = UploadSlot->Data.GetData();
+            for (const FUpdateTextureRegion2D& Region : UploadSlot->Regions)
+            {
+                const uint32 Stride = Region.Width * sizeof(FFloat16Color);
+                FUpdateTextureRegion2D DestRegion = Region;
+                DestRegion.SrcX = 0;
+                DestRegion.SrcY = 0;
+                RHICmdList.UpdateTexture2D(TextureRHI, 0, DestRegion, Stride, Source);
+                Source += SIZE_T(Stride) * Region.Height;
+            }
         });
 
-    UE_LOG(LogTemp, Verbose, TEXT("SyncCPUToGPU: Uploaded %dx%d heightmap to GPU (FFloat16Color format)"),
-           TerrainWidth, TerrainHeight);
+    GPUHeightUploadRing.Submit(Slot);
+
+    UE_LOG(LogTemp, Verbose, TEXT("SyncCPUToGPU: Uploaded %lld of %dx%d heightmap texels in %d regions"),
+           NumTexels, TerrainWidth, TerrainHeight, Slot->Regions.Num());
 }
 
 
@@ -4126,6 +4753,7 @@ void ADynamicTerrain::TransferHeightmapFromGPU()
     {
         HeightMap[i] = ReadbackData[i].R.GetFloat();
     }
+    NotifyAllHeightsChanged();
 
     // Skip boundary validation when erosion is enabled - GPU handles heightmap uniformly
     if (!bEnableGPUErosion)
@@ -4174,260 +4802,662 @@ void ADynamicTerrain::SyncGPUToCPU()
         }
         return;
     }
-    
-    if (bPendingGPUReadback)
+
+    // Never wait for an older readback: with every slot still in flight, keep the data
+    // dirty and try again at the next sync
+    FHeightReadbackSlot& Slot = HeightReadbackSlots[NextHeightReadbackSlot];
+    if (Slot.State != EHeightReadbackState::Free)
     {
-        GPUReadbackFence.Wait();
-        bPendingGPUReadback = false;
+        NumSkippedHeightReadbacks++;
+        return;
+    }
+
+    FTextureRenderTargetResource* ActivityResource =
+        ErosionActivityTexture ? ErosionActivityTexture->GetRenderTargetResource() : nullptr;
+    if (!ActivityResource)
+    {
+        return;
     }
-    
-    bPendingGPUReadback = true;
 
-    // PERFORMANCE: Only backup CPU state when erosion is disabled (for validation)
-    // When erosion is enabled, we expect heights to change - no need for expensive copy
-    TArray<float> CPUBackup;
-    bool bNeedValidation = !bEnableGPUErosion;
-    if (bNeedValidation)
+    if (!Slot.Readback)
     {
-        CPUBackup = HeightMap;
+        Slot.MaskReadback = MakeUnique<FRHIGPUTextureReadback>(TEXT("TerrainActivityReadback"));
+        Slot.Readback = MakeUnique<FRHIGPUTextureReadback>(TEXT("TerrainHeightReadback"));
     }
+    Slot.TilesX = FMath::DivideAndRoundUp(GPUTextureWidth, ErosionActivityTileSize);
+    Slot.TilesY = FMath::DivideAndRoundUp(GPUTextureHeight, ErosionActivityTileSize);
+    Slot.Tiles.Reset();
+    Slot.MappedData = nullptr;
+    Slot.RowPitchInPixels = 0;
+    Slot.EditGeneration = HeightEditGeneration;
 
-    ENQUEUE_RENDER_COMMAND(ReadbackHeightFromGPU)(
-        [this, CPUBackup, bNeedValidation](FRHICommandListImmediate& RHICmdList)
+    // Step 1: the per-tile activity mask (a few KB) tells which tiles are worth reading
+    ENQUEUE_RENDER_COMMAND(ReadbackErosionActivity)(
+        [MaskReadback = Slot.MaskReadback.Get(), ActivityResource](FRHICommandListImmediate& RHICmdList)
         {
-            FTextureRHIRef TextureRHI = HeightRenderTexture->GetRenderTargetResource()->GetRenderTargetTexture();
+            FTextureRHIRef TextureRHI = ActivityResource->GetRenderTargetTexture();
             if (!TextureRHI) return;
-            
-            TArray<FFloat16Color> SurfaceData;
-            FIntRect Rect(0, 0, GPUTextureWidth, GPUTextureHeight);
-            
-            RHICmdList.ReadSurfaceFloatData(
-                TextureRHI,
-                Rect,
-                SurfaceData,
-                CubeFace_PosX,
-                0,
-                0
-            );
-            
-            AsyncTask(ENamedThreads::GameThread, [this, SurfaceData, CPUBackup, bNeedValidation]()
+
+            FRDGBuilder GraphBuilder(RHICmdList);
+            FRDGTextureRef ActivityRDG = GraphBuilder.RegisterExternalTexture(
+                CreateRenderTarget(TextureRHI, TEXT("ErosionActivityReadbackSource")));
+            AddEnqueueCopyPass(GraphBuilder, MaskReadback, ActivityRDG);
+            GraphBuilder.Execute();
+        });
+
+    // Synced to the RHI thread too, so the readback's own GPU fence exists before it is polled
+    Slot.Fence.BeginFence(true);
+    Slot.State = EHeightReadbackState::MaskCopying;
+    NextHeightReadbackSlot = (NextHeightReadbackSlot + 1) % NumHeightReadbackSlots;
+    bPendingGPUReadback = true;
+
+    // The mask captures everything computed so far; later dispatches mark the data dirty again
+    bGPUDataDirty = false;
+}
+
+void ADynamicTerrain::PollGPUHeightReadbacks(bool bWaitForAll)
+{
+    if (!bPendingGPUReadback)
+    {
+        return;
+    }
+
+    const double WaitDeadline = FPlatformTime::Seconds() + 2.0;
+
+    // True once Readback's copy has landed; in wait mode, blocks (bounded) until it does
+    auto IsCopyReady = [bWaitForAll, WaitDeadline](FHeightReadbackSlot& Slot, FRHIGPUTextureReadback* Readback)
+    {
+        if (bWaitForAll)
+        {
+            FlushRenderingCommands();
+            while (!Readback->IsReady() && FPlatformTime::Seconds() < WaitDeadline)
             {
-                // Validate that GPU data isn't completely flat
-                float MinHeight = FLT_MAX;
-                float MaxHeight = -FLT_MAX;
-                float AvgHeight = 0.0f;
-                int32 ValidCount = 0;
-                
-                for (int32 Y = 0; Y < FMath::Min(TerrainHeight, GPUTextureHeight); Y++)
+                FPlatformProcess::SleepNoStats(0.001f);
+            }
+        }
+        return Slot.Fence.IsFenceComplete() && Readback->IsReady();
+    };
+
+    // Staging textures are mapped on the render thread; the pointer stays valid until Unlock
+    auto EnqueueLock = [](FHeightReadbackSlot& Slot, FRHIGPUTextureReadback* Readback)
+    {
+        ENQUEUE_RENDER_COMMAND(LockHeightReadback)(
+            [SlotPtr = &Slot, Readback](FRHICommandListImmediate& RHICmdList)
+            {
+                int32 RowPitchInPixels = 0;
+                SlotPtr->MappedData = Readback->Lock(RowPitchInPixels);
+                SlotPtr->RowPitchInPixels = RowPitchInPixels;
+            });
+        Slot.Fence.BeginFence();
+    };
+
+    auto EnqueueUnlock = [](FHeightReadbackSlot& Slot, FRHIGPUTextureReadback* Readback)
+    {
+        Slot.MappedData = nullptr;
+        ENQUEUE_RENDER_COMMAND(UnlockHeightReadback)(
+            [Readback](FRHICommandListImmediate& RHICmdList)
+            {
+                Readback->Unlock();
+            });
+    };
+
+    // Slots are issued round-robin, so the oldest in-flight one follows the next free slot.
+    // Stop at the first one still waiting so results are always applied in issue order.
+    for (int32 Offset = 0; Offset < NumHeightReadbackSlots; Offset++)
+    {
+        FHeightReadbackSlot& Slot = HeightReadbackSlots[(NextHeightReadbackSlot + Offset) % NumHeightReadbackSlots];
+
+        if (Slot.State == EHeightReadbackState::MaskCopying || Slot.State == EHeightReadbackState::Copying)
+        {
+            const bool bMask = Slot.State == EHeightReadbackState::MaskCopying;
+            FRHIGPUTextureReadback* Readback = bMask ? Slot.MaskReadback.Get() : Slot.Readback.Get();
+            if (!IsCopyReady(Slot, Readback))
+            {
+                if (!bWaitForAll)
                 {
-                    for (int32 X = 0; X < FMath::Min(TerrainWidth, GPUTextureWidth); X++)
+                    break;
+                }
+
+                // GPU never finished the copy - drop it rather than hang the mode switch
+                UE_LOG(LogTemp, Warning, TEXT("GPU sync: height readback timed out, dropping it"));
+                Slot.State = EHeightReadbackState::Free;
+                continue;
+            }
+
+            EnqueueLock(Slot, Readback);
+            Slot.State = bMask ? EHeightReadbackState::MaskMapping : EHeightReadbackState::Mapping;
+        }
+
+        if (Slot.State == EHeightReadbackState::MaskMapping)
+        {
+            if (bWaitForAll)
+            {
+                Slot.Fence.Wait();
+            }
+            else if (!Slot.Fence.IsFenceComplete())
+            {
+                break;
+            }
+
+            if (const float* Mask = static_cast<const float*>(Slot.MappedData))
+            {
+                for (int32 TileY = 0; TileY < Slot.TilesY; TileY++)
+                {
+                    const float* MaskRow = Mask + (int64)TileY * Slot.RowPitchInPixels;
+                    for (int32 TileX = 0; TileX < Slot.TilesX; TileX++)
                     {
-                        int32 GPUIndex = Y * GPUTextureWidth + X;
-                        if (GPUIndex < SurfaceData.Num())
+                        if (MaskRow[TileX] != 0.0f)
                         {
-                            float Height = SurfaceData[GPUIndex].R.GetFloat();
-                            if (!FMath::IsNaN(Height) && FMath::IsFinite(Height))
-                            {
-                                MinHeight = FMath::Min(MinHeight, Height);
-                                MaxHeight = FMath::Max(MaxHeight, Height);
-                                AvgHeight += Height;
-                                ValidCount++;
-                            }
+                            Slot.Tiles.Add(FIntPoint(TileX, TileY));
                         }
                     }
                 }
-                
-                if (ValidCount > 0)
-                {
-                    AvgHeight /= ValidCount;
-                }
-                
-                // VALIDATION: Check if GPU data is corrupt
-                // CRITICAL: Skip ALL validation when erosion is enabled - we trust GPU erosion results
-                float HeightRange = MaxHeight - MinHeight;
-                bool bGPUDataSeemsFlat = false;
-                bool bGPUDataTooNoisy = false;
-
-                // Only check for flat/corrupt data when erosion is DISABLED
-                if (!bEnableGPUErosion)
+            }
+            EnqueueUnlock(Slot, Slot.MaskReadback.Get());
+
+            if (Slot.Tiles.Num() == 0)
+            {
+                // Nothing changed on the GPU since the last readback
+                Slot.Fence.BeginFence();
+                Slot.State = EHeightReadbackState::Unmapping;
+            }
+            else if (!EnqueueHeightTileReadback(Slot))
+            {
+                // GPU resources were released while the mask was in flight
+                Slot.Fence.BeginFence();
+                Slot.State = EHeightReadbackState::Unmapping;
+            }
+            else
+            {
+                // Step 2 is queued: flagged tiles packed, just the used atlas rows copied
+                Slot.Fence.BeginFence(true);
+                Slot.State = EHeightReadbackState::Copying;
+
+                if (bWaitForAll)
                 {
-                    bGPUDataSeemsFlat = (HeightRange < 1.0f && FMath::Abs(AvgHeight) < 1.0f);
+                    Offset--;   // Finish this slot's height step before moving on
+                    continue;
                 }
+                break;
+            }
+        }
 
-                // PERFORMANCE: Skip expensive deviation checks when erosion is enabled
-                // Erosion legitimately changes heights - no need to validate against old CPU state
-                if (bNeedValidation && CPUBackup.Num() > 0)
-                {
-                    float MaxDeviation = 0.0f;
-                    float TotalDeviation = 0.0f;
-                    int32 DeviationSamples = 0;
-
-                    // Calculate CPU backup stats (reduced sample count for performance)
-                    float CPUMin = TNumericLimits<float>::Max();
-                    float CPUMax = TNumericLimits<float>::Lowest();
-                    int32 SampleStep = FMath::Max(1, CPUBackup.Num() / 200); // Sample ~200 pixels instead of 1000
-                    for (int32 i = 0; i < CPUBackup.Num(); i += SampleStep)
-                    {
-                        CPUMin = FMath::Min(CPUMin, CPUBackup[i]);
-                        CPUMax = FMath::Max(CPUMax, CPUBackup[i]);
-                    }
-                    float CPURange = CPUMax - CPUMin;
+        if (Slot.State == EHeightReadbackState::Mapping)
+        {
+            if (bWaitForAll)
+            {
+                Slot.Fence.Wait();
+            }
+            else if (!Slot.Fence.IsFenceComplete())
+            {
+                break;
+            }
 
-                    // Sample GPU vs CPU deviation (reduced samples)
-                    for (int32 i = 0; i < SurfaceData.Num(); i += SampleStep)
-                    {
-                        int32 Y = i / GPUTextureWidth;
-                        int32 X = i % GPUTextureWidth;
-                        int32 CPUIndex = Y * TerrainWidth + X;
+            if (Slot.MappedData)
+            {
+                ApplyGPUHeightReadback(Slot);
+            }
+            EnqueueUnlock(Slot, Slot.Readback.Get());
+            Slot.Fence.BeginFence();
+            Slot.State = EHeightReadbackState::Unmapping;
+        }
 
-                        if (CPUIndex < CPUBackup.Num())
-                        {
-                            float GPUHeight = SurfaceData[i].R.GetFloat();
-                            float CPUHeight = CPUBackup[CPUIndex];
+        if (Slot.State == EHeightReadbackState::Unmapping && bWaitForAll)
+        {
+            Slot.Fence.Wait();
+        }
+        if (Slot.State == EHeightReadbackState::Unmapping && Slot.Fence.IsFenceComplete())
+        {
+            Slot.State = EHeightReadbackState::Free;
+        }
+    }
 
-                            if (!FMath::IsNaN(GPUHeight) && FMath::IsFinite(GPUHeight))
-                            {
-                                float Deviation = FMath::Abs(GPUHeight - CPUHeight);
-                                MaxDeviation = FMath::Max(MaxDeviation, Deviation);
-                                TotalDeviation += Deviation;
-                                DeviationSamples++;
-                            }
-                        }
-                    }
+    bPendingGPUReadback = false;
+    for (const FHeightReadbackSlot& Slot : HeightReadbackSlots)
+    {
+        bPendingGPUReadback |= Slot.State != EHeightReadbackState::Free;
+    }
+}
 
-                    float AvgDeviation = DeviationSamples > 0 ? TotalDeviation / DeviationSamples : 0.0f;
-                    float AllowedDeviation = FMath::Max(CPURange * 0.1f, 100.0f);
-                    bGPUDataTooNoisy = (MaxDeviation > AllowedDeviation * 10.0f) || (AvgDeviation > AllowedDeviation);
-                }
+bool ADynamicTerrain::EnqueueHeightTileReadback(FHeightReadbackSlot& Slot)
+{
+    FTextureRenderTargetResource* HeightResource =
+        HeightRenderTexture ? HeightRenderTexture->GetRenderTargetResource() : nullptr;
+    FTextureRenderTargetResource* ActivityResource =
+        ErosionActivityTexture ? ErosionActivityTexture->GetRenderTargetResource() : nullptr;
+    if (!HeightResource || !ActivityResource)
+    {
+        return false;
+    }
 
-                // DEBUG: Log only on actual problems (reduced frequency for performance)
-                static int32 DiagnosticLogCount = 0;
-                if (DiagnosticLogCount < 3 && bGPUDataSeemsFlat)
-                {
-                    DiagnosticLogCount++;
-                    UE_LOG(LogTemp, Warning, TEXT("GPU SYNC: Data appears flat (range: %.2f, avg: %.2f)"),
-                           HeightRange, AvgHeight);
-                }
+    TArray<FUintVector2> PackTiles;
+    PackTiles.Reserve(Slot.Tiles.Num());
+    for (const FIntPoint& Tile : Slot.Tiles)
+    {
+        PackTiles.Add(FUintVector2(Tile.X, Tile.Y));
+    }
 
-                // Log sync status only first few times
-                static int32 SyncLogCount = 0;
-                if (SyncLogCount++ < 3)
-                {
-                    UE_LOG(LogTemp, Log, TEXT("GPU SYNC [%d]: Range=%.1f, Avg=%.1f"),
-                           SyncLogCount, HeightRange, AvgHeight);
-                }
+    // The atlas is TilesX tiles wide, so it always fits every tile; its size never changes, which
+    // keeps the readback's staging texture (sized from the first copy's source) reusable
+    const int32 AtlasTilesX = Slot.TilesX;
+    const FIntPoint AtlasSize(Slot.TilesX * ErosionActivityTileSize, Slot.TilesY * ErosionActivityTileSize);
+    const int32 UsedAtlasRows = FMath::DivideAndRoundUp(Slot.Tiles.Num(), AtlasTilesX) * ErosionActivityTileSize;
+    const FIntPoint SourceSize(GPUTextureWidth, GPUTextureHeight);
 
-                if (bGPUDataSeemsFlat && CPUBackup.Num() > 0)
-                {
-                    UE_LOG(LogTemp, Warning, TEXT("GPU sync: RESTORING from CPU backup (flat data)"));
-                    HeightMap = CPUBackup;
-                    TransferHeightmapToGPU();
-                }
-                else if (bGPUDataSeemsFlat)
-                {
-                    // No backup available - this is a problem! GPU data is flat but we can't restore
-                    UE_LOG(LogTemp, Error, TEXT("GPU sync: FLAT DATA with no backup! Water/erosion may be broken."));
-                }
-                // NOTE: Removed "too noisy" rejection - delta-based sync handles this properly
-                // The old rejection caused a loop: reject -> overwrite GPU -> erosion runs -> reject again
-                else
-                {
-                    // GPU data looks valid - apply EROSION DELTA only, don't overwrite user edits
-                    //
-                    // CRITICAL FIX: Only apply erosion where GPU height is LOWER than CPU height
-                    // This ensures user edits (raises) are NEVER undone by sync
-                    //
-                    // The rule is simple: erosion can only LOWER terrain, never raise it
-                    // If GPU is higher than CPU, that's fine (deposition or user edit made it to GPU)
-                    // If GPU is lower than CPU, apply the difference as erosion
-
-                    int32 ErosionPixelsApplied = 0;
-                    int32 PixelsSkipped = 0;
-
-                    for (int32 Y = 0; Y < FMath::Min(TerrainHeight, GPUTextureHeight); Y++)
-                    {
-                        for (int32 X = 0; X < FMath::Min(TerrainWidth, GPUTextureWidth); X++)
-                        {
-                            int32 GPUIndex = Y * GPUTextureWidth + X;
-                            int32 CPUIndex = Y * TerrainWidth + X;
+    ENQUEUE_RENDER_COMMAND(ReadbackHeightTiles)(
+        [Readback = Slot.Readback.Get(), HeightResource, ActivityResource, PackTiles = MoveTemp(PackTiles),
+         AtlasTilesX, AtlasSize, UsedAtlasRows, SourceSize](FRHICommandListImmediate& RHICmdList)
+        {
+            FTextureRHIRef HeightRHI = HeightResource->GetRenderTargetTexture();
+            FTextureRHIRef ActivityRHI = ActivityResource->GetRenderTargetTexture();
+            if (!HeightRHI || !ActivityRHI) return;
 
-                            if (GPUIndex < SurfaceData.Num() && CPUIndex < HeightMap.Num())
-                            {
-                                float GPUHeight = SurfaceData[GPUIndex].R.GetFloat();
-                                float CPUHeight = HeightMap[CPUIndex];  // Current CPU (has user edits)
+            TShaderMapRef<FHeightReadbackPackCS> PackShader(GetGlobalShaderMap(GMaxRHIFeatureLevel));
+            if (!PackShader.IsValid()) return;
 
-                                // Skip invalid GPU data
-                                if (FMath::IsNaN(GPUHeight) || !FMath::IsFinite(GPUHeight))
-                                {
-                                    continue;
-                                }
+            FRDGBuilder GraphBuilder(RHICmdList);
 
-                                GPUHeight = FMath::Clamp(GPUHeight, -10000.0f, 10000.0f);
+            FRDGTextureRef SourceRDG = GraphBuilder.RegisterExternalTexture(
+                CreateRenderTarget(HeightRHI, TEXT("HeightReadbackSource")));
+            FRDGTextureRef ActivityRDG = GraphBuilder.RegisterExternalTexture(
+                CreateRenderTarget(ActivityRHI, TEXT("ErosionActivityTexture")));
+
+            // Transient, so the pool hands the same R16F atlas back every sync
+            FRDGTextureRef AtlasRDG = GraphBuilder.CreateTexture(
+                FRDGTextureDesc::Create2D(AtlasSize, PF_R16F, FClearValueBinding::None,
+                                          TexCreate_ShaderResource | TexCreate_UAV),
+                TEXT("HeightReadbackAtlas"));
+
+            FHeightReadbackPackCS::FParameters* PassParameters =
+                GraphBuilder.AllocParameters<FHeightReadbackPackCS::FParameters>();
+            PassParameters->PackSourceTexture = GraphBuilder.CreateSRV(SourceRDG);
+            PassParameters->PackedHeightTexture = GraphBuilder.CreateUAV(AtlasRDG);
+            PassParameters->PackActivityTexture = GraphBuilder.CreateUAV(ActivityRDG);
+            PassParameters->PackTiles = GraphBuilder.CreateSRV(
+                CreateStructuredBuffer(GraphBuilder, TEXT("HeightReadbackTiles"), PackTiles));
+            PassParameters->PackSize = SourceSize;
+            PassParameters->PackTileSize = ErosionActivityTileSize;
+            PassParameters->PackAtlasTilesX = AtlasTilesX;
 
-                                // SIMPLE RULE: Only apply if GPU is LOWER than CPU
-                                // This means erosion happened and we should update CPU
-                                // If GPU >= CPU, either no erosion or user raised terrain - keep CPU value
-                                const float ErosionThreshold = 0.1f;
+            FComputeShaderUtils::AddPass(
+                GraphBuilder,
+                RDG_EVENT_NAME("HeightReadbackPack"),
+                PackShader,
+                PassParameters,
+                FIntVector(ErosionActivityTileSize / 8, ErosionActivityTileSize / 8, PackTiles.Num())
+            );
 
-                                if (GPUHeight < CPUHeight - ErosionThreshold)
-                                {
-                                    // GPU is lower = erosion happened, apply it
-                                    HeightMap[CPUIndex] = GPUHeight;
-                                    ErosionPixelsApplied++;
-                                }
-                                else
-                                {
-                                    // GPU >= CPU, keep CPU value (preserves user raises)
-                                    PixelsSkipped++;
-                                }
-                            }
-                        }
-                    }
+            AddEnqueueCopyPass(GraphBuilder, Readback, AtlasRDG, FResolveRect(0, 0, AtlasSize.X, UsedAtlasRows));
+            GraphBuilder.Execute();
+        });
 
-                    static int32 DeltaSyncLogCount = 0;
-                    if (DeltaSyncLogCount++ < 2)
-                    {
-                        UE_LOG(LogTemp, Log, TEXT("Erosion sync: %d pixels updated"), ErosionPixelsApplied);
-                    }
+    return true;
+}
 
-                    // Sync complete - diagnostic logging removed for performance
-                }
+void ADynamicTerrain::DiscardGPUHeightReadbacks()
+{
+    if (bPendingGPUReadback)
+    {
+        FlushRenderingCommands();
+    }
 
-                // GPU RENDERING MODE: Skip mesh regeneration entirely!
-                // The material samples HeightRenderTexture directly via WPO
-                // Heights are already updated in the GPU texture, no CPU mesh work needed
-                if (bUseGPUHeightmapRendering && bGPUInitialized)
+    for (FHeightReadbackSlot& Slot : HeightReadbackSlots)
+    {
+        if (!Slot.Readback)
+        {
+            continue;
+        }
+
+        // Readbacks are released on the render thread, after any unlock they still need
+        FRHIGPUTextureReadback* MaskReadback = Slot.MaskReadback.Release();
+        FRHIGPUTextureReadback* Readback = Slot.Readback.Release();
+        const bool bMaskLocked = Slot.State == EHeightReadbackState::MaskMapping && Slot.MappedData;
+        const bool bHeightsLocked = Slot.State == EHeightReadbackState::Mapping && Slot.MappedData;
+        ENQUEUE_RENDER_COMMAND(ReleaseHeightReadback)(
+            [MaskReadback, Readback, bMaskLocked, bHeightsLocked](FRHICommandListImmediate& RHICmdList)
+            {
+                if (bMaskLocked)
                 {
-                    // No mesh regeneration needed - material WPO handles heights
+                    MaskReadback->Unlock();
                 }
-                else if (!bEnableGPUErosion)
+                if (bHeightsLocked)
                 {
-                    ValidateAndRepairChunkBoundaries();
-
-                    // Gradual chunk updates when erosion is OFF
-                    for (int32 i = 0; i < TerrainChunks.Num(); i++)
-                    {
-                        PendingChunkUpdates.Add(i);
-                    }
+                    Readback->Unlock();
                 }
-                else
+                delete MaskReadback;
+                delete Readback;
+            });
+
+        Slot.State = EHeightReadbackState::Free;
+        Slot.MappedData = nullptr;
+        Slot.Tiles.Reset();
+    }
+
+    NextHeightReadbackSlot = 0;
+    bPendingGPUReadback = false;
+}
+
+namespace
+{
+    // Per-tile partial results of a height readback pass, reduced on the game thread
+    struct FHeightReadbackTileResult
+    {
+        float MinHeight = FLT_MAX;
+        float MaxHeight = -FLT_MAX;
+        double HeightSum = 0.0;
+        int32 ValidCount = 0;
+        FIntRect ErodedRect = FIntRect(MAX_int32, MAX_int32, MIN_int32, MIN_int32);
+        int32 ErodedCount = 0;
+        bool bEditedSinceIssue = false;
+    };
+}
+
+void ADynamicTerrain::ApplyGPUHeightReadback(const FHeightReadbackSlot& Slot)
+{
+    const FFloat16* Data = static_cast<const FFloat16*>(Slot.MappedData);
+    const int32 Width = FMath::Min(TerrainWidth, GPUTextureWidth);
+    const int32 Height = FMath::Min(TerrainHeight, GPUTextureHeight);
+    const int32 NumTiles = Slot.Tiles.Num();
+    if (!Data || Width <= 0 || Height <= 0 || HeightMap.Num() < TerrainWidth * Height)
+    {
+        return;
+    }
+
+    // Tile i sits at atlas column i % TilesX, row i / TilesX; calls Visit(X, Y, AtlasTexel) for its texels inside the terrain
+    auto ForEachTileTexel = [&](int32 TileIndex, auto&& Visit)
+    {
+        const FIntPoint Tile = Slot.Tiles[TileIndex];
+        const int32 AtlasX = (TileIndex % Slot.TilesX) * ErosionActivityTileSize;
+        const int32 AtlasY = (TileIndex / Slot.TilesX) * ErosionActivityTileSize;
+        const int32 StartX = Tile.X * ErosionActivityTileSize;
+        const int32 StartY = Tile.Y * ErosionActivityTileSize;
+        const int32 EndX = FMath::Min(StartX + ErosionActivityTileSize, Width);
+        const int32 EndY = FMath::Min(StartY + ErosionActivityTileSize, Height);
+        for (int32 Y = StartY; Y < EndY; Y++)
+        {
+            const FFloat16* AtlasRow = Data + (int64)(AtlasY + Y - StartY) * Slot.RowPitchInPixels + AtlasX - StartX;
+            for (int32 X = StartX; X < EndX; X++)
+            {
+                Visit(X, Y, AtlasRow[X]);
+            }
+        }
+    };
+
+    TArray<FHeightReadbackTileResult> TileResults;
+    TileResults.SetNum(NumTiles);
+
+    // VALIDATION: Check if GPU data is corrupt
+    // CRITICAL: Skip ALL validation when erosion is enabled - we trust GPU erosion results
+    // Only meaningful for a readback of the whole map (the first one after GPU init is)
+    bool bGPUDataSeemsFlat = false;
+    if (!bEnableGPUErosion && NumTiles == Slot.TilesX * Slot.TilesY)
+    {
+        ParallelFor(NumTiles, [&](int32 TileIndex)
+        {
+            FHeightReadbackTileResult& Result = TileResults[TileIndex];
+            ForEachTileTexel(TileIndex, [&Result](int32 X, int32 Y, FFloat16 Texel)
+            {
+                const float GPUHeight = Texel.GetFloat();
+                if (!FMath::IsNaN(GPUHeight) && FMath::IsFinite(GPUHeight))
                 {
-                    // Fallback: Force immediate atomic update if GPU rendering is off but erosion is on
-                    TArray<int32> AllChunks;
-                    AllChunks.Reserve(TerrainChunks.Num());
-                    for (int32 i = 0; i < TerrainChunks.Num(); i++)
-                    {
-                        AllChunks.Add(i);
-                    }
-                    ForceUpdateChunkGroup(AllChunks);
+                    Result.MinHeight = FMath::Min(Result.MinHeight, GPUHeight);
+                    Result.MaxHeight = FMath::Max(Result.MaxHeight, GPUHeight);
+                    Result.HeightSum += GPUHeight;
+                    Result.ValidCount++;
                 }
-                
-                bPendingGPUReadback = false;
-                bGPUDataDirty = false;
             });
         });
-    
-    GPUReadbackFence.BeginFence();
+
+        float MinHeight = FLT_MAX;
+        float MaxHeight = -FLT_MAX;
+        double HeightSum = 0.0;
+        int32 ValidCount = 0;
+        for (const FHeightReadbackTileResult& Result : TileResults)
+        {
+            MinHeight = FMath::Min(MinHeight, Result.MinHeight);
+            MaxHeight = FMath::Max(MaxHeight, Result.MaxHeight);
+            HeightSum += Result.HeightSum;
+            ValidCount += Result.ValidCount;
+        }
+        const float AvgHeight = ValidCount > 0 ? (float)(HeightSum / ValidCount) : 0.0f;
+        const float HeightRange = MaxHeight - MinHeight;
+
+        bGPUDataSeemsFlat = (HeightRange < 1.0f && FMath::Abs(AvgHeight) < 1.0f);
+
+        // DEBUG: Log only on actual problems (reduced frequency for performance)
+        static int32 DiagnosticLogCount = 0;
+        if (DiagnosticLogCount < 3 && bGPUDataSeemsFlat)
+        {
+            DiagnosticLogCount++;
+            UE_LOG(LogTemp, Warning, TEXT("GPU SYNC: Data appears flat (range: %.2f, avg: %.2f)"),
+                   HeightRange, AvgHeight);
+        }
+
+        // Log sync status only first few times
+        static int32 SyncLogCount = 0;
+        if (SyncLogCount++ < 3)
+        {
+            UE_LOG(LogTemp, Log, TEXT("GPU SYNC [%d]: Range=%.1f, Avg=%.1f"),
+                   SyncLogCount, HeightRange, AvgHeight);
+        }
+    }
+
+    if (bGPUDataSeemsFlat)
+    {
+        // Nothing has been written to HeightMap yet, so the CPU copy is still the good one
+        // (including any edits made while the readback was in flight) - push it back up
+        UE_LOG(LogTemp, Warning, TEXT("GPU sync: RESTORING GPU heights from CPU (flat data)"));
+        TransferHeightmapToGPU();
+        return;
+    }
+
+    // NOTE: Removed "too noisy" rejection - delta-based sync handles this properly
+    // The old rejection caused a loop: reject -> overwrite GPU -> erosion runs -> reject again
+    //
+    // GPU data looks valid - apply EROSION DELTA only, don't overwrite user edits
+    //
+    // CRITICAL FIX: Only apply erosion where GPU height is LOWER than CPU height
+    // This ensures user edits (raises) are NEVER undone by sync
+    //
+    // The rule is simple: erosion can only LOWER terrain, never raise it
+    // If GPU is higher than CPU, that's fine (deposition or user edit made it to GPU)
+    // If GPU is lower than CPU, apply the difference as erosion
+    const float ErosionThreshold = 0.1f;
+
+    // Tiles are disjoint, so each one writes only its own HeightMap cells
+    ParallelFor(NumTiles, [&](int32 TileIndex)
+    {
+        FHeightReadbackTileResult& Result = TileResults[TileIndex];
+
+        // Edited or uploaded after the readback was issued: the GPU data predates the edit, so
+        // "GPU lower than CPU" would just undo it. The CPU copy wins and is re-sent below.
+        const FIntPoint Tile = Slot.Tiles[TileIndex];
+        const int32 EditTileIndex = Tile.Y * Slot.TilesX + Tile.X;
+        if (HeightEditTileGenerations.IsValidIndex(EditTileIndex) && HeightEditTileGenerations[EditTileIndex] > Slot.EditGeneration)
+        {
+            Result.bEditedSinceIssue = true;
+            return;
+        }
+
+        ForEachTileTexel(TileIndex, [this, &Result, ErosionThreshold](int32 X, int32 Y, FFloat16 Texel)
+        {
+            float GPUHeight = Texel.GetFloat();
+
+            // Skip invalid GPU data
+            if (FMath::IsNaN(GPUHeight) || !FMath::IsFinite(GPUHeight))
+            {
+                return;
+            }
+
+            GPUHeight = FMath::Clamp(GPUHeight, -10000.0f, 10000.0f);
+
+            // SIMPLE RULE: Only apply if GPU is LOWER than CPU (current CPU has user edits)
+            // If GPU >= CPU, either no erosion or user raised terrain - keep CPU value
+            float& CPUHeight = HeightMap[Y * TerrainWidth + X];
+            if (GPUHeight < CPUHeight - ErosionThreshold)
+            {
+                CPUHeight = GPUHeight;
+                Result.ErodedRect.Include(FIntPoint(X, Y));
+                Result.ErodedCount++;
+            }
+        });
+    });
+
+    int32 ErosionPixelsApplied = 0;
+    int32 NumEditedTiles = 0;
+    TSet<int32> ChunksToUpdate;
+    for (int32 TileIndex = 0; TileIndex < NumTiles; TileIndex++)
+    {
+        const FHeightReadbackTileResult& Result = TileResults[TileIndex];
+        if (Result.bEditedSinceIssue)
+        {
+            // Push the whole tile back so cells the edit did not touch drop the erosion the CPU skipped
+            const FIntPoint TileMin = Slot.Tiles[TileIndex] * ErosionActivityTileSize;
+            MarkHeightsDirtyForGPU(FIntRect(TileMin, TileMin + FIntPoint(ErosionActivityTileSize - 1)));
+            NumEditedTiles++;
+            continue;
+        }
+
+        if (Result.ErodedCount == 0)
+        {
+            continue;
+        }
+
+        ErosionPixelsApplied += Result.ErodedCount;
+        NotifyHeightRegionChanged(Result.ErodedRect);
+
+        // Grow by one cell: neighbouring normals read the eroded heights
+        FIntRect NormalRect(Result.ErodedRect.Min - FIntPoint(1), Result.ErodedRect.Max + FIntPoint(1));
+        CollectChunksInRect(NormalRect, ChunksToUpdate);
+    }
+
+    static int32 DeltaSyncLogCount = 0;
+    if (DeltaSyncLogCount++ < 2)
+    {
+        UE_LOG(LogTemp, Log, TEXT("Erosion sync: %d pixels updated from %d of %d tiles (%d skipped for newer edits)"),
+               ErosionPixelsApplied, NumTiles, Slot.TilesX * Slot.TilesY, NumEditedTiles);
+    }
+
+    // GPU RENDERING MODE: Skip mesh regeneration entirely!
+    // The material samples HeightRenderTexture directly via WPO
+    // Heights are already updated in the GPU texture, no CPU mesh work needed
+    if ((bUseGPUHeightmapRendering && bGPUInitialized) || ChunksToUpdate.Num() == 0)
+    {
+        // No mesh regeneration needed - material WPO handles heights
+    }
+    else if (!bEnableGPUErosion)
+    {
+        ValidateAndRepairChunkBoundaries();
+
+        // Gradual chunk updates when erosion is OFF
+        for (int32 ChunkIndex : ChunksToUpdate)
+        {
+            ChunkUpdateScheduler.Push(ChunkIndex);
+        }
+    }
+    else
+    {
+        // Fallback: Force immediate atomic update if GPU rendering is off but erosion is on
+        ForceUpdateChunkGroup(ChunksToUpdate.Array());
+    }
+}
+
+
+// ============================================================================
+// CPU EROSION
+// ============================================================================
+
+void ADynamicTerrain::ExecuteCPUErosion(float DeltaTime)
+{
+    // Step at the compute shader's rate with the accumulated time, so both modes erode alike
+    CPUErosionAccumulator += DeltaTime;
+    if (CPUErosionAccumulator < GPUUpdateInterval)
+    {
+        return;
+    }
+    const float StepDeltaTime = CPUErosionAccumulator;
+    CPUErosionAccumulator = 0.0f;
+
+    if (!WaterSystem || !WaterSystem->IsSystemReady())
+    {
+        return;
+    }
+
+    FWaterSimulationData& WaterData = WaterSystem->SimulationData;
+    const int32 NumCells = TerrainWidth * TerrainHeight;
+    if (HeightMap.Num() != NumCells || WaterData.TerrainWidth != TerrainWidth || WaterData.TerrainHeight != TerrainHeight ||
+        WaterData.WaterDepthMap.Num() != NumCells || WaterData.SedimentMap.Num() != NumCells)
+    {
+        return;
+    }
+
+    if (CPUErosionHardness.Num() != NumCells)
+    {
+        RefreshCPUErosionHardness();
+    }
+
+    FTerrainErosionInputs Inputs;
+    Inputs.WaterDepth = WaterData.WaterDepthMap.GetData();
+    Inputs.VelocityX = WaterData.WaterVelocityX.GetData();
+    Inputs.VelocityY = WaterData.WaterVelocityY.GetData();
+    Inputs.Hardness = CPUErosionHardness.Num() == NumCells ? CPUErosionHardness.GetData() : nullptr;
+
+    // Same values ExecuteTerrainComputeShader binds as TerrainParams.z / ErosionParams
+    FTerrainErosionParams Params;
+    Params.TerrainScale = TerrainScale;
+    Params.ErosionRate = GPUErosionRate;
+    Params.DepositionRate = GPUDepositionRate;
+    Params.HardnessMultiplier = 1.0f;
+    Params.DeltaTime = StepDeltaTime;
+    Params.SedimentPerErodedHeight = CPUErosionSedimentPerHeight;
+
+    CPUErosionKernel.bVectorized = bUseVectorizedCPUErosion;
+
+    FIntRect ChangedRect;
+    const int32 NumChanged = CPUErosionKernel.Execute(HeightMap.GetData(), TerrainWidth, TerrainHeight, Inputs, Params,
+                                                      WaterData.SedimentMap.GetData(), &ChangedRect);
+    if (NumChanged == 0)
+    {
+        return;
+    }
+
+    NotifyHeightRegionChanged(ChangedRect);
+
+    // Grow by one cell: neighbouring normals read the eroded heights
+    TSet<int32> ChunksToUpdate;
+    CollectChunksInRect(FIntRect(ChangedRect.Min - FIntPoint(1), ChangedRect.Max + FIntPoint(1)), ChunksToUpdate);
+    for (int32 ChunkIndex : ChunksToUpdate)
+    {
+        ChunkUpdateScheduler.Push(ChunkIndex);
+    }
+}
+
+void ADynamicTerrain::RefreshCPUErosionHardness()
+{
+    // Nearest geology cell, the same resampling SyncHardnessToGPU uploads
+    AGeologyController* GeologyCtrl = CachedMasterController ? CachedMasterController->GetGeologyController() : nullptr;
+    if (!GeologyCtrl || GeologyCtrl->GeologyGridWidth <= 0 || GeologyCtrl->GeologyGridHeight <= 0 ||
+        GeologyCtrl->GeologyGrid.Num() < GeologyCtrl->GeologyGridWidth * GeologyCtrl->GeologyGridHeight)
+    {
+        CPUErosionHardness.Reset();
+        return;
+    }
+
+    const int32 GeoWidth = GeologyCtrl->GeologyGridWidth;
+    const int32 GeoHeight = GeologyCtrl->GeologyGridHeight;
+    CPUErosionHardness.SetNumUninitialized(TerrainWidth * TerrainHeight);
+
+    ParallelFor(TerrainHeight, [&](int32 Y)
+    {
+        const int32 GeoY = FMath::Clamp((int32)((int64)Y * GeoHeight / TerrainHeight), 0, GeoHeight - 1);
+        const FSimplifiedGeology* GeoRow = GeologyCtrl->GeologyGrid.GetData() + GeoY * GeoWidth;
+        float* HardnessRow = CPUErosionHardness.GetData() + (int64)Y * TerrainWidth;
+        for (int32 X = 0; X < TerrainWidth; X++)
+        {
+            const int32 GeoX = FMath::Clamp((int32)((int64)X * GeoWidth / TerrainWidth), 0, GeoWidth - 1);
+            HardnessRow[X] = GeoRow[GeoX].Hardness;
+        }
+    });
 }
 
 
@@ -4455,6 +5485,7 @@ void ADynamicTerrain::SyncGPUHeightsForWater()
             {
                 // Fast copy - no validation, no mesh updates
                 // Just update heights so water can read them
+                FIntRect ChangedRect(MAX_int32, MAX_int32, MIN_int32, MIN_int32);
                 for (int32 Y = 0; Y < FMath::Min(TerrainHeight, GPUTextureHeight); Y++)
                 {
                     for (int32 X = 0; X < FMath::Min(TerrainWidth, GPUTextureWidth); X++)
@@ -4467,11 +5498,21 @@ void ADynamicTerrain::SyncGPUHeightsForWater()
                             float GPUHeight = SurfaceData[GPUIndex].R.GetFloat();
                             if (!FMath::IsNaN(GPUHeight) && FMath::IsFinite(GPUHeight))
                             {
-                                HeightMap[CPUIndex] = FMath::Clamp(GPUHeight, -10000.0f, 10000.0f);
+                                const float NewHeight = FMath::Clamp(GPUHeight, -10000.0f, 10000.0f);
+                                if (NewHeight != HeightMap[CPUIndex])
+                                {
+                                    HeightMap[CPUIndex] = NewHeight;
+                                    ChangedRect.Include(FIntPoint(X, Y));
+                                }
                             }
                         }
                     }
                 }
+                
+                if (ChangedRect.Min.X <= ChangedRect.Max.X)
+                {
+                    NotifyHeightRegionChanged(ChangedRect);
+                }
             });
         });
 }
@@ -4494,12 +5535,13 @@ void ADynamicTerrain::ExecuteTerrainComputeShader(float DeltaTime)
     }
 
     // Double buffer validation
-    if (!HeightRenderTexture_A || !HeightRenderTexture_B || !ErosionRenderTexture)
+    if (!HeightRenderTexture_A || !HeightRenderTexture_B || !ErosionRenderTexture || !ErosionActivityTexture)
     {
-        UE_LOG(LogTemp, Error, TEXT("GPU textures not initialized: HeightA=%s, HeightB=%s, Erosion=%s"),
+        UE_LOG(LogTemp, Error, TEXT("GPU textures not initialized: HeightA=%s, HeightB=%s, Erosion=%s, Activity=%s"),
                HeightRenderTexture_A ? TEXT("Valid") : TEXT("Null"),
                HeightRenderTexture_B ? TEXT("Valid") : TEXT("Null"),
-               ErosionRenderTexture ? TEXT("Valid") : TEXT("Null"));
+               ErosionRenderTexture ? TEXT("Valid") : TEXT("Null"),
+               ErosionActivityTexture ? TEXT("Valid") : TEXT("Null"));
         return;
     }
 
@@ -4581,6 +5623,12 @@ void ADynamicTerrain::ExecuteTerrainComputeShader(float DeltaTime)
                 ErosionResource->GetRenderTargetTexture(), TEXT("ErosionTexture"));
             FRDGTextureRef ErosionTextureRDG = GraphBuilder.RegisterExternalTexture(PooledErosionTexture);
             
+            // ===== REGISTER ACTIVITY TEXTURE (OUTPUT) =====
+            FTextureRenderTargetResource* ActivityResource = ErosionActivityTexture->GetRenderTargetResource();
+            TRefCountPtr<IPooledRenderTarget> PooledActivityTexture = CreateRenderTarget(
+                ActivityResource->GetRenderTargetTexture(), TEXT("ErosionActivityTexture"));
+            FRDGTextureRef ActivityTextureRDG = GraphBuilder.RegisterExternalTexture(PooledActivityTexture);
+            
             // Allocate shader parameters
             FTerrainComputeCS::FParameters* PassParameters =
                 GraphBuilder.AllocParameters<FTerrainComputeCS::FParameters>();
@@ -4706,6 +5754,8 @@ void ADynamicTerrain::ExecuteTerrainComputeShader(float DeltaTime)
             PassParameters->WindFieldTexture = GraphBuilder.CreateSRV(WindFieldRDG);
             PassParameters->HardnessTexture = GraphBuilder.CreateSRV(DummyTexture);
             PassParameters->ErosionOutputTexture = GraphBuilder.CreateUAV(ErosionTextureRDG);
+            PassParameters->ErosionActivityTexture = GraphBuilder.CreateUAV(ActivityTextureRDG);
+            PassParameters->ActivityTileSize = ErosionActivityTileSize;
             
             PassParameters->TextureSampler = TStaticSamplerState<SF_Bilinear, AM_Clamp, AM_Clamp, AM_Clamp>::GetRHI();
             PassParameters->DeltaTime = ShaderDeltaTime;  // Use accumulated time for frame-rate independence
@@ -5410,7 +6460,7 @@ void ADynamicTerrain::ForceCPUMode()
     if (bGPUInitialized && CurrentComputeMode == ETerrainComputeMode::GPU)
     {
         SyncGPUToCPU();
-        FlushRenderingCommands();
+        PollGPUHeightReadbacks(true);
     }
 
     // Switch to CPU mode
@@ -5421,7 +6471,7 @@ void ADynamicTerrain::ForceCPUMode()
     // Queue all chunks for update
     for (int32 i = 0; i < TerrainChunks.Num(); i++)
     {
-        PendingChunkUpdates.Add(i);
+        ChunkUpdateScheduler.Push(i);
     }
 
     UE_LOG(LogTemp, Warning, TEXT("CPU Mode ACTIVE"));
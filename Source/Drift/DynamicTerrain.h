@@ -37,6 +37,12 @@
 #include "MasterController.h"
 #include "DriftGameInstance.h"
 #include "Shaders/TerrainComputeShader.h"
+#include "RHIGPUReadback.h"
+#include "Math/Float16.h"
+#include "GPUUploadStaging.h"
+#include "TerrainErosionKernel.h"
+#include "Tasks/Task.h"
+#include "ChunkUpdateScheduler.h"
 #include "DynamicTerrain.generated.h"
 
 // Forward declarations to reduce header dependencies
@@ -88,6 +94,15 @@ enum class ETerrainWorldSize : uint8
 };
 
 
+// Heightfield generator used for procedural map definitions
+UENUM(BlueprintType)
+enum class ETerrainNoiseGenerator : uint8
+{
+    Sinusoidal    UMETA(DisplayName = "Sinusoidal (Legacy)"),
+    FractalNoise  UMETA(DisplayName = "Fractal Noise (fBm + Ridged + Warp)")
+};
+
+
 UENUM(BlueprintType)
 enum class ETerrainComputeMode : uint8
 {
@@ -164,6 +179,10 @@ struct FTerrainChunk
     UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
     bool bIsVisible = true;
 
+    // Mesh detail level: LOD N keeps every (1 << N)th vertex (see FGridIndexBufferCache)
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+    int32 LOD = 0;
+
     FTerrainChunk()
     {
         MeshComponent = nullptr;
@@ -173,10 +192,75 @@ struct FTerrainChunk
         bIsActive = true;
         LastUpdateTime = 0.0f;
         bIsVisible = true;
+        LOD = 0;
     }
 };
 
 
+// Snapshot of everything a background task needs to build one chunk mesh.
+// Copied on the game thread so the task never reads the live HeightMap.
+struct FChunkMeshBuildInput
+{
+    int32 ChunkIndex = INDEX_NONE;
+    uint32 Generation = 0;
+    int32 StartX = 0;
+    int32 StartY = 0;
+    int32 ChunkWidth = 0;            // Vertices per row (full resolution)
+    int32 ChunkHeight = 0;           // Vertex rows (full resolution)
+    int32 LOD = 0;                   // Emit every (1 << LOD)th vertex
+    bool bSkirts = false;            // Append a skirt ring hiding cracks against other LODs
+    float MinSkirtDepth = 0.0f;
+    float TerrainScale = 100.0f;
+    float MaxTerrainHeight = 1.0f;
+    bool bFlatMesh = false;          // GPU heightmap rendering: material WPO supplies the height
+    bool bUpNormals = false;         // GPU heightmap rendering: material recomputes normals
+    TArray<float> Heights;           // (ChunkWidth + 2) x (ChunkHeight + 2), one-cell border for normals
+};
+
+// Finished vertex attributes for one chunk, ready for CreateMeshSection on the game thread
+// (the triangle list is shared per chunk size via FGridIndexBufferCache)
+struct FChunkMeshBuildResult
+{
+    int32 ChunkIndex = INDEX_NONE;
+    uint32 Generation = 0;
+    int32 StartX = 0;
+    int32 StartY = 0;
+    int32 ChunkWidth = 0;
+    int32 ChunkHeight = 0;
+    int32 LOD = 0;
+    bool bSkirts = false;
+    float SkirtDepth = 0.0f;
+    bool bHeightsBaked = false;      // Vertex Z/normals/colours come from the heightmap (CPU rendering)
+    TArray<FVector> Vertices;        // Reduced grid (row-major), then one skirt vertex per perimeter vertex
+    TArray<FVector> Normals;
+    TArray<FVector2D> UVs;
+    TArray<FLinearColor> VertexColors;
+};
+
+// How a chunk's applied mesh section was laid out, so dirty-rect updates can patch its
+// vertex buffer in place (the attributes themselves live only in the proc mesh section)
+struct FChunkMeshLayout
+{
+    uint32 Generation = 0;
+    int32 StartX = 0;
+    int32 StartY = 0;
+    int32 ChunkWidth = 0;
+    int32 ChunkHeight = 0;
+    int32 LOD = 0;
+    float SkirtDepth = 0.0f;
+    bool bSkirts = false;
+    bool bHeightsBaked = false;      // Section Z/normals/colours come from the heightmap (CPU rendering)
+};
+
+// Chunks dispatched together are applied together so neighbouring chunks never tear
+struct FChunkMeshBuildBatch
+{
+    TArray<FChunkMeshBuildInput> Inputs;
+    TArray<FChunkMeshBuildResult> Results;
+    UE::Tasks::FTask Task;
+};
+
+
 // ============================================================================
 // SECTION 3: ADYNAMICTERRAIN CLASS DECLARATION (~630 lines, 83%)
 // ============================================================================
@@ -212,6 +296,7 @@ public:
     
 protected:
     virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
     void ValidateChunkBoundary(int32 ChunkIndex);
   
     
@@ -281,6 +366,10 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Terrain Utilities")
     void SetHeightSafe(int32 X, int32 Y, float Height);
     
+    // Tell systems caching data derived from heights (atmosphere surface cache) which cells changed
+    void NotifyHeightRegionChanged(const FIntRect& CellRect);
+    void NotifyAllHeightsChanged();
+    
     // ===== CHUNK MANAGEMENT =====
     
     /**
@@ -445,6 +534,29 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Terrain Generation")
     bool bUseMapHeightMultiplier = false;
     
+    /**
+     * Generator for procedural maps (fractal noise is seed-deterministic and runs in parallel).
+     * Defaults to sinusoidal so existing seeds and saved maps keep their terrain; fractal is opt-in.
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Terrain Generation")
+    ETerrainNoiseGenerator ProceduralGenerator = ETerrainNoiseGenerator::Sinusoidal;
+    
+    /** Frequency multiplier between fractal octaves */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Terrain Generation", meta = (ClampMin = "1.5", ClampMax = "3.0"))
+    float NoiseLacunarity = 2.0f;
+    
+    /** Amplitude multiplier between fractal octaves */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Terrain Generation", meta = (ClampMin = "0.2", ClampMax = "0.8"))
+    float NoiseGain = 0.5f;
+    
+    /** Blend from rolling fBm (0) to ridged mountain ranges (1) */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Terrain Generation", meta = (ClampMin = "0.0", ClampMax = "1.0"))
+    float RidgeBlend = 0.35f;
+    
+    /** Domain warp displacement in base-octave cells (0 disables warping) */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Terrain Generation", meta = (ClampMin = "0.0", ClampMax = "2.0"))
+    float DomainWarpStrength = 0.35f;
+    
     // ===== RUNTIME PARAMETER UPDATES =====
 
     /**
@@ -471,6 +583,19 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Chunk System")
     int32 MaxUpdatesPerFrame = 2;  // Reduced for better performance
     
+    // Build chunk vertex/index buffers on background tasks; the game thread only uploads them
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Chunk System")
+    bool bUseAsyncChunkMeshBuilds = true;
+    
+    // Chunks dispatched per frame in async mode (results are applied the following frame)
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Chunk System", meta = (ClampMin = "1", ClampMax = "512"))
+    int32 MaxAsyncChunkBuildsPerFrame = 60;
+    
+    // Brush edits rewrite only the touched vertices of each chunk via UpdateMeshSection
+    // (keeps a CPU copy of every chunk's vertex attributes)
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Chunk System")
+    bool bUseIncrementalChunkUpdates = true;
+    
     
     // ===== PERFORMANCE SETTINGS =====
     
@@ -521,6 +646,11 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Performance")
     float LODDistanceMultiplier = 1.0f;
     
+    // Skirts hang at least this far below LOD chunk edges (world units); CPU-baked chunks add
+    // the height range of their edges, which bounds the crack against any neighbour LOD
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Performance", meta = (ClampMin = "0.0"))
+    float LODSkirtDepth = 200.0f;
+    
     UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Materials")
     UMaterialInterface* CurrentActiveMaterial = nullptr;
     
@@ -575,24 +705,24 @@ private:
     USceneComponent* TerrainRoot;
 
     
+    // SetHeightSafe without the per-cell notify: bulk writers call NotifyAllHeightsChanged() once afterwards
+    bool SetHeightUnnotified(int32 X, int32 Y, float Height);
+
     // ===== CHUNK MANAGEMENT =====
-    TSet<int32> PendingChunkUpdates;
     TSet<int32> PendingWaterChunkUpdates; // Separate queue for water-only updates
     
     // Priority-based chunk update system
-    struct FChunkUpdateRequest
-    {
-        int32 ChunkIndex;
-        float Priority;
-        float RequestTime;
-        
-        bool operator<(const FChunkUpdateRequest& Other) const
-        {
-            return Priority > Other.Priority; // Higher priority first
-        }
-    };
+    // Single deduplicated queue for every chunk rebuild request (priority heap, lock-free inbox for other threads)
+    FChunkUpdateScheduler ChunkUpdateScheduler;
+    static constexpr uint8 ChunkRequestWithNeighbors = 1;  // Inbox flag: RequestPriorityChunkUpdate() from another thread
     
-    TArray<FChunkUpdateRequest> PriorityChunkQueue;
+    // Async mesh builds in dispatch order, plus the newest requested build per chunk
+    // (results from an older generation are dropped instead of overwriting newer geometry)
+    TArray<TUniquePtr<FChunkMeshBuildBatch>> InFlightChunkMeshBuilds;
+    TArray<uint32> ChunkMeshGenerations;
+    
+    // Layout of the last applied mesh per chunk; dirty-rect updates patch the section's vertex buffer
+    TArray<FChunkMeshLayout> ChunkMeshLayouts;
     
     // ===== PERFORMANCE OPTIMIZATION =====
     
@@ -610,6 +740,21 @@ private:
     void InitializeChunks();
     void GenerateChunkMesh(int32 ChunkX, int32 ChunkY);
     void ProcessPendingChunkUpdates();
+    
+    // Chunk mesh build pipeline: snapshot (game thread) -> build (any thread) -> apply (game thread)
+    void GetChunkVertexRange(int32 ChunkX, int32 ChunkY, int32& OutStartX, int32& OutStartY, int32& OutEndX, int32& OutEndY) const;
+    void MakeChunkMeshBuildInput(int32 ChunkIndex, FChunkMeshBuildInput& OutInput) const;
+    static void BuildChunkMeshData(const FChunkMeshBuildInput& Input, FChunkMeshBuildResult& OutResult);
+    static float GetChunkEdgeHeightRange(const FChunkMeshBuildInput& Input);
+    void ApplyChunkMeshResult(const FChunkMeshBuildResult& Result);
+    void BindChunkGPUMaterialParams(FTerrainChunk& Chunk);
+    void DispatchChunkMeshBuilds(const TArray<int32>& ChunkIndices);
+    void ApplyCompletedChunkMeshBuilds();
+    void CancelChunkMeshBuilds();
+    
+    // Dirty-rect update: rewrites vertices inside HeightRect (heightmap cells, inclusive).
+    // Returns false when the chunk has no current cached mesh and needs a full rebuild.
+    bool UpdateChunkRegion(int32 ChunkIndex, const FIntRect& HeightRect);
     void ProcessPendingWaterChunkUpdates(); // Add missing declaration
     void UpdatePerformanceStats(float DeltaTime);
     
@@ -619,7 +764,8 @@ private:
     // Helper functions
     FVector2D GetChunkWorldPosition(int32 ChunkX, int32 ChunkY) const;
     FVector CalculateVertexNormal(int32 X, int32 Y) const;
-    FLinearColor GetHeightBasedColor(float NormalizedHeight) const;
+    static FVector ComputeGridNormal(float HeightL, float HeightR, float HeightD, float HeightU, float GridSpacing);
+    static FLinearColor GetHeightBasedColor(float NormalizedHeight);
     
     // Frustum culling functions
     void UpdateFrustumCulling(float DeltaTime);
@@ -662,6 +808,9 @@ private:
     /** Return mesh component to pool */
     void ReturnMeshComponentToPool(UProceduralMeshComponent* MeshComponent);
     
+    /** Coarsest chunk LOD (stride 8) */
+    static constexpr int32 MaxChunkLOD = 3;
+    
     /** Advanced LOD calculation based on distance and importance */
     int32 CalculateChunkLOD(int32 ChunkIndex, FVector CameraLocation) const;
     
@@ -805,6 +954,16 @@ public:
                   meta = (ClampMin = "0.0", ClampMax = "1.0"))
         float GPUDepositionRate = 0.05f;
         
+        // CPU compute mode runs the same erosion math on HeightMap when bEnableGPUErosion is set,
+        // using the rates above, so GPU-less machines age worlds the way the shader does
+        UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GPU Terrain|Erosion")
+        bool bUseVectorizedCPUErosion = true;
+        
+        // Suspended sediment (SimulationData.SedimentMap) per cm of bed eroded by water on the CPU path
+        UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GPU Terrain|Erosion",
+                  meta = (ClampMin = "0.0", ClampMax = "1.0"))
+        float CPUErosionSedimentPerHeight = 0.01f;
+        
         UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GPU Terrain|Orographic",
                   meta = (ClampMin = "0.0", ClampMax = "10.0"))
         float OrographicLiftStrength = 2.0f;
@@ -886,9 +1045,77 @@ public:
         void VerifyGPUUpload();  // Verifies GPU texture matches CPU data
         
         // Readback management
-        FRenderCommandFence GPUReadbackFence;
-        TArray<float> GPUHeightReadbackBuffer;
+        // The erosion shader flags every ErosionActivityTileSize^2 tile whose heights it changed.
+        // SyncGPUToCPU() reads that small mask back first; once it arrives the flagged tiles are
+        // packed into an R16F atlas, their flags cleared and only the used atlas rows copied to
+        // staging. PollGPUHeightReadbacks() (every GPU tick) drives each slot through these
+        // steps and applies the tiles in place, oldest slot first. Nothing on the game thread
+        // waits for the GPU unless bWaitForAll is passed (mode switches).
+        static constexpr int32 ErosionActivityTileSize = 32;
+
+        UPROPERTY()
+        UTextureRenderTarget2D* ErosionActivityTexture = nullptr;  // One R32F texel per tile, nonzero = changed
+
+        enum class EHeightReadbackState : uint8
+        {
+            Free,
+            MaskCopying,    // Activity mask copy enqueued; waiting for the GPU
+            MaskMapping,    // Mask lock enqueued
+            Copying,        // Tile pack + copy enqueued; waiting for the GPU
+            Mapping,        // Height lock enqueued
+            Unmapping       // Unlock enqueued
+        };
+
+        struct FHeightReadbackSlot
+        {
+            TUniquePtr<FRHIGPUTextureReadback> MaskReadback;
+            TUniquePtr<FRHIGPUTextureReadback> Readback;
+            FRenderCommandFence Fence;              // Last render command issued for this slot
+            EHeightReadbackState State = EHeightReadbackState::Free;
+            const void* MappedData = nullptr;       // Written by the lock commands
+            int32 RowPitchInPixels = 0;
+            int32 TilesX = 0;                       // Activity tiles (also the atlas width in tiles)
+            int32 TilesY = 0;
+            TArray<FIntPoint> Tiles;                // Flagged tiles, in atlas order
+            uint32 EditGeneration = 0;              // HeightEditGeneration when the readback was issued
+        };
+
+        static constexpr int32 NumHeightReadbackSlots = 3;
+        FHeightReadbackSlot HeightReadbackSlots[NumHeightReadbackSlots];
+        int32 NextHeightReadbackSlot = 0;
+        int32 NumSkippedHeightReadbacks = 0;
         bool bPendingGPUReadback = false;
+
+        void PollGPUHeightReadbacks(bool bWaitForAll = false);
+        bool EnqueueHeightTileReadback(FHeightReadbackSlot& Slot);   // False if the GPU resources are gone
+        void ApplyGPUHeightReadback(const FHeightReadbackSlot& Slot);
+        void DiscardGPUHeightReadbacks();
+
+        // Partial upload: CPU edits mark cells, UploadDirtyHeightsToGPU() sends only those regions
+        FTextureDirtyRegions GPUHeightDirtyRegions;
+        FGPUUploadStagingRing GPUHeightUploadRing;
+
+        void MarkHeightsDirtyForGPU(const FIntRect& CellRect);
+
+        // A readback lands frames after it was issued, so it cannot contain CPU edits made (or
+        // uploaded) since. Each activity tile remembers the generation of its latest edit and
+        // upload; ApplyGPUHeightReadback() leaves tiles stamped after the slot's generation alone.
+        uint32 HeightEditGeneration = 0;
+        TArray<uint32> HeightEditTileGenerations;
+
+        void StampHeightEditTiles(const FIntRect& CellRect);
+        void UploadDirtyHeightsToGPU();
+
+        // Chunks whose vertex range overlaps the inclusive cell rect
+        void CollectChunksInRect(const FIntRect& CellRect, TSet<int32>& OutChunks) const;
+
+        // CPU erosion (ETerrainComputeMode::CPU): stepped at GPUUpdateInterval like the compute shader
+        FTerrainErosionKernel CPUErosionKernel;
+        TArray<float> CPUErosionHardness;   // Geology hardness resampled to the terrain grid
+        float CPUErosionAccumulator = 0.0f;
+
+        void ExecuteCPUErosion(float DeltaTime);
+        void RefreshCPUErosionHardness();
         
 
     public:
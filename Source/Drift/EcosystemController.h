@@ -11,7 +11,7 @@
  * ALPHA SPRINT SCOPE:
  * Basic grass growth system as proof-of-concept for ecosystem patterns:
  * - Water-dependent growth (queries WaterSystem through MasterController authority)
- * - Sparse update pattern (100 instances/frame for performance)
+ * - Batched parallel update of every instance per tick (legacy sparse pattern optional)
  * - GPU-native rendering (UE5 HISM automatic instancing)
  * - Atmospheric wind integration (connects to AtmosphericSystem)
  * - Spatial grid for density management (O(1) neighbor queries)
@@ -70,6 +70,7 @@
 #include "Components/InstancedStaticMeshComponent.h"
 #include "Components/HierarchicalInstancedStaticMeshComponent.h"
 #include "MasterController.h"
+#include "VegetationSpatialGrid.h"
 #include "EcosystemController.generated.h"
 
 class UWaterSystem;
@@ -219,10 +220,24 @@ struct FGrassInstance
     int32 MeshIndex = 0;
     
     // Index in HISM component (for update/removal)
+    // Always equals this instance's index in ActiveGrassInstances (kept in lockstep on swap-remove)
     UPROPERTY()
     int32 InstanceIndex = -1;
+    
+    // Spawn rotation, needed to rebuild the transform when the instance is relocated
+    UPROPERTY()
+    float Yaw = 0.0f;
+    
+    // Queued for the next batched removal (runtime only)
+    bool bPendingRemoval = false;
 };
 
+/**
+ * Stable reference to a grass instance (resolved by AEcosystemController).
+ * Survives swap-removal of other instances; goes stale once its own instance is removed.
+ */
+using FGrassHandle = FVegetationHandle;
+
 // ============================================================================
 // SECTION 2: MAIN ACTOR CLASS
 // ============================================================================
@@ -279,7 +294,13 @@ public:
     float GrassDeathRate = 0.05f; // Health loss per second without water
     
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Grass Growth", meta = (ClampMin = "1", ClampMax = "1000"))
-    int32 GrassUpdateBudget = 100; // Grass instances updated per frame
+    int32 GrassUpdateBudget = 100; // Grass instances updated per frame (sparse path; sets the batched path's step rate)
+    
+    // Update every grass instance each tick in one parallel pass with a single HISM upload
+    // (false = legacy sparse pattern, GrassUpdateBudget instances per frame). Each instance's
+    // step is scaled by GrassUpdateBudget / instance count so growth and death keep the sparse pace.
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Grass Growth")
+    bool bUseBatchedGrassUpdate = true;
     
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Grass Growth", meta = (ClampMin = "1", ClampMax = "100"))
     int32 MaxGrassPerCell = 20; // Max grass in 10m x 10m cell
@@ -381,6 +402,22 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Debug")
     void ShowGrassStats() const;
 
+    // ===== GRASS HANDLES =====
+    
+    /**
+     * Handles are the only grass references that survive FlushGrassRemovals(): dense
+     * indices move on every swap-remove, so hold handles across frames and resolve them
+     */
+    FGrassHandle GetGrassHandle(int32 GrassIndex) const;
+    int32 ResolveGrassHandle(const FGrassHandle& Handle) const;    // INDEX_NONE once removed
+    const FGrassInstance* FindGrassInstance(const FGrassHandle& Handle) const;
+    
+    // Handles of the grass within Radius of Location
+    void QueryGrassInRadius(const FVector& Location, float Radius, TArray<FGrassHandle>& OutGrass);
+    
+    // Queue removal by handle (no-op for stale handles); applied by the next FlushGrassRemovals()
+    void RemoveGrassInstance(const FGrassHandle& Handle);
+
     // ===== ISCALABLESYSTEM INTERFACE =====
     
     virtual void ConfigureFromMaster(const FWorldScalingConfig& Config) override;
@@ -439,14 +476,33 @@ private:
     TArray<FGrassInstance> ActiveGrassInstances;
     
     /**
-     * Spatial grid for O(1) density queries
-     * Key: Grid cell coordinate (x + y * GridWidth)
-     * Value: Indices into ActiveGrassInstances array
+     * Slot map over ActiveGrassInstances (dense array, swap-removed in O(1))
+     * Slots are the stable handle space; dense indices move when other grass dies
+     */
+    TArray<int32> GrassDenseToSlot;
+    TArray<int32> GrassSlotToDense;        // INDEX_NONE for free slots
+    TArray<uint32> GrassSlotGenerations;
+    TArray<int32> FreeGrassSlots;
+    
+    // Queued removals; applied to the store and HISM together by FlushGrassRemovals()
+    TArray<FGrassHandle> PendingGrassRemovals;
+    
+    // Water simulation cell under each grass instance (SoA, lockstep with ActiveGrassInstances)
+    TArray<int32> GrassWaterCells;
+    int32 GrassWaterCellsMapSize = 0;   // WaterDepthMap size the cells were resolved against
+    
+    // Batched growth scratch (reused every frame)
+    TArray<float> GrassWaterDepthScratch;
+    TArray<FTransform> GrassTransformScratch;
+    
+    /**
+     * Flat spatial grid over the terrain bounds
+     * Cell counts are always current (O(1) density checks); the packed layout holds grass
+     * handles and is rebuilt on demand before range queries
      *
-     * NOTE: Not a UPROPERTY - UE reflection doesn't support TMap<int32, TArray<int32>>
-     * This is runtime-only data that rebuilds on initialization
+     * NOTE: Not a UPROPERTY - runtime-only data that rebuilds on initialization
      */
-    TMap<int32, TArray<int32>> GrassSpatialGrid;
+    FVegetationSpatialGrid GrassSpatialGrid;
     
     /**
      * Current index for sparse updates
@@ -517,6 +573,22 @@ private:
      */
     void UpdateGrassGrowth(float DeltaTime);
     
+    /**
+     * Update all grass in parallel: sample water from the raw depth map, grow/decay,
+     * then one BatchUpdateInstancesTransforms for the grass HISM
+     */
+    void UpdateGrassGrowthBatched(float DeltaTime);
+    
+    /**
+     * Re-resolve GrassWaterCells if the water grid changed size since they were cached
+     */
+    void RefreshGrassWaterCells();
+    
+    /**
+     * Growth/health rule for one instance given its water depth (shared by both update paths)
+     */
+    void StepGrassGrowth(FGrassInstance& Grass, float WaterDepth, float DeltaTime) const;
+    
     /**
      * Spawn a single grass instance with validation
      * Checks water availability, terrain slope, density
@@ -525,10 +597,21 @@ private:
     void SpawnGrassInstance(FVector Location);
     
     /**
-     * Remove grass instance from rendering and tracking
+     * Queue grass instance for removal from rendering and tracking
+     * Deferred: the instance stays valid until FlushGrassRemovals()
      */
     void RemoveGrassInstance(int32 GrassIndex);
     
+    /**
+     * Apply all queued removals: O(1) swap-remove per instance in the store, then one
+     * HISM pass (patch relocated instances, drop the tail) and a single render-state update
+     */
+    void FlushGrassRemovals();
+    
+    // Slot map helpers
+    FGrassHandle AllocateGrassSlot(int32 DenseIndex);
+    FTransform MakeGrassTransform(const FGrassInstance& Grass) const;
+    
     /**
      * Check if grass can grow at location
      * Validates: water depth, terrain slope, density, biome
@@ -543,9 +626,20 @@ private:
     
     // ===== INTERNAL FUNCTIONS - SPATIAL GRID =====
     
+    /**
+     * Size the spatial grid to the terrain bounds and re-bin existing grass
+     */
+    void InitializeGrassSpatialGrid();
+    
+    /**
+     * Re-sort the grid's packed layout if grass was added/removed since the last range query
+     */
+    void EnsureGrassSpatialGridBuilt();
+    void RebuildGrassSpatialGrid();
+    
     /**
      * Convert world position to spatial grid cell
-     * Returns cell key for TMap lookup
+     * Returns flat cell index (INDEX_NONE before the grid is initialized)
      */
     int32 WorldToGridCell(FVector WorldLocation) const;
     
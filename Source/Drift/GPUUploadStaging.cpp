@@ -0,0 +1,224 @@
+// GPUUploadStaging.cpp - Persistent staging buffers and dirty-region tracking for simulation-to-GPU texture uploads
+#include "GPUUploadStaging.h"
+#include "Math/VectorRegister.h"
+
+// ============================================================================
+// DIRTY REGIONS
+// ============================================================================
+
+void FTextureDirtyRegions::Initialize(int32 InWidth, int32 InHeight, int32 InBandHeight)
+{
+    Width = FMath::Max(InWidth, 0);
+    Height = FMath::Max(InHeight, 0);
+    BandHeight = FMath::Max(InBandHeight, 1);
+    NumBands = Width > 0 ? FMath::DivideAndRoundUp(Height, BandHeight) : 0;
+    BandSpans.SetNumUninitialized(NumBands);
+    MarkAll();
+}
+
+void FTextureDirtyRegions::MarkRect(const FIntRect& Rect)
+{
+    const int32 MinX = FMath::Max(Rect.Min.X, 0);
+    const int32 MinY = FMath::Max(Rect.Min.Y, 0);
+    const int32 MaxX = FMath::Min(Rect.Max.X, Width - 1);
+    const int32 MaxY = FMath::Min(Rect.Max.Y, Height - 1);
+    if (MaxX < MinX || MaxY < MinY)
+    {
+        return;
+    }
+
+    for (int32 Band = MinY / BandHeight; Band <= MaxY / BandHeight; Band++)
+    {
+        FIntPoint& Span = BandSpans[Band];
+        if (Span.X > Span.Y)
+        {
+            Span = FIntPoint(MinX, MaxX);
+            NumDirtyBands++;
+        }
+        else
+        {
+            Span.X = FMath::Min(Span.X, MinX);
+            Span.Y = FMath::Max(Span.Y, MaxX);
+        }
+    }
+}
+
+void FTextureDirtyRegions::MarkAll()
+{
+    for (FIntPoint& Span : BandSpans)
+    {
+        Span = FIntPoint(0, Width - 1);
+    }
+    NumDirtyBands = NumBands;
+}
+
+void FTextureDirtyRegions::Clear()
+{
+    for (FIntPoint& Span : BandSpans)
+    {
+        Span = FIntPoint(1, 0);
+    }
+    NumDirtyBands = 0;
+}
+
+void FTextureDirtyRegions::Consume(TArray<FUpdateTextureRegion2D>& OutRegions)
+{
+    OutRegions.Reset();
+
+    for (int32 Band = 0; Band < NumBands; )
+    {
+        const FIntPoint Span = BandSpans[Band];
+        if (Span.X > Span.Y)
+        {
+            Band++;
+            continue;
+        }
+
+        // Merge following bands with the identical span into one taller region
+        int32 EndBand = Band + 1;
+        while (EndBand < NumBands && BandSpans[EndBand] == Span)
+        {
+            EndBand++;
+        }
+
+        const int32 Y = Band * BandHeight;
+        const int32 EndY = FMath::Min(EndBand * BandHeight, Height);
+        OutRegions.Add(FUpdateTextureRegion2D(Span.X, Y, Span.X, Y, Span.Y - Span.X + 1, EndY - Y));
+
+        for (int32 Clear = Band; Clear < EndBand; Clear++)
+        {
+            BandSpans[Clear] = FIntPoint(1, 0);
+        }
+        Band = EndBand;
+    }
+
+    NumDirtyBands = 0;
+}
+
+int64 FTextureDirtyRegions::GetNumDirtyTexels() const
+{
+    int64 Texels = 0;
+    for (int32 Band = 0; Band < NumBands; Band++)
+    {
+        const FIntPoint& Span = BandSpans[Band];
+        if (Span.X <= Span.Y)
+        {
+            const int32 Rows = FMath::Min((Band + 1) * BandHeight, Height) - Band * BandHeight;
+            Texels += int64(Span.Y - Span.X + 1) * Rows;
+        }
+    }
+    return Texels;
+}
+
+// ============================================================================
+// STAGING RING
+// ============================================================================
+
+FGPUUploadStagingRing::FSlot* FGPUUploadStagingRing::Acquire(int64 NumBytes)
+{
+    const int32 SlotIndex = NextSlot;
+    if (bInFlight[SlotIndex])
+    {
+        if (!Fences[SlotIndex].IsFenceComplete())
+        {
+            NumSkippedUploads++;
+            return nullptr;
+        }
+        bInFlight[SlotIndex] = false;
+    }
+
+    FSlot& Slot = Slots[SlotIndex];
+    if (Slot.Data.Num() < NumBytes)
+    {
+        // Only grows on the first upload or after a resize
+        Slot.Data.SetNumUninitialized(NumBytes);
+    }
+    Slot.Regions.Reset();
+    return &Slot;
+}
+
+void FGPUUploadStagingRing::Submit(FSlot* Slot)
+{
+    const int32 SlotIndex = static_cast<int32>(Slot - Slots);
+    check(SlotIndex == NextSlot);
+
+    Fences[SlotIndex].BeginFence();
+    bInFlight[SlotIndex] = true;
+    NextSlot = (NextSlot + 1) % NumSlots;
+}
+
+void FGPUUploadStagingRing::Flush()
+{
+    for (int32 SlotIndex = 0; SlotIndex < NumSlots; SlotIndex++)
+    {
+        if (bInFlight[SlotIndex])
+        {
+            Fences[SlotIndex].Wait();
+            bInFlight[SlotIndex] = false;
+        }
+    }
+}
+
+SIZE_T FGPUUploadStagingRing::GetAllocatedSize() const
+{
+    SIZE_T Size = 0;
+    for (const FSlot& Slot : Slots)
+    {
+        Size += Slot.Data.GetAllocatedSize() + Slot.Regions.GetAllocatedSize();
+    }
+    return Size;
+}
+
+// ============================================================================
+// CONVERSIONS
+// ============================================================================
+
+void FGPUUploadConvert::FloatPairToHalf2(const float* SrcX, const float* SrcY, FFloat16* Dst, int32 Num)
+{
+    static_assert(sizeof(FFloat16) == sizeof(uint16), "FFloat16 must be a bare uint16");
+    uint16* Out = reinterpret_cast<uint16*>(Dst);
+    MS_ALIGN(16) float Interleaved[8] GCC_ALIGN(16);
+
+    int32 i = 0;
+    for (; i + 4 <= Num; i += 4)
+    {
+        // (x0 x1 x2 x3), (y0 y1 y2 y3) -> (x0 y0 x1 y1), (x2 y2 x3 y3)
+        const VectorRegister4Float X = VectorLoad(SrcX + i);
+        const VectorRegister4Float Y = VectorLoad(SrcY + i);
+        const VectorRegister4Float Low = VectorShuffle(X, Y, 0, 1, 0, 1);
+        const VectorRegister4Float High = VectorShuffle(X, Y, 2, 3, 2, 3);
+        VectorStoreAligned(VectorSwizzle(Low, 0, 2, 1, 3), Interleaved);
+        VectorStoreAligned(VectorSwizzle(High, 0, 2, 1, 3), Interleaved + 4);
+        FPlatformMath::WideVectorStoreHalf(Out + i * 2, Interleaved);
+    }
+    for (; i < Num; i++)
+    {
+        Dst[i * 2 + 0] = FFloat16(SrcX[i]);
+        Dst[i * 2 + 1] = FFloat16(SrcY[i]);
+    }
+}
+
+void FGPUUploadConvert::FloatToUNorm8(const float* Src, uint8* Dst, int32 Num, float MinPositive)
+{
+    const VectorRegister4Float Zero = VectorZeroFloat();
+    const VectorRegister4Float One = VectorOne();
+    const VectorRegister4Float Floor = VectorSetFloat1(MinPositive);
+    const VectorRegister4Float Scale = VectorSetFloat1(255.0f);
+    const VectorRegister4Float Half = VectorSetFloat1(0.5f);
+
+    int32 i = 0;
+    for (; i + 4 <= Num; i += 4)
+    {
+        const VectorRegister4Float Value = VectorLoad(Src + i);
+        const VectorRegister4Float Raised = VectorSelect(VectorCompareGT(Value, Zero), VectorMax(Value, Floor), Zero);
+
+        // Truncating x * 255 + 0.5 matches RoundToInt for the non-negative range
+        const VectorRegister4Float Saturated = VectorMin(Raised, One);
+        VectorStoreByte4(VectorMultiplyAdd(Saturated, Scale, Half), Dst + i);
+    }
+    for (; i < Num; i++)
+    {
+        const float Value = Src[i] > 0.0f ? FMath::Max(Src[i], MinPositive) : 0.0f;
+        Dst[i] = (uint8)FMath::RoundToInt(FMath::Min(Value, 1.0f) * 255.0f);
+    }
+}
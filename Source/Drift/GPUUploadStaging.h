@@ -0,0 +1,90 @@
+// GPUUploadStaging.h - Persistent staging buffers and dirty-region tracking for simulation-to-GPU texture uploads
+#pragma once
+
+#include "CoreMinimal.h"
+#include "RHI.h"
+#include "RenderCommandFence.h"
+
+/**
+ * Texels changed since the last upload, kept as one column span per horizontal band of
+ * BandHeight rows. Matching the water active-tile size means a changed tile dirties
+ * exactly its own band.
+ */
+struct DRIFT_API FTextureDirtyRegions
+{
+    // Starts fully dirty so the first upload fills the texture
+    void Initialize(int32 InWidth, int32 InHeight, int32 InBandHeight);
+
+    bool Matches(int32 InWidth, int32 InHeight) const { return Width == InWidth && Height == InHeight && NumBands > 0; }
+
+    void MarkRect(const FIntRect& Rect);   // Inclusive texel bounds, clamped to the texture
+    void MarkAll();
+    void Clear();                           // E.g. after a full upload made by other means
+    bool IsEmpty() const { return NumDirtyBands == 0; }
+
+    // One region per run of consecutive dirty bands with the same span (SrcX/SrcY == DestX/DestY), then clears
+    void Consume(TArray<FUpdateTextureRegion2D>& OutRegions);
+
+    // Texels covered by the pending regions
+    int64 GetNumDirtyTexels() const;
+
+private:
+    int32 Width = 0;
+    int32 Height = 0;
+    int32 BandHeight = 1;
+    int32 NumBands = 0;
+    int32 NumDirtyBands = 0;
+    TArray<FIntPoint> BandSpans;    // Inclusive [X, Y] column range; X > Y when the band is clean
+};
+
+/**
+ * Round-robin set of upload buffers shared by the game and render threads.
+ *
+ * The game thread fills a slot and enqueues render commands that read it, then Submit()
+ * records a render fence. A slot is only handed out again once the render thread has
+ * passed that fence, so buffers are never written while an upload may still read them and
+ * steady-state frames allocate nothing. With every slot in flight Acquire() returns null
+ * and the caller keeps its dirty regions for the next frame instead of stalling.
+ */
+class DRIFT_API FGPUUploadStagingRing
+{
+public:
+    static constexpr int32 NumSlots = 3;
+
+    struct FSlot
+    {
+        TArray<uint8, TAlignedHeapAllocator<16>> Data;
+        TArray<FUpdateTextureRegion2D> Regions;    // Stays valid for the render commands reading Data
+    };
+
+    ~FGPUUploadStagingRing() { Flush(); }
+
+    // Next slot with at least NumBytes of Data (contents undefined), or nullptr while it is still in flight
+    FSlot* Acquire(int64 NumBytes);
+
+    // Call after enqueueing every render command that reads Slot
+    void Submit(FSlot* Slot);
+
+    // Blocks until the render thread has consumed every submitted slot (teardown, resize)
+    void Flush();
+
+    int32 GetNumSkippedUploads() const { return NumSkippedUploads; }
+    SIZE_T GetAllocatedSize() const;
+
+private:
+    FSlot Slots[NumSlots];
+    FRenderCommandFence Fences[NumSlots];
+    bool bInFlight[NumSlots] = {};
+    int32 NextSlot = 0;
+    int32 NumSkippedUploads = 0;
+};
+
+// SIMD conversions used to fill staging buffers (four texels per step, scalar tail)
+struct DRIFT_API FGPUUploadConvert
+{
+    // Dst[2i] = half(SrcX[i]), Dst[2i + 1] = half(SrcY[i]) - two-channel RG16F texels
+    static void FloatPairToHalf2(const float* SrcX, const float* SrcY, FFloat16* Dst, int32 Num);
+
+    // Dst[i] = round(saturate(Src[i]) * 255); positive values are first raised to at least MinPositive
+    static void FloatToUNorm8(const float* Src, uint8* Dst, int32 Num, float MinPositive = 0.0f);
+};
@@ -159,6 +159,9 @@ UCLASS()
 class DRIFT_API AGeologyController : public AActor, public IScalableSystem
 {
     GENERATED_BODY()
+
+    // Headless solver benchmark drives the private simulation passes directly
+    friend class UDriftBenchmarkCommandlet;
     
 public:
     AGeologyController();
@@ -0,0 +1,404 @@
+// GridFilter.cpp - Separable, row-parallel 3x3 filters over padded float grids
+#include "GridFilter.h"
+#include "Async/ParallelFor.h"
+#include "Math/VectorRegister.h"
+
+namespace
+{
+    // Rows per ParallelFor work item
+    constexpr int32 FilterBandRows = 32;
+
+    // Row buffers are indexed from -RowBufferLead so the vertical pass can start one cell left of the span
+    constexpr int32 RowBufferLead = 4;
+
+    FORCEINLINE int32 GetRowBufferLength(int32 Width)
+    {
+        return Width + RowBufferLead + 8;
+    }
+
+    // Writes the first Count (1..4) lanes of Value
+    FORCEINLINE void StoreLanes(const VectorRegister4Float& Value, float* Dst, int32 Count)
+    {
+        if (Count >= 4)
+        {
+            VectorStore(Value, Dst);
+            return;
+        }
+
+        float Lanes[4];
+        VectorStore(Value, Lanes);
+        for (int32 Lane = 0; Lane < Count; Lane++)
+        {
+            Dst[Lane] = Lanes[Lane];
+        }
+    }
+
+    // A + (B - A) * Alpha
+    FORCEINLINE VectorRegister4Float FilterLerp(const VectorRegister4Float& A, const VectorRegister4Float& B, const VectorRegister4Float& Alpha)
+    {
+        return VectorMultiplyAdd(VectorSubtract(B, A), Alpha, A);
+    }
+
+    // 1.0 where Mask is set, 0.0 elsewhere
+    FORCEINLINE VectorRegister4Float MaskToOne(const VectorRegister4Float& Mask)
+    {
+        return VectorBitwiseAnd(Mask, VectorOne());
+    }
+}
+
+// ============================================================================
+// PADDED GRID
+// ============================================================================
+
+void FPaddedGrid::Resize(int32 InWidth, int32 InHeight)
+{
+    Width = FMath::Max(InWidth, 0);
+    Height = FMath::Max(InHeight, 0);
+
+    // Two border columns, rounded to whole vectors, plus one vector of slack for the last block
+    Stride = Align(Width + 2, 4) + 4;
+    const int64 NumFloats = (int64)Stride * (Height + 2);
+    if (Data.Num() < NumFloats)
+    {
+        Data.SetNumZeroed(NumFloats);
+    }
+}
+
+void FPaddedGrid::ReplicateBorder()
+{
+    if (Width <= 0 || Height <= 0)
+    {
+        return;
+    }
+
+    for (int32 Y = 0; Y < Height; Y++)
+    {
+        float* RowData = Row(Y);
+        RowData[-1] = RowData[0];
+        RowData[Width] = RowData[Width - 1];
+    }
+
+    // Corners come along with the rows
+    FMemory::Memcpy(Row(-1) - 1, Row(0) - 1, (Width + 2) * sizeof(float));
+    FMemory::Memcpy(Row(Height) - 1, Row(Height - 1) - 1, (Width + 2) * sizeof(float));
+}
+
+void FPaddedGrid::CopyFrom(const float* Src, int32 SrcStride, FIntPoint SrcOrigin)
+{
+    for (int32 Y = 0; Y < Height; Y++)
+    {
+        FMemory::Memcpy(Row(Y), Src + (int64)(SrcOrigin.Y + Y) * SrcStride + SrcOrigin.X, Width * sizeof(float));
+    }
+}
+
+void FPaddedGrid::GatherSpans(const float* Src, TFunctionRef<TConstArrayView<FIntPoint>(int32)> Spans)
+{
+    for (int32 Y = 0; Y < Height; Y++)
+    {
+        const float* SrcRow = Src + (int64)Y * Width;
+        float* DstRow = Row(Y);
+        const FIntPoint* LastCopied = nullptr;
+
+        // Row Y is read by the spans of rows Y - 1 .. Y + 1; rows in one tile row share a span list
+        for (int32 SpanRow = FMath::Max(Y - 1, 0); SpanRow <= FMath::Min(Y + 1, Height - 1); SpanRow++)
+        {
+            const TConstArrayView<FIntPoint> RowSpans = Spans(SpanRow);
+            if (RowSpans.Num() == 0 || RowSpans.GetData() == LastCopied)
+            {
+                continue;
+            }
+            LastCopied = RowSpans.GetData();
+
+            for (const FIntPoint& Span : RowSpans)
+            {
+                const int32 StartX = FMath::Max(Span.X - 1, 0);
+                const int32 EndX = FMath::Min(Span.Y + 1, Width);
+                if (EndX > StartX)
+                {
+                    FMemory::Memcpy(DstRow + StartX, SrcRow + StartX, (EndX - StartX) * sizeof(float));
+                }
+            }
+        }
+    }
+}
+
+// ============================================================================
+// FILTERS
+// ============================================================================
+
+void FGridFilter::ForEachRow(int32 NumRows, int32 NumRowBuffers, int32 RowLength, TFunctionRef<void(int32, float*)> ProcessRow)
+{
+    const int32 NumBands = FMath::DivideAndRoundUp(NumRows, FilterBandRows);
+    if (NumBands <= 0)
+    {
+        return;
+    }
+
+    const int64 BandFloats = (int64)NumRowBuffers * RowLength;
+    if (BandScratch.Num() < BandFloats * NumBands)
+    {
+        BandScratch.SetNumZeroed(BandFloats * NumBands);
+    }
+
+    ParallelFor(NumBands, [&](int32 BandIndex)
+    {
+        float* RowBuffers = BandScratch.GetData() + BandFloats * BandIndex;
+        const int32 EndY = FMath::Min((BandIndex + 1) * FilterBandRows, NumRows);
+        for (int32 Y = BandIndex * FilterBandRows; Y < EndY; Y++)
+        {
+            ProcessRow(Y, RowBuffers);
+        }
+    }, !bParallel || NumBands < 2);
+}
+
+void FGridFilter::WeightedSmooth(const FPaddedGrid& Src, FPaddedGrid& Dst, float Center, float Cardinal, float Diagonal)
+{
+    const int32 Width = Src.GetWidth();
+    const int32 RowLength = GetRowBufferLength(Width);
+    Dst.Resize(Width, Src.GetHeight());
+
+    const float TotalWeight = Center + 4.0f * Cardinal + 4.0f * Diagonal;
+    if (TotalWeight <= 0.0f)
+    {
+        return;
+    }
+    const float InvTotal = 1.0f / TotalWeight;
+
+    // With V = up + down per column, the cardinal taps are left + right + V and the diagonal
+    // taps are V[-1] + V[+1]: one vertical sum, then one row pass.
+    ForEachRow(Src.GetHeight(), 1, RowLength, [&](int32 Y, float* RowBuffers)
+    {
+        float* VerticalSum = RowBuffers + RowBufferLead;
+        const float* Up = Src.Row(Y - 1);
+        const float* Mid = Src.Row(Y);
+        const float* Down = Src.Row(Y + 1);
+        float* Out = Dst.Row(Y);
+
+        for (int32 X = -1; X < Width + 1; X += 4)
+        {
+            VectorStore(VectorAdd(VectorLoad(Up + X), VectorLoad(Down + X)), VerticalSum + X);
+        }
+
+        const VectorRegister4Float CenterWeight = VectorSetFloat1(Center * InvTotal);
+        const VectorRegister4Float CardinalWeight = VectorSetFloat1(Cardinal * InvTotal);
+        const VectorRegister4Float DiagonalWeight = VectorSetFloat1(Diagonal * InvTotal);
+
+        for (int32 X = 0; X < Width; X += 4)
+        {
+            const VectorRegister4Float Cardinals = VectorAdd(
+                VectorAdd(VectorLoad(Mid + X - 1), VectorLoad(Mid + X + 1)), VectorLoad(VerticalSum + X));
+            const VectorRegister4Float Diagonals = VectorAdd(VectorLoad(VerticalSum + X - 1), VectorLoad(VerticalSum + X + 1));
+
+            VectorRegister4Float Result = VectorMultiply(VectorLoad(Mid + X), CenterWeight);
+            Result = VectorMultiplyAdd(Cardinals, CardinalWeight, Result);
+            Result = VectorMultiplyAdd(Diagonals, DiagonalWeight, Result);
+            StoreLanes(Result, Out + X, Width - X);
+        }
+    });
+}
+
+void FGridFilter::EdgePreservingSmooth(const FPaddedGrid& Src, FPaddedGrid& Dst, const FIntRect& Cells,
+                                       float WetValue, float GradientThreshold)
+{
+    const int32 Width = Src.GetWidth();
+    const int32 Height = Src.GetHeight();
+    const int32 RowLength = GetRowBufferLength(Width);
+    Dst.Resize(Width, Height);
+
+    const int32 MinX = FMath::Max(Cells.Min.X, 0);
+    const int32 MaxX = FMath::Min(Cells.Max.X, Width);
+    const int32 MinY = FMath::Max(Cells.Min.Y, 0);
+    const int32 MaxY = FMath::Min(Cells.Max.Y, Height);
+
+    ForEachRow(Height, 2, RowLength, [&](int32 Y, float* RowBuffers)
+    {
+        const float* Mid = Src.Row(Y);
+        float* Out = Dst.Row(Y);
+        FMemory::Memcpy(Out, Mid, Width * sizeof(float));
+        if (Y < MinY || Y >= MaxY || MinX >= MaxX)
+        {
+            return;
+        }
+
+        // Separable wet mean: per column, sum and count of wet cells over the three rows
+        float* WetSum = RowBuffers + RowBufferLead;
+        float* WetCount = RowBuffers + RowLength + RowBufferLead;
+        const float* Up = Src.Row(Y - 1);
+        const float* Down = Src.Row(Y + 1);
+        const VectorRegister4Float Wet = VectorSetFloat1(WetValue);
+
+        for (int32 X = MinX - 1; X < MaxX + 1; X += 4)
+        {
+            const VectorRegister4Float A = VectorLoad(Up + X);
+            const VectorRegister4Float B = VectorLoad(Mid + X);
+            const VectorRegister4Float C = VectorLoad(Down + X);
+            const VectorRegister4Float MaskA = VectorCompareGT(A, Wet);
+            const VectorRegister4Float MaskB = VectorCompareGT(B, Wet);
+            const VectorRegister4Float MaskC = VectorCompareGT(C, Wet);
+
+            VectorStore(VectorAdd(VectorAdd(VectorBitwiseAnd(MaskA, A), VectorBitwiseAnd(MaskB, B)), VectorBitwiseAnd(MaskC, C)), WetSum + X);
+            VectorStore(VectorAdd(VectorAdd(MaskToOne(MaskA), MaskToOne(MaskB)), MaskToOne(MaskC)), WetCount + X);
+        }
+
+        const VectorRegister4Float Zero = VectorZeroFloat();
+        const VectorRegister4Float One = VectorOne();
+        const VectorRegister4Float HalfValue = VectorSetFloat1(0.5f);
+        const VectorRegister4Float MinCenter = VectorSetFloat1(0.0001f);
+        const VectorRegister4Float Threshold = VectorSetFloat1(GradientThreshold);
+        const VectorRegister4Float InvThreshold = VectorSetFloat1(1.0f / FMath::Max(GradientThreshold, KINDA_SMALL_NUMBER));
+
+        for (int32 X = MinX; X < MaxX; X += 4)
+        {
+            const VectorRegister4Float Value = VectorLoad(Mid + X);
+            const VectorRegister4Float GradientX = VectorAbs(VectorSubtract(VectorLoad(Mid + X + 1), VectorLoad(Mid + X - 1)));
+            const VectorRegister4Float GradientY = VectorAbs(VectorSubtract(VectorLoad(Down + X), VectorLoad(Up + X)));
+            const VectorRegister4Float Gradient = VectorMax(GradientX, GradientY);
+
+            const VectorRegister4Float Sum = VectorAdd(VectorAdd(VectorLoad(WetSum + X - 1), VectorLoad(WetSum + X)), VectorLoad(WetSum + X + 1));
+            const VectorRegister4Float Count = VectorAdd(VectorAdd(VectorLoad(WetCount + X - 1), VectorLoad(WetCount + X)), VectorLoad(WetCount + X + 1));
+            const VectorRegister4Float Mean = VectorDivide(Sum, VectorMax(Count, One));
+
+            // Blend falls from 0.5 at a flat surface to 0 at the threshold gradient
+            const VectorRegister4Float Blend = VectorMultiply(VectorSubtract(One, VectorMultiply(Gradient, InvThreshold)), HalfValue);
+            const VectorRegister4Float Apply = VectorBitwiseAnd(
+                VectorBitwiseAnd(VectorCompareGE(Value, MinCenter), VectorCompareLT(Gradient, Threshold)),
+                VectorCompareGT(Count, Zero));
+
+            StoreLanes(VectorSelect(Apply, FilterLerp(Value, Mean, Blend), Value), Out + X, MaxX - X);
+        }
+    });
+}
+
+void FGridFilter::WetGaussianBlend(const FPaddedGrid& Src, float* Dst, int32 DstStride, FRowSpans Spans,
+                                   float DryDepth, float NeighborDepth, float Strength)
+{
+    const int32 Width = Src.GetWidth();
+    const int32 Height = Src.GetHeight();
+    const int32 RowLength = GetRowBufferLength(Width);
+
+    ForEachRow(Height, 2, RowLength, [&](int32 Y, float* RowBuffers)
+    {
+        if (Y < 1 || Y >= Height - 1)
+        {
+            return;
+        }
+
+        float* VerticalBlur = RowBuffers + RowBufferLead;
+        float* DeepCount = RowBuffers + RowLength + RowBufferLead;
+        const float* Up = Src.Row(Y - 1);
+        const float* Mid = Src.Row(Y);
+        const float* Down = Src.Row(Y + 1);
+        float* Out = Dst + (int64)Y * DstStride;
+
+        const VectorRegister4Float Two = VectorSetFloat1(2.0f);
+        const VectorRegister4Float Sixteenth = VectorSetFloat1(1.0f / 16.0f);
+        const VectorRegister4Float Deep = VectorSetFloat1(NeighborDepth);
+        const VectorRegister4Float Dry = VectorSetFloat1(DryDepth);
+        const VectorRegister4Float Alpha = VectorSetFloat1(Strength);
+        const VectorRegister4Float Zero = VectorZeroFloat();
+
+        for (const FIntPoint& Span : Spans(Y))
+        {
+            const int32 StartX = FMath::Max(Span.X, 1);
+            const int32 EndX = FMath::Min(Span.Y, Width - 1);
+            if (StartX >= EndX)
+            {
+                continue;
+            }
+
+            for (int32 X = StartX - 1; X < EndX + 1; X += 4)
+            {
+                const VectorRegister4Float A = VectorLoad(Up + X);
+                const VectorRegister4Float B = VectorLoad(Mid + X);
+                const VectorRegister4Float C = VectorLoad(Down + X);
+                VectorStore(VectorMultiplyAdd(B, Two, VectorAdd(A, C)), VerticalBlur + X);
+                VectorStore(VectorAdd(VectorAdd(MaskToOne(VectorCompareGT(A, Deep)), MaskToOne(VectorCompareGT(B, Deep))),
+                                      MaskToOne(VectorCompareGT(C, Deep))), DeepCount + X);
+            }
+
+            for (int32 X = StartX; X < EndX; X += 4)
+            {
+                const VectorRegister4Float Value = VectorLoad(Mid + X);
+                const VectorRegister4Float Blurred = VectorMultiply(
+                    VectorAdd(VectorMultiplyAdd(VectorLoad(VerticalBlur + X), Two, VectorLoad(VerticalBlur + X - 1)), VectorLoad(VerticalBlur + X + 1)),
+                    Sixteenth);
+
+                // Deep neighbours, excluding the cell itself
+                const VectorRegister4Float Neighbours = VectorSubtract(
+                    VectorAdd(VectorAdd(VectorLoad(DeepCount + X - 1), VectorLoad(DeepCount + X)), VectorLoad(DeepCount + X + 1)),
+                    MaskToOne(VectorCompareGT(Value, Deep)));
+                const VectorRegister4Float Apply = VectorBitwiseOr(VectorCompareGT(Value, Dry), VectorCompareGT(Neighbours, Zero));
+
+                StoreLanes(VectorSelect(Apply, FilterLerp(Value, Blurred, Alpha), Value), Out + X, EndX - X);
+            }
+        }
+    });
+}
+
+void FGridFilter::EdgeAwareSmooth(const FPaddedGrid& Src, float* Dst, int32 DstStride, FRowSpans Spans,
+                                  float MinDepth, float MaxStrength)
+{
+    const int32 Width = Src.GetWidth();
+    const int32 Height = Src.GetHeight();
+
+    ForEachRow(Height, 0, 0, [&](int32 Y, float*)
+    {
+        if (Y < 1 || Y >= Height - 1)
+        {
+            return;
+        }
+
+        const float* Rows[3] = { Src.Row(Y - 1), Src.Row(Y), Src.Row(Y + 1) };
+        float* Out = Dst + (int64)Y * DstStride;
+
+        const VectorRegister4Float Zero = VectorZeroFloat();
+        const VectorRegister4Float One = VectorOne();
+        const VectorRegister4Float Ten = VectorSetFloat1(10.0f);
+        const VectorRegister4Float EdgeStep = VectorSetFloat1(MinDepth * 2.0f);
+        const VectorRegister4Float InvBlendScale = VectorSetFloat1(1.0f / (MinDepth * 10.0f));
+        const VectorRegister4Float StrengthCap = VectorSetFloat1(MaxStrength);
+
+        for (const FIntPoint& Span : Spans(Y))
+        {
+            const int32 StartX = FMath::Max(Span.X, 1);
+            const int32 EndX = FMath::Min(Span.Y, Width - 1);
+
+            for (int32 X = StartX; X < EndX; X += 4)
+            {
+                const VectorRegister4Float Value = VectorLoad(Rows[1] + X);
+
+                // The centre tap has weight 1 and no difference
+                VectorRegister4Float WeightedSum = Value;
+                VectorRegister4Float TotalWeight = One;
+                VectorRegister4Float MaxDiff = Zero;
+
+                for (int32 DY = 0; DY < 3; DY++)
+                {
+                    for (int32 DX = -1; DX <= 1; DX++)
+                    {
+                        if (DY == 1 && DX == 0)
+                        {
+                            continue;
+                        }
+
+                        const VectorRegister4Float Neighbour = VectorLoad(Rows[DY] + X + DX);
+                        const VectorRegister4Float Diff = VectorAbs(VectorSubtract(Neighbour, Value));
+                        const VectorRegister4Float Weight = VectorDivide(One, VectorMultiplyAdd(Diff, Ten, One));
+                        WeightedSum = VectorMultiplyAdd(Neighbour, Weight, WeightedSum);
+                        TotalWeight = VectorAdd(TotalWeight, Weight);
+                        MaxDiff = VectorMax(MaxDiff, Diff);
+                    }
+                }
+
+                // Only cells beside a water edge are smoothed, so bulk water keeps its behaviour
+                const VectorRegister4Float Apply = VectorBitwiseAnd(
+                    VectorBitwiseAnd(VectorCompareGT(Value, Zero), VectorCompareGT(MaxDiff, EdgeStep)),
+                    VectorCompareGT(MaxDiff, Zero));
+                const VectorRegister4Float Blend = VectorMin(VectorMax(VectorMultiply(MaxDiff, InvBlendScale), Zero), StrengthCap);
+                const VectorRegister4Float Smoothed = FilterLerp(Value, VectorDivide(WeightedSum, TotalWeight), Blend);
+
+                StoreLanes(VectorSelect(Apply, Smoothed, Value), Out + X, EndX - X);
+            }
+        }
+    });
+}
@@ -0,0 +1,100 @@
+// GridFilter.h - Separable, row-parallel 3x3 filters over padded float grids
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Float grid with a one-cell border on every side, so 3x3 stencils read their neighbours
+ * without clamping. Row(Y) is valid for Y in [-1, Height] and X in [-1, Width]; rows also
+ * carry slack past the border so four-wide loads that start on the border stay in the row.
+ */
+struct DRIFT_API FPaddedGrid
+{
+    // Keeps capacity; contents are undefined after a size change
+    void Resize(int32 InWidth, int32 InHeight);
+
+    int32 GetWidth() const { return Width; }
+    int32 GetHeight() const { return Height; }
+
+    float* Row(int32 Y) { return Data.GetData() + (int64)(Y + 1) * Stride + 1; }
+    const float* Row(int32 Y) const { return Data.GetData() + (int64)(Y + 1) * Stride + 1; }
+
+    // Border cells copy their nearest interior cell (clamp-to-edge addressing)
+    void ReplicateBorder();
+
+    // Copies a Width x Height block of Src (SrcStride floats per row, starting at SrcOrigin) into the interior
+    void CopyFrom(const float* Src, int32 SrcStride, FIntPoint SrcOrigin);
+
+    // Copies Src cells the filters read for Spans: each span grown by one cell in X and Y (same layout as Src)
+    void GatherSpans(const float* Src, TFunctionRef<TConstArrayView<FIntPoint>(int32)> Spans);
+
+    SIZE_T GetAllocatedSize() const { return Data.GetAllocatedSize(); }
+
+private:
+    int32 Width = 0;
+    int32 Height = 0;
+    int32 Stride = 0;
+    TArray<float, TAlignedHeapAllocator<16>> Data;
+};
+
+/**
+ * 3x3 filters shared by the water depth texture and the water simulation smoothing.
+ *
+ * Sources are padded grids, so no tap is clamped. Kernels whose weights do not depend on
+ * the data run separably: a vertical pass fills per-band row buffers and a horizontal pass
+ * combines them, so each output needs five vector loads instead of nine. Rows are split
+ * into bands run through ParallelFor and cells are processed four at a time; a row's last
+ * block is computed in full and only its valid lanes are stored.
+ *
+ * Instances own the band buffers, so keep one per call site and reuse it across frames.
+ */
+class DRIFT_API FGridFilter
+{
+public:
+    // Column spans [X, Y) to filter on a given row
+    using FRowSpans = TFunctionRef<TConstArrayView<FIntPoint>(int32)>;
+
+    bool bParallel = true;
+
+    /**
+     * Symmetric weighted smoothing of every interior cell:
+     * Dst = (Center * C + Cardinal * (N + S + E + W) + Diagonal * (NE + NW + SE + SW)) / total weight.
+     * Src's border must be filled (see FPaddedGrid::ReplicateBorder); Dst is resized to Src.
+     */
+    void WeightedSmooth(const FPaddedGrid& Src, FPaddedGrid& Dst, float Center, float Cardinal, float Diagonal);
+
+    /**
+     * Blends wet cells toward the mean of the wet cells in their 3x3 neighbourhood, only where
+     * the central-difference gradient is below GradientThreshold and less the steeper it gets,
+     * so shorelines stay sharp. Filters cells inside Cells ([Min, Max) interior coordinates) and
+     * copies the rest; Dst is resized to Src.
+     */
+    void EdgePreservingSmooth(const FPaddedGrid& Src, FPaddedGrid& Dst, const FIntRect& Cells,
+                              float WetValue = 0.001f, float GradientThreshold = 0.1f);
+
+    /**
+     * Binomial (1 2 1) x (1 2 1) blur of cells that hold more than DryDepth or have a neighbour
+     * deeper than NeighborDepth, lerped from the original by Strength. Writes Dst (same layout
+     * as Src's interior, DstStride floats per row) inside Spans only; the outermost ring of
+     * cells is never written.
+     */
+    void WetGaussianBlend(const FPaddedGrid& Src, float* Dst, int32 DstStride, FRowSpans Spans,
+                          float DryDepth, float NeighborDepth, float Strength);
+
+    /**
+     * Inverse-difference weighted average for wet cells next to a depth step larger than
+     * 2 * MinDepth, lerped from the original by MaxDiff / (10 * MinDepth) capped at MaxStrength.
+     * The weights depend on each neighbour's value, so this one runs as a direct nine-tap
+     * vector stencil. Writes Dst inside Spans only, never the outermost ring of cells.
+     */
+    void EdgeAwareSmooth(const FPaddedGrid& Src, float* Dst, int32 DstStride, FRowSpans Spans,
+                         float MinDepth, float MaxStrength);
+
+    SIZE_T GetAllocatedSize() const { return BandScratch.GetAllocatedSize(); }
+
+private:
+    // Runs ProcessRow(Y, RowBuffers) over [0, NumRows) in parallel bands; each band gets NumRowBuffers rows of RowLength floats
+    void ForEachRow(int32 NumRows, int32 NumRowBuffers, int32 RowLength, TFunctionRef<void(int32, float*)> ProcessRow);
+
+    TArray<float, TAlignedHeapAllocator<16>> BandScratch;
+};
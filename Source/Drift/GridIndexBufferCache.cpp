@@ -0,0 +1,144 @@
+// GridIndexBufferCache.cpp - Shared triangle index buffers for regular-grid meshes
+#include "GridIndexBufferCache.h"
+
+FGridIndexBufferCache& FGridIndexBufferCache::Get()
+{
+    static FGridIndexBufferCache Instance;
+    return Instance;
+}
+
+int32 FGridIndexBufferCache::GetLODVertexCount(int32 VertexCount, int32 LOD)
+{
+    if (VertexCount <= 1 || LOD <= 0)
+    {
+        return FMath::Max(VertexCount, 0);
+    }
+
+    const int32 Step = 1 << FMath::Min(LOD, 16);
+    return (VertexCount - 2) / Step + 2;
+}
+
+int32 FGridIndexBufferCache::GetLODVertexCoordinate(int32 VertexCount, int32 LOD, int32 Index)
+{
+    // Every (1 << LOD)th vertex, then the last one
+    return Index >= GetLODVertexCount(VertexCount, LOD) - 1 ? VertexCount - 1 : Index << FMath::Clamp(LOD, 0, 16);
+}
+
+int32 FGridIndexBufferCache::GetNumPerimeterVertices(int32 Width, int32 Height)
+{
+    return (Width < 2 || Height < 2) ? 0 : 2 * (Width - 1) + 2 * (Height - 1);
+}
+
+int32 FGridIndexBufferCache::GetPerimeterVertex(int32 Width, int32 Height, int32 RingIndex)
+{
+    // Bottom row left to right, right column upward, top row right to left, left column downward
+    if (RingIndex < Width - 1)
+    {
+        return RingIndex;
+    }
+    RingIndex -= Width - 1;
+    if (RingIndex < Height - 1)
+    {
+        return RingIndex * Width + (Width - 1);
+    }
+    RingIndex -= Height - 1;
+    if (RingIndex < Width - 1)
+    {
+        return (Height - 1) * Width + (Width - 1 - RingIndex);
+    }
+    RingIndex -= Width - 1;
+    return (Height - 1 - RingIndex) * Width;
+}
+
+TSharedRef<const TArray<int32>, ESPMode::ThreadSafe> FGridIndexBufferCache::GetIndexBuffer(int32 Width, int32 Height, int32 LOD, bool bSkirts)
+{
+    const FIntVector4 Key(FMath::Max(Width, 0), FMath::Max(Height, 0), FMath::Max(LOD, 0), bSkirts ? 1 : 0);
+
+    {
+        FReadScopeLock ReadLock(BuffersLock);
+        if (const TSharedRef<const TArray<int32>, ESPMode::ThreadSafe>* Existing = Buffers.Find(Key))
+        {
+            return *Existing;
+        }
+    }
+
+    // Build outside the lock; if another thread raced us, keep whichever landed first
+    TSharedRef<TArray<int32>, ESPMode::ThreadSafe> NewBuffer = MakeShared<TArray<int32>, ESPMode::ThreadSafe>();
+    BuildIndexBuffer(GetLODVertexCount(Key.X, Key.Z), GetLODVertexCount(Key.Y, Key.Z), Key.W != 0, *NewBuffer);
+
+    FWriteScopeLock WriteLock(BuffersLock);
+    if (const TSharedRef<const TArray<int32>, ESPMode::ThreadSafe>* Existing = Buffers.Find(Key))
+    {
+        return *Existing;
+    }
+
+    UE_LOG(LogTemp, Verbose, TEXT("GridIndexBufferCache: Built %dx%d LOD %d%s (%d triangles)"),
+           Key.X, Key.Y, Key.Z, Key.W ? TEXT(" skirted") : TEXT(""), NewBuffer->Num() / 3);
+
+    return Buffers.Add(Key, NewBuffer);
+}
+
+void FGridIndexBufferCache::BuildIndexBuffer(int32 Width, int32 Height, bool bSkirts, TArray<int32>& OutTriangles)
+{
+    OutTriangles.Reset();
+    if (Width < 2 || Height < 2)
+    {
+        return;
+    }
+
+    const int32 NumPerimeter = bSkirts ? GetNumPerimeterVertices(Width, Height) : 0;
+    OutTriangles.SetNumUninitialized((Width - 1) * (Height - 1) * 6 + NumPerimeter * 6);
+    int32* Out = OutTriangles.GetData();
+
+    for (int32 Y = 0; Y < Height - 1; Y++)
+    {
+        for (int32 X = 0; X < Width - 1; X++)
+        {
+            const int32 BottomLeft = Y * Width + X;
+            const int32 BottomRight = BottomLeft + 1;
+            const int32 TopLeft = BottomLeft + Width;
+            const int32 TopRight = TopLeft + 1;
+
+            // First triangle
+            *Out++ = BottomLeft;
+            *Out++ = TopLeft;
+            *Out++ = BottomRight;
+
+            // Second triangle
+            *Out++ = BottomRight;
+            *Out++ = TopLeft;
+            *Out++ = TopRight;
+        }
+    }
+
+    // Skirt: each perimeter edge (walked counter-clockwise) extruded down, facing outward
+    const int32 FirstSkirtVertex = Width * Height;
+    for (int32 Ring = 0; Ring < NumPerimeter; Ring++)
+    {
+        const int32 NextRing = (Ring + 1) % NumPerimeter;
+        const int32 Edge = GetPerimeterVertex(Width, Height, Ring);
+        const int32 NextEdge = GetPerimeterVertex(Width, Height, NextRing);
+        const int32 Skirt = FirstSkirtVertex + Ring;
+        const int32 NextSkirt = FirstSkirtVertex + NextRing;
+
+        *Out++ = Edge;
+        *Out++ = NextEdge;
+        *Out++ = Skirt;
+
+        *Out++ = NextEdge;
+        *Out++ = NextSkirt;
+        *Out++ = Skirt;
+    }
+}
+
+void FGridIndexBufferCache::Reset()
+{
+    FWriteScopeLock WriteLock(BuffersLock);
+    Buffers.Empty();
+}
+
+int32 FGridIndexBufferCache::GetNumCachedBuffers() const
+{
+    FReadScopeLock ReadLock(BuffersLock);
+    return Buffers.Num();
+}
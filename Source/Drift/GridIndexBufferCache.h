@@ -0,0 +1,53 @@
+// GridIndexBufferCache.h - Shared triangle index buffers for regular-grid meshes
+// Terrain chunks and dense water surfaces reuse one index list per (width, height, LOD)
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Misc/ScopeRWLock.h"
+
+/**
+ * Process-wide cache of triangle lists for regular vertex grids.
+ *
+ * A grid's triangle list depends only on its dimensions, so every chunk of the
+ * same resolution shares one immutable buffer. Width and Height are full-resolution
+ * vertex counts; LOD N keeps every (1 << N)th vertex (plus the last row/column) and
+ * indexes the reduced grid of GetLODVertexCount(Width, N) x GetLODVertexCount(Height, N).
+ *
+ * Winding matches the terrain chunk mesh: (BL, TL, BR), (BR, TL, TR) with row-major
+ * vertices and +Y as "top". Buffers are never freed while referenced, so callers may
+ * hold the returned reference across frames and threads.
+ *
+ * Skirted buffers append a vertical strip around the grid that hides cracks against
+ * neighbours at another LOD: after the reduced grid's vertices come one skirt vertex per
+ * perimeter vertex (GetPerimeterVertex order, the same vertex pushed down), and after the
+ * grid's triangles come two outward-facing triangles per perimeter edge.
+ */
+class DRIFT_API FGridIndexBufferCache
+{
+public:
+    static FGridIndexBufferCache& Get();
+
+    // Returns the shared triangle list for a Width x Height vertex grid at the given LOD
+    TSharedRef<const TArray<int32>, ESPMode::ThreadSafe> GetIndexBuffer(int32 Width, int32 Height, int32 LOD = 0, bool bSkirts = false);
+
+    // Vertex count along one axis after LOD reduction (always keeps both end vertices)
+    static int32 GetLODVertexCount(int32 VertexCount, int32 LOD);
+
+    // Full-resolution coordinate of reduced vertex Index along one axis
+    static int32 GetLODVertexCoordinate(int32 VertexCount, int32 LOD, int32 Index);
+
+    // Perimeter of a (reduced) Width x Height grid, walked counter-clockwise from vertex 0 seen from +Z
+    static int32 GetNumPerimeterVertices(int32 Width, int32 Height);
+    static int32 GetPerimeterVertex(int32 Width, int32 Height, int32 RingIndex);
+
+    // Drops cached buffers (outstanding references stay valid)
+    void Reset();
+
+    int32 GetNumCachedBuffers() const;
+
+private:
+    static void BuildIndexBuffer(int32 Width, int32 Height, bool bSkirts, TArray<int32>& OutTriangles);
+
+    mutable FRWLock BuffersLock;
+    TMap<FIntVector4, TSharedRef<const TArray<int32>, ESPMode::ThreadSafe>> Buffers;   // (Width, Height, LOD, bSkirts)
+};
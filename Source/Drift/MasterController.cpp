@@ -1129,18 +1129,18 @@ void AMasterWorldController::ProcessSystemDataExchange()
         float TotalPrecipitation = 0.0f;
         int32 RainingCells = 0;
         
-        for (int32 Y = 0; Y < 64; Y++) // Assuming 64x64 grid
+        // 64x64 probe lattice sampled from one atmosphere snapshot (no per-point locking)
+        TArray<float> PrecipSamples;
+        const FVector TerrainOrigin = MainTerrain->GetActorLocation();
+        MainTerrain->AtmosphericSystem->GetFieldSnapshot(EAtmosphericField::Precipitation)->ResampleToGrid(
+            FVector2D(TerrainOrigin.X, TerrainOrigin.Y), FVector2D(1000.0f, 1000.0f), 64, 64, PrecipSamples);
+        
+        for (float Precip : PrecipSamples)
         {
-            for (int32 X = 0; X < 64; X++)
+            if (Precip > 0.1f)
             {
-                FVector WorldPos = MainTerrain->GetActorLocation() +
-                                  FVector(X * 1000.0f, Y * 1000.0f, 0);
-                float Precip = MainTerrain->AtmosphericSystem->GetPrecipitationAt(WorldPos);
-                if (Precip > 0.1f)
-                {
-                    TotalPrecipitation += Precip;
-                    RainingCells++;
-                }
+                TotalPrecipitation += Precip;
+                RainingCells++;
             }
         }
         
@@ -2641,19 +2641,20 @@ float AMasterWorldController::CalculateAtmosphericWaterFromGrid() const
         return 0.0f;
     
     float Total = 0.0f;
-    const TArray<FSimplifiedAtmosphericCell>& AtmosphericGrid =
+    const FAtmosphericGridSoA& AtmosphericGrid =
         MainTerrain->AtmosphericSystem->AtmosphericGrid;
     
     // Get atmospheric cell area for conversion
     float AtmosCellSize = MainTerrain->AtmosphericSystem->CellSize;
     float CellArea = AtmosCellSize * AtmosCellSize;
     
-    for (const auto& Cell : AtmosphericGrid)
+    for (int32 i = 0; i < AtmosphericGrid.Num(); i++)
     {
-        if (Cell.MoistureMass > 0.0f)
+        const float MoistureMass = AtmosphericGrid.MoistureMass[i];
+        if (MoistureMass > 0.0f)
         {
             // Convert kg/m² to m³: (kg/m² — m²) / (kg/m³) = m³
-            float VolumeM3 = (Cell.MoistureMass * CellArea) / WATER_DENSITY_KG_PER_M3;
+            float VolumeM3 = (MoistureMass * CellArea) / WATER_DENSITY_KG_PER_M3;
             Total += VolumeM3;
         }
     }
@@ -6,3 +6,4 @@
 
 IMPLEMENT_GLOBAL_SHADER(FTerrainComputeCS, "/Project/TerrainCompute.usf", "TerrainComputeCS", SF_Compute);
 IMPLEMENT_GLOBAL_SHADER(FOrographicComputeCS, "/Project/TerrainCompute.usf", "OrographicComputeCS", SF_Compute);
+IMPLEMENT_GLOBAL_SHADER(FHeightReadbackPackCS, "/Project/TerrainCompute.usf", "HeightReadbackPackCS", SF_Compute);
@@ -44,6 +44,10 @@ public:
         // Output erosion amount for feedback
         SHADER_PARAMETER_RDG_TEXTURE_UAV(RWTexture2D<float>, ErosionOutputTexture)
         
+        // One texel per ActivityTileSize^2 tile, set to 1 wherever a height changed (readback filter)
+        SHADER_PARAMETER_RDG_TEXTURE_UAV(RWTexture2D<float>, ErosionActivityTexture)
+        SHADER_PARAMETER(uint32, ActivityTileSize)
+        
         // Simulation parameters
         SHADER_PARAMETER(FVector4f, TerrainParams) // xy = dimensions, z = scale, w = time
         SHADER_PARAMETER(FVector4f, ErosionParams) // x = rate, y = deposition, z = capacity, w = hardness mult
@@ -97,3 +101,31 @@ public:
         return IsFeatureLevelSupported(Parameters.Platform, ERHIFeatureLevel::SM5);
     }
 };
+
+/**
+ * Packs the height channel of flagged activity tiles from the RGBA16F height texture into a
+ * single-channel R16F atlas (tile i at column i % PackAtlasTilesX, row i / PackAtlasTilesX),
+ * and clears their activity flags. CPU readbacks then move 2 bytes per texel of changed tiles
+ * instead of 8 per texel of the whole map. One thread group slice per tile.
+ */
+class DRIFT_API FHeightReadbackPackCS : public FGlobalShader
+{
+public:
+    DECLARE_GLOBAL_SHADER(FHeightReadbackPackCS);
+    SHADER_USE_PARAMETER_STRUCT(FHeightReadbackPackCS, FGlobalShader);
+    
+    BEGIN_SHADER_PARAMETER_STRUCT(FParameters, )
+        SHADER_PARAMETER_RDG_TEXTURE_SRV(Texture2D<float4>, PackSourceTexture)
+        SHADER_PARAMETER_RDG_TEXTURE_UAV(RWTexture2D<float>, PackedHeightTexture)
+        SHADER_PARAMETER_RDG_TEXTURE_UAV(RWTexture2D<float>, PackActivityTexture)
+        SHADER_PARAMETER_RDG_BUFFER_SRV(StructuredBuffer<uint2>, PackTiles)
+        SHADER_PARAMETER(FIntPoint, PackSize)
+        SHADER_PARAMETER(uint32, PackTileSize)
+        SHADER_PARAMETER(uint32, PackAtlasTilesX)
+    END_SHADER_PARAMETER_STRUCT()
+    
+    static bool ShouldCompilePermutation(const FGlobalShaderPermutationParameters& Parameters)
+    {
+        return IsFeatureLevelSupported(Parameters.Platform, ERHIFeatureLevel::SM5);
+    }
+};
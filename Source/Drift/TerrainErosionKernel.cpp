@@ -0,0 +1,395 @@
+// TerrainErosionKernel.cpp - CPU port of the TerrainCompute.usf hydraulic + thermal erosion step
+#include "TerrainErosionKernel.h"
+#include "Async/ParallelFor.h"
+#include "Math/VectorRegister.h"
+
+namespace
+{
+    // Rows per ParallelFor work item
+    constexpr int32 ErosionBandRows = 32;
+
+    // SafeFloat of the shader: NaN/Inf become 0, everything else is clamped
+    FORCEINLINE float ErosionSafeFloat(float Value, float MinValue = FTerrainErosionKernel::MinHeight,
+                                       float MaxValue = FTerrainErosionKernel::MaxHeight)
+    {
+        return FMath::IsFinite(Value) ? FMath::Clamp(Value, MinValue, MaxValue) : 0.0f;
+    }
+
+    // SafeDivide of the shader: 0 unless |Denominator| > MinDenominator
+    FORCEINLINE float ErosionSafeDivide(float Numerator, float Denominator, float MinDenominator = 0.001f)
+    {
+        return FMath::Abs(Denominator) > MinDenominator ? Numerator / Denominator : 0.0f;
+    }
+
+    FORCEINLINE VectorRegister4Float ErosionVectorClamp(const VectorRegister4Float& Value, const VectorRegister4Float& MinValue,
+                                                        const VectorRegister4Float& MaxValue)
+    {
+        return VectorMin(VectorMax(Value, MinValue), MaxValue);
+    }
+
+    FORCEINLINE VectorRegister4Float ErosionVectorSafeFloat(const VectorRegister4Float& Value, const VectorRegister4Float& MinValue,
+                                                            const VectorRegister4Float& MaxValue)
+    {
+        // NaN fails the compare as well as Inf
+        const VectorRegister4Float FiniteMask = VectorCompareLE(VectorAbs(Value), VectorSetFloat1(TNumericLimits<float>::Max()));
+        return VectorSelect(FiniteMask, ErosionVectorClamp(Value, MinValue, MaxValue), VectorZero());
+    }
+
+    FORCEINLINE VectorRegister4Float ErosionVectorSafeDivide(const VectorRegister4Float& Numerator, const VectorRegister4Float& Denominator,
+                                                             const VectorRegister4Float& MinDenominator)
+    {
+        const VectorRegister4Float ValidMask = VectorCompareGT(VectorAbs(Denominator), MinDenominator);
+        return VectorSelect(ValidMask, VectorDivide(Numerator, Denominator), VectorZero());
+    }
+
+    FORCEINLINE void GrowChangedRect(FIntRect& Rect, int32 X, int32 Y)
+    {
+        Rect.Min.X = FMath::Min(Rect.Min.X, X);
+        Rect.Min.Y = FMath::Min(Rect.Min.Y, Y);
+        Rect.Max.X = FMath::Max(Rect.Max.X, X);
+        Rect.Max.Y = FMath::Max(Rect.Max.Y, Y);
+    }
+
+    const FIntRect EmptyChangedRect(MAX_int32, MAX_int32, -1, -1);
+}
+
+// ============================================================================
+// SCALAR REFERENCE
+// ============================================================================
+
+FTerrainErosionCellResult FTerrainErosionKernel::ComputeCellReference(float H, float L, float R, float T, float B,
+                                                                      float WaterDepth, float VelocityX, float VelocityY,
+                                                                      float Hardness, const FTerrainErosionParams& Params)
+{
+    FTerrainErosionCellResult Result;
+
+    const float TerrainScale = FMath::Max(Params.TerrainScale, MinTerrainScale);
+    H = ErosionSafeFloat(H);
+    L = ErosionSafeFloat(L);
+    R = ErosionSafeFloat(R);
+    T = ErosionSafeFloat(T);
+    B = ErosionSafeFloat(B);
+
+    // ----- CalculateErosion -----
+    WaterDepth = ErosionSafeFloat(WaterDepth, 0.0f, 1000.0f);
+    const float WaterFalloff = FMath::Clamp((WaterDepth - MinWaterDepth) / (MinWaterDepth * 4.0f), 0.0f, 1.0f);
+    if (WaterFalloff > 0.0f)
+    {
+        VelocityX = ErosionSafeFloat(VelocityX, -1000.0f, 1000.0f);
+        VelocityY = ErosionSafeFloat(VelocityY, -1000.0f, 1000.0f);
+        const float HydraulicHardness = ErosionSafeFloat(Hardness, 0.0f, 10.0f);
+
+        const float FlowSpeed = FMath::Max(FMath::Sqrt(VelocityX * VelocityX + VelocityY * VelocityY), MinFlowSpeed);
+        const float StreamPower = ErosionSafeFloat(WaterDepth * FlowSpeed, 0.0f, 10000.0f);
+
+        const float GradientX = ErosionSafeDivide(R - L, 2.0f * TerrainScale, 0.1f);
+        const float GradientY = ErosionSafeDivide(B - T, 2.0f * TerrainScale, 0.1f);
+        const float Slope = FMath::Min(FMath::Max(FMath::Sqrt(GradientX * GradientX + GradientY * GradientY), 0.0f), 10.0f);
+
+        float ErosionRate = Params.ErosionRate * StreamPower;
+        ErosionRate *= (1.0f + Slope * 2.0f);
+        ErosionRate = ErosionSafeDivide(ErosionRate, 1.0f + HydraulicHardness * Params.HardnessMultiplier);
+
+        float Deposition = 0.0f;
+        if (FlowSpeed < 0.5f)
+        {
+            const float DepositFactor = ErosionSafeDivide(FlowSpeed, 0.5f);
+            Deposition = ErosionSafeFloat(Params.DepositionRate * (1.0f - DepositFactor) * WaterDepth, 0.0f, 100.0f);
+        }
+
+        Result.HydraulicErosion = FMath::Clamp((ErosionRate - Deposition) * WaterFalloff, -MaxErosionRate, MaxErosionRate);
+    }
+
+    // ----- CalculateThermalErosion (the shader passes the unclamped hardness here) -----
+    const float MaxSlope = MaxStableSlope * (1.0f + Hardness * HardnessSlopeMultiplier);
+    const float ExcessL = FMath::Max(0.0f, (H - L) / TerrainScale - MaxSlope);
+    const float ExcessR = FMath::Max(0.0f, (H - R) / TerrainScale - MaxSlope);
+    const float ExcessT = FMath::Max(0.0f, (H - T) / TerrainScale - MaxSlope);
+    const float ExcessB = FMath::Max(0.0f, (H - B) / TerrainScale - MaxSlope);
+    const float TotalExcess = ExcessL + ExcessR + ExcessT + ExcessB;
+    const float ThermalLoss = ErosionSafeDivide(TotalExcess * ThermalErosionRate * TerrainScale, 1.0f + Hardness * 2.0f);
+    Result.ThermalErosion = FMath::Clamp(ThermalLoss, 0.0f, MaxErosionRate * 0.5f);
+
+    // ----- TerrainComputeCS -----
+    const float SafeDelta = FMath::Clamp(Params.DeltaTime, 0.0f, 1.0f);
+    Result.HeightDelta = FMath::Clamp((Result.HydraulicErosion + Result.ThermalErosion) * SafeDelta, -100.0f, 100.0f);
+    return Result;
+}
+
+// ============================================================================
+// VECTOR KERNEL
+// ============================================================================
+
+int32 FTerrainErosionKernel::ProcessRow(int32 Y, float* HeightRow, const FTerrainErosionInputs& Inputs,
+                                        const FTerrainErosionParams& Params, float* SedimentRow, FIntRect& ChangedRect) const
+{
+    const int32 Width = Source.GetWidth();
+    const int64 RowOffset = (int64)Y * Width;
+    const float* Up = Source.Row(Y - 1);
+    const float* Mid = Source.Row(Y);
+    const float* Down = Source.Row(Y + 1);
+    const float* DepthRow = Inputs.WaterDepth + RowOffset;
+    const float* VelocityXRow = Inputs.VelocityX + RowOffset;
+    const float* VelocityYRow = Inputs.VelocityY + RowOffset;
+    const float* HardnessRow = Inputs.Hardness ? Inputs.Hardness + RowOffset : nullptr;
+    const float SafeDelta = FMath::Clamp(Params.DeltaTime, 0.0f, 1.0f);
+
+    int32 NumChanged = 0;
+    int32 X = 0;
+
+    if (bVectorized)
+    {
+        const float TerrainScale = FMath::Max(Params.TerrainScale, MinTerrainScale);
+        const VectorRegister4Float VZero = VectorZero();
+        const VectorRegister4Float VOne = VectorOne();
+        const VectorRegister4Float VTwo = VectorSetFloat1(2.0f);
+        const VectorRegister4Float VScale = VectorSetFloat1(TerrainScale);
+        const VectorRegister4Float VTwoScale = VectorSetFloat1(2.0f * TerrainScale);
+        const VectorRegister4Float VMinHeight = VectorSetFloat1(MinHeight);
+        const VectorRegister4Float VMaxHeight = VectorSetFloat1(MaxHeight);
+        const VectorRegister4Float VMaxDepth = VectorSetFloat1(1000.0f);
+        const VectorRegister4Float VMinVelocity = VectorSetFloat1(-1000.0f);
+        const VectorRegister4Float VMaxVelocity = VectorSetFloat1(1000.0f);
+        const VectorRegister4Float VMaxHardness = VectorSetFloat1(10.0f);
+        const VectorRegister4Float VMinWaterDepth = VectorSetFloat1(MinWaterDepth);
+        const VectorRegister4Float VFalloffRange = VectorSetFloat1(MinWaterDepth * 4.0f);
+        const VectorRegister4Float VMinFlowSpeed = VectorSetFloat1(MinFlowSpeed);
+        const VectorRegister4Float VMaxStreamPower = VectorSetFloat1(10000.0f);
+        const VectorRegister4Float VMaxSlope = VectorSetFloat1(10.0f);
+        const VectorRegister4Float VGradientMinDenominator = VectorSetFloat1(0.1f);
+        const VectorRegister4Float VMinDenominator = VectorSetFloat1(0.001f);
+        const VectorRegister4Float VErosionRate = VectorSetFloat1(Params.ErosionRate);
+        const VectorRegister4Float VDepositionRate = VectorSetFloat1(Params.DepositionRate);
+        const VectorRegister4Float VHardnessMultiplier = VectorSetFloat1(Params.HardnessMultiplier);
+        const VectorRegister4Float VSlowFlow = VectorSetFloat1(0.5f);
+        const VectorRegister4Float VMaxDeposition = VectorSetFloat1(100.0f);
+        const VectorRegister4Float VMaxErosion = VectorSetFloat1(MaxErosionRate);
+        const VectorRegister4Float VMinErosion = VectorSetFloat1(-MaxErosionRate);
+        const VectorRegister4Float VMaxThermal = VectorSetFloat1(MaxErosionRate * 0.5f);
+        const VectorRegister4Float VStableSlope = VectorSetFloat1(MaxStableSlope);
+        const VectorRegister4Float VHardnessSlope = VectorSetFloat1(HardnessSlopeMultiplier);
+        const VectorRegister4Float VThermalRate = VectorSetFloat1(ThermalErosionRate);
+        const VectorRegister4Float VSafeDelta = VectorSetFloat1(SafeDelta);
+        const VectorRegister4Float VMaxDelta = VectorSetFloat1(100.0f);
+        const VectorRegister4Float VMinDelta = VectorSetFloat1(-100.0f);
+        const VectorRegister4Float VSedimentPerHeight = VectorSetFloat1(Params.SedimentPerErodedHeight);
+
+        // Same statement order as ComputeCellReference, without fused multiply-adds, so lanes match the scalar path
+        for (; X + 4 <= Width; X += 4)
+        {
+            const VectorRegister4Float H = ErosionVectorSafeFloat(VectorLoad(Mid + X), VMinHeight, VMaxHeight);
+            const VectorRegister4Float L = ErosionVectorSafeFloat(VectorLoad(Mid + X - 1), VMinHeight, VMaxHeight);
+            const VectorRegister4Float R = ErosionVectorSafeFloat(VectorLoad(Mid + X + 1), VMinHeight, VMaxHeight);
+            const VectorRegister4Float T = ErosionVectorSafeFloat(VectorLoad(Up + X), VMinHeight, VMaxHeight);
+            const VectorRegister4Float B = ErosionVectorSafeFloat(VectorLoad(Down + X), VMinHeight, VMaxHeight);
+            const VectorRegister4Float Hardness = HardnessRow ? VectorLoad(HardnessRow + X) : VZero;
+
+            // Hydraulic: dry lanes end up with a zero falloff, so the whole block can skip it when every lane is dry
+            const VectorRegister4Float Depth = ErosionVectorSafeFloat(VectorLoad(DepthRow + X), VZero, VMaxDepth);
+            const VectorRegister4Float Falloff = ErosionVectorClamp(
+                VectorDivide(VectorSubtract(Depth, VMinWaterDepth), VFalloffRange), VZero, VOne);
+            VectorRegister4Float Hydraulic = VZero;
+            if (VectorMaskBits(VectorCompareGT(Falloff, VZero)) != 0)
+            {
+                const VectorRegister4Float VelocityX = ErosionVectorSafeFloat(VectorLoad(VelocityXRow + X), VMinVelocity, VMaxVelocity);
+                const VectorRegister4Float VelocityY = ErosionVectorSafeFloat(VectorLoad(VelocityYRow + X), VMinVelocity, VMaxVelocity);
+                const VectorRegister4Float HydraulicHardness = ErosionVectorSafeFloat(Hardness, VZero, VMaxHardness);
+
+                const VectorRegister4Float FlowSpeed = VectorMax(
+                    VectorSqrt(VectorAdd(VectorMultiply(VelocityX, VelocityX), VectorMultiply(VelocityY, VelocityY))), VMinFlowSpeed);
+                const VectorRegister4Float StreamPower = ErosionVectorSafeFloat(VectorMultiply(Depth, FlowSpeed), VZero, VMaxStreamPower);
+
+                const VectorRegister4Float GradientX = ErosionVectorSafeDivide(VectorSubtract(R, L), VTwoScale, VGradientMinDenominator);
+                const VectorRegister4Float GradientY = ErosionVectorSafeDivide(VectorSubtract(B, T), VTwoScale, VGradientMinDenominator);
+                const VectorRegister4Float Slope = VectorMin(VectorMax(VectorSqrt(VectorAdd(
+                    VectorMultiply(GradientX, GradientX), VectorMultiply(GradientY, GradientY))), VZero), VMaxSlope);
+
+                VectorRegister4Float Rate = VectorMultiply(VErosionRate, StreamPower);
+                Rate = VectorMultiply(Rate, VectorAdd(VOne, VectorMultiply(Slope, VTwo)));
+                Rate = ErosionVectorSafeDivide(Rate, VectorAdd(VOne, VectorMultiply(HydraulicHardness, VHardnessMultiplier)), VMinDenominator);
+
+                const VectorRegister4Float DepositFactor = VectorDivide(FlowSpeed, VSlowFlow);
+                const VectorRegister4Float Deposition = VectorSelect(VectorCompareLT(FlowSpeed, VSlowFlow),
+                    ErosionVectorSafeFloat(VectorMultiply(VectorMultiply(VDepositionRate, VectorSubtract(VOne, DepositFactor)), Depth),
+                                           VZero, VMaxDeposition),
+                    VZero);
+
+                Hydraulic = ErosionVectorClamp(VectorMultiply(VectorSubtract(Rate, Deposition), Falloff), VMinErosion, VMaxErosion);
+            }
+
+            // Thermal
+            const VectorRegister4Float MaxSlope = VectorMultiply(VStableSlope, VectorAdd(VOne, VectorMultiply(Hardness, VHardnessSlope)));
+            const VectorRegister4Float ExcessL = VectorMax(VZero, VectorSubtract(VectorDivide(VectorSubtract(H, L), VScale), MaxSlope));
+            const VectorRegister4Float ExcessR = VectorMax(VZero, VectorSubtract(VectorDivide(VectorSubtract(H, R), VScale), MaxSlope));
+            const VectorRegister4Float ExcessT = VectorMax(VZero, VectorSubtract(VectorDivide(VectorSubtract(H, T), VScale), MaxSlope));
+            const VectorRegister4Float ExcessB = VectorMax(VZero, VectorSubtract(VectorDivide(VectorSubtract(H, B), VScale), MaxSlope));
+            const VectorRegister4Float TotalExcess = VectorAdd(VectorAdd(VectorAdd(ExcessL, ExcessR), ExcessT), ExcessB);
+            const VectorRegister4Float ThermalLoss = ErosionVectorSafeDivide(
+                VectorMultiply(VectorMultiply(TotalExcess, VThermalRate), VScale),
+                VectorAdd(VOne, VectorMultiply(Hardness, VTwo)), VMinDenominator);
+            const VectorRegister4Float Thermal = ErosionVectorClamp(ThermalLoss, VZero, VMaxThermal);
+
+            const VectorRegister4Float HeightDelta = ErosionVectorClamp(
+                VectorMultiply(VectorAdd(Hydraulic, Thermal), VSafeDelta), VMinDelta, VMaxDelta);
+            const VectorRegister4Float NewHeight = ErosionVectorSafeFloat(VectorSubtract(H, HeightDelta), VMinHeight, VMaxHeight);
+
+            const VectorRegister4Float ChangedLanes = VectorCompareNE(NewHeight, VectorLoad(HeightRow + X));
+            const int32 ChangedMask = VectorMaskBits(ChangedLanes);
+            if (ChangedMask == 0)
+            {
+                continue;
+            }
+
+            VectorStore(NewHeight, HeightRow + X);
+            for (int32 Lane = 0; Lane < 4; Lane++)
+            {
+                if (ChangedMask & (1 << Lane))
+                {
+                    NumChanged++;
+                    GrowChangedRect(ChangedRect, X + Lane, Y);
+                }
+            }
+
+            // Like the scalar path, only cells whose height changed exchange sediment
+            if (SedimentRow)
+            {
+                const VectorRegister4Float Sediment = VectorLoad(SedimentRow + X);
+                const VectorRegister4Float Exchanged = VectorMultiply(VectorMultiply(Hydraulic, VSafeDelta), VSedimentPerHeight);
+                VectorStore(VectorSelect(ChangedLanes, VectorMax(VZero, VectorAdd(Sediment, Exchanged)), Sediment), SedimentRow + X);
+            }
+        }
+    }
+
+    // Row remainder (or the whole row when not vectorized)
+    for (; X < Width; X++)
+    {
+        const FTerrainErosionCellResult Cell = ComputeCellReference(
+            Mid[X], Mid[X - 1], Mid[X + 1], Up[X], Down[X],
+            DepthRow[X], VelocityXRow[X], VelocityYRow[X], HardnessRow ? HardnessRow[X] : 0.0f, Params);
+
+        const float NewHeight = ErosionSafeFloat(ErosionSafeFloat(Mid[X]) - Cell.HeightDelta);
+        if (NewHeight == HeightRow[X])
+        {
+            continue;
+        }
+
+        HeightRow[X] = NewHeight;
+        NumChanged++;
+        GrowChangedRect(ChangedRect, X, Y);
+
+        if (SedimentRow)
+        {
+            SedimentRow[X] = FMath::Max(0.0f, SedimentRow[X] + Cell.HydraulicErosion * SafeDelta * Params.SedimentPerErodedHeight);
+        }
+    }
+
+    return NumChanged;
+}
+
+int32 FTerrainErosionKernel::Execute(float* Heights, int32 Width, int32 Height, const FTerrainErosionInputs& Inputs,
+                                     const FTerrainErosionParams& Params, float* Sediment, FIntRect* OutChangedRect)
+{
+    if (OutChangedRect)
+    {
+        *OutChangedRect = EmptyChangedRect;
+    }
+    if (!Heights || Width <= 0 || Height <= 0 || !Inputs.WaterDepth || !Inputs.VelocityX || !Inputs.VelocityY)
+    {
+        return 0;
+    }
+
+    // Every cell reads last step's neighbours, clamp-to-edge like SampleHeightInput
+    Source.Resize(Width, Height);
+    Source.CopyFrom(Heights, Width, FIntPoint(0, 0));
+    Source.ReplicateBorder();
+
+    const int32 NumBands = FMath::DivideAndRoundUp(Height, ErosionBandRows);
+    BandChangedRects.SetNumUninitialized(NumBands, EAllowShrinking::No);
+    BandChangedCounts.SetNumUninitialized(NumBands, EAllowShrinking::No);
+
+    ParallelFor(NumBands, [&](int32 BandIndex)
+    {
+        FIntRect BandRect = EmptyChangedRect;
+        int32 BandChanged = 0;
+        const int32 EndY = FMath::Min((BandIndex + 1) * ErosionBandRows, Height);
+        for (int32 Y = BandIndex * ErosionBandRows; Y < EndY; Y++)
+        {
+            float* SedimentRow = Sediment ? Sediment + (int64)Y * Width : nullptr;
+            BandChanged += ProcessRow(Y, Heights + (int64)Y * Width, Inputs, Params, SedimentRow, BandRect);
+        }
+        BandChangedRects[BandIndex] = BandRect;
+        BandChangedCounts[BandIndex] = BandChanged;
+    }, !bParallel || NumBands < 2);
+
+    int32 NumChanged = 0;
+    FIntRect ChangedRect = EmptyChangedRect;
+    for (int32 BandIndex = 0; BandIndex < NumBands; BandIndex++)
+    {
+        if (BandChangedCounts[BandIndex] > 0)
+        {
+            NumChanged += BandChangedCounts[BandIndex];
+            GrowChangedRect(ChangedRect, BandChangedRects[BandIndex].Min.X, BandChangedRects[BandIndex].Min.Y);
+            GrowChangedRect(ChangedRect, BandChangedRects[BandIndex].Max.X, BandChangedRects[BandIndex].Max.Y);
+        }
+    }
+
+    if (OutChangedRect)
+    {
+        *OutChangedRect = ChangedRect;
+    }
+    return NumChanged;
+}
+
+// ============================================================================
+// PARITY
+// ============================================================================
+
+FTerrainErosionParity FTerrainErosionKernel::MeasureParity(const TArray<float>& Heights, const float* Sediment, int32 Width, int32 Height,
+                                                           const FTerrainErosionInputs& Inputs, const FTerrainErosionParams& Params)
+{
+    FTerrainErosionParity Parity;
+    if (Heights.Num() < Width * Height || Width <= 0 || Height <= 0)
+    {
+        return Parity;
+    }
+
+    TArray<float> Eroded = Heights;
+    TArray<float> ErodedSediment;
+    if (Sediment)
+    {
+        ErodedSediment.Append(Sediment, Width * Height);
+    }
+    else
+    {
+        ErodedSediment.SetNumZeroed(Width * Height);
+    }
+    Execute(Eroded.GetData(), Width, Height, Inputs, Params, ErodedSediment.GetData());
+
+    const float SafeDelta = FMath::Clamp(Params.DeltaTime, 0.0f, 1.0f);
+    for (int32 Y = 0; Y < Height; Y++)
+    {
+        const int32 UpY = FMath::Max(Y - 1, 0);
+        const int32 DownY = FMath::Min(Y + 1, Height - 1);
+        for (int32 X = 0; X < Width; X++)
+        {
+            const int32 Index = Y * Width + X;
+            const FTerrainErosionCellResult Cell = ComputeCellReference(
+                Heights[Index],
+                Heights[Y * Width + FMath::Max(X - 1, 0)],
+                Heights[Y * Width + FMath::Min(X + 1, Width - 1)],
+                Heights[UpY * Width + X],
+                Heights[DownY * Width + X],
+                Inputs.WaterDepth[Index], Inputs.VelocityX[Index], Inputs.VelocityY[Index],
+                Inputs.Hardness ? Inputs.Hardness[Index] : 0.0f, Params);
+
+            const float Expected = ErosionSafeFloat(ErosionSafeFloat(Heights[Index]) - Cell.HeightDelta);
+            Parity.MaxHeightError = FMath::Max(Parity.MaxHeightError, FMath::Abs(Eroded[Index] - Expected));
+
+            const float SedimentBefore = Sediment ? Sediment[Index] : 0.0f;
+            const float ExpectedSediment = Expected != Heights[Index] ?
+                FMath::Max(0.0f, SedimentBefore + Cell.HydraulicErosion * SafeDelta * Params.SedimentPerErodedHeight) : SedimentBefore;
+            Parity.MaxSedimentError = FMath::Max(Parity.MaxSedimentError, FMath::Abs(ErodedSediment[Index] - ExpectedSediment));
+        }
+    }
+    return Parity;
+}
@@ -0,0 +1,109 @@
+// TerrainErosionKernel.h - CPU port of the TerrainCompute.usf hydraulic + thermal erosion step
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GridFilter.h"
+
+// Per-step constants of the erosion kernel (TerrainParams.z, ErosionParams and DeltaTime of the shader)
+struct FTerrainErosionParams
+{
+    float TerrainScale = 100.0f;
+    float ErosionRate = 0.1f;           // ErosionParams.x
+    float DepositionRate = 0.05f;       // ErosionParams.y
+    float HardnessMultiplier = 1.0f;    // ErosionParams.w
+    float DeltaTime = 0.0f;
+
+    // Suspended sediment gained per cm of bed removed by flowing water (and lost per cm deposited)
+    float SedimentPerErodedHeight = 0.01f;
+};
+
+// Grids read by the step, all Width x Height row-major; Hardness may be null (treated as 0, as the GPU binds today)
+struct FTerrainErosionInputs
+{
+    const float* WaterDepth = nullptr;
+    const float* VelocityX = nullptr;
+    const float* VelocityY = nullptr;
+    const float* Hardness = nullptr;
+};
+
+// Height change of one cell: hydraulic (water) and thermal (slumping) parts, both before the DeltaTime scale
+struct FTerrainErosionCellResult
+{
+    float HydraulicErosion = 0.0f;      // Positive erodes, negative deposits
+    float ThermalErosion = 0.0f;        // Never negative
+    float HeightDelta = 0.0f;           // Subtracted from the height
+};
+
+// Largest per-cell differences between Execute() and the scalar reference
+struct FTerrainErosionParity
+{
+    float MaxHeightError = 0.0f;        // cm
+    float MaxSedimentError = 0.0f;
+};
+
+/**
+ * CPU implementation of the erosion pass of TerrainComputeCS (SimulationMode bit 1), for
+ * machines without a GPU. The math is a line-by-line port of CalculateErosion and
+ * CalculateThermalErosion, including the shader's safety clamps, so CPU and GPU worlds age
+ * the same way.
+ *
+ * Unlike the shader, which reads neighbours from the UAV it is writing, every cell reads the
+ * heights of the previous step (a padded copy with clamp-to-edge borders), so the result does
+ * not depend on thread scheduling. Rows are split into bands run through ParallelFor and cells
+ * are processed four at a time; each row's remainder goes through the scalar reference.
+ *
+ * Instances own the padded height copy, so keep one per terrain and reuse it across steps.
+ */
+class DRIFT_API FTerrainErosionKernel
+{
+public:
+    // Shader constants (TerrainCompute.usf)
+    static constexpr float MinTerrainScale = 0.1f;
+    static constexpr float MinWaterDepth = 0.01f;
+    static constexpr float MinFlowSpeed = 0.001f;
+    static constexpr float MaxErosionRate = 100.0f;
+    static constexpr float MaxStableSlope = 0.7f;
+    static constexpr float ThermalErosionRate = 0.1f;
+    static constexpr float HardnessSlopeMultiplier = 0.5f;
+    static constexpr float MinHeight = -100000.0f;
+    static constexpr float MaxHeight = 100000.0f;
+
+    bool bParallel = true;
+    bool bVectorized = true;
+
+    /**
+     * Runs one erosion step over Heights (Width x Height, updated in place). When Sediment is
+     * given, the hydraulic part of each wet cell's change moves between the bed and the water
+     * column at SedimentPerErodedHeight, floored at zero; heights are not limited by the
+     * sediment available, matching the shader. Returns the number of cells whose height changed
+     * and, if OutChangedRect is given, the inclusive cell rect enclosing them.
+     */
+    int32 Execute(float* Heights, int32 Width, int32 Height, const FTerrainErosionInputs& Inputs,
+                  const FTerrainErosionParams& Params, float* Sediment = nullptr, FIntRect* OutChangedRect = nullptr);
+
+    /**
+     * Scalar reference of one cell, written to follow the shader statement by statement.
+     * H is the cell's height and L/R/T/B its -X/+X/-Y/+Y neighbours (already clamped to the grid).
+     */
+    static FTerrainErosionCellResult ComputeCellReference(float H, float L, float R, float T, float B,
+                                                          float WaterDepth, float VelocityX, float VelocityY,
+                                                          float Hardness, const FTerrainErosionParams& Params);
+
+    /**
+     * Runs Execute() on copies of Heights and Sediment and compares both cell by cell against
+     * ComputeCellReference on the unmodified grids. Sediment may be null (starts at zero).
+     */
+    FTerrainErosionParity MeasureParity(const TArray<float>& Heights, const float* Sediment, int32 Width, int32 Height,
+                                        const FTerrainErosionInputs& Inputs, const FTerrainErosionParams& Params);
+
+    SIZE_T GetAllocatedSize() const { return Source.GetAllocatedSize() + BandChangedRects.GetAllocatedSize() + BandChangedCounts.GetAllocatedSize(); }
+
+private:
+    // Erodes cells [0, Width) of row Y from Source into HeightRow; returns how many changed and grows ChangedRect
+    int32 ProcessRow(int32 Y, float* HeightRow, const FTerrainErosionInputs& Inputs, const FTerrainErosionParams& Params,
+                     float* SedimentRow, FIntRect& ChangedRect) const;
+
+    FPaddedGrid Source;
+    TArray<FIntRect> BandChangedRects;
+    TArray<int32> BandChangedCounts;
+};
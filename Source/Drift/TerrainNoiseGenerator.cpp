@@ -0,0 +1,243 @@
+// TerrainNoiseGenerator.cpp - Seeded fractal heightfield generator
+#include "TerrainNoiseGenerator.h"
+#include "Async/ParallelFor.h"
+#include "Math/VectorRegister.h"
+
+namespace
+{
+    // Seed mixing for octaves and warp fields (unsigned so wraparound is well defined)
+    int32 MixSeed(int32 Seed, uint32 Salt)
+    {
+        uint32 H = (uint32)Seed * 0x9E3779B1u + Salt * 0x85EBCA77u;
+        H ^= H >> 16;
+        H *= 0x7FEB352Du;
+        H ^= H >> 15;
+        return (int32)H;
+    }
+
+    // Integer lattice hash (4 lanes)
+    FORCEINLINE VectorRegister4Int HashLattice(const VectorRegister4Int& IX, const VectorRegister4Int& IY, const VectorRegister4Int& Seed)
+    {
+        VectorRegister4Int H = VectorIntXor(
+            VectorIntMultiply(IX, VectorIntSet1(0x27D4EB2D)),
+            VectorIntMultiply(IY, VectorIntSet1(0x165667B1)));
+        H = VectorIntXor(H, Seed);
+        H = VectorIntXor(H, VectorShiftRightImmLogical(H, 15));
+        H = VectorIntMultiply(H, VectorIntSet1(0x2C1B3C6D));
+        H = VectorIntXor(H, VectorShiftRightImmLogical(H, 12));
+        return H;
+    }
+
+    // Dot product with one of the four diagonal gradients picked by the low hash bits
+    FORCEINLINE VectorRegister4Float GradientDot(const VectorRegister4Int& Hash, const VectorRegister4Float& DX, const VectorRegister4Float& DY)
+    {
+        const VectorRegister4Int One = VectorIntSet1(1);
+        const VectorRegister4Float BitX = VectorIntToFloat(VectorIntAnd(Hash, One));
+        const VectorRegister4Float BitY = VectorIntToFloat(VectorIntAnd(VectorShiftRightImmLogical(Hash, 1), One));
+
+        // Sign = 1 - 2 * bit
+        const VectorRegister4Float SignX = VectorSubtract(GlobalVectorConstants::FloatOne, VectorAdd(BitX, BitX));
+        const VectorRegister4Float SignY = VectorSubtract(GlobalVectorConstants::FloatOne, VectorAdd(BitY, BitY));
+
+        return VectorAdd(VectorMultiply(SignX, DX), VectorMultiply(SignY, DY));
+    }
+
+    // Quintic fade 6t^5 - 15t^4 + 10t^3
+    FORCEINLINE VectorRegister4Float Fade(const VectorRegister4Float& T)
+    {
+        VectorRegister4Float P = VectorSubtract(VectorMultiply(T, VectorSetFloat1(6.0f)), VectorSetFloat1(15.0f));
+        P = VectorAdd(VectorMultiply(T, P), VectorSetFloat1(10.0f));
+        return VectorMultiply(VectorMultiply(VectorMultiply(T, T), T), P);
+    }
+
+    FORCEINLINE VectorRegister4Float Lerp4(const VectorRegister4Float& A, const VectorRegister4Float& B, const VectorRegister4Float& Alpha)
+    {
+        return VectorAdd(A, VectorMultiply(Alpha, VectorSubtract(B, A)));
+    }
+
+    // 2D gradient noise in [-1, 1]
+    VectorRegister4Float GradientNoise(const VectorRegister4Float& X, const VectorRegister4Float& Y, int32 Seed)
+    {
+        const VectorRegister4Float XF = VectorFloor(X);
+        const VectorRegister4Float YF = VectorFloor(Y);
+        const VectorRegister4Float FX = VectorSubtract(X, XF);
+        const VectorRegister4Float FY = VectorSubtract(Y, YF);
+        const VectorRegister4Float FX1 = VectorSubtract(FX, GlobalVectorConstants::FloatOne);
+        const VectorRegister4Float FY1 = VectorSubtract(FY, GlobalVectorConstants::FloatOne);
+
+        const VectorRegister4Int One = VectorIntSet1(1);
+        const VectorRegister4Int IX = VectorFloatToInt(XF);
+        const VectorRegister4Int IY = VectorFloatToInt(YF);
+        const VectorRegister4Int IX1 = VectorIntAdd(IX, One);
+        const VectorRegister4Int IY1 = VectorIntAdd(IY, One);
+        const VectorRegister4Int SeedV = VectorIntSet1(Seed);
+
+        const VectorRegister4Float N00 = GradientDot(HashLattice(IX, IY, SeedV), FX, FY);
+        const VectorRegister4Float N10 = GradientDot(HashLattice(IX1, IY, SeedV), FX1, FY);
+        const VectorRegister4Float N01 = GradientDot(HashLattice(IX, IY1, SeedV), FX, FY1);
+        const VectorRegister4Float N11 = GradientDot(HashLattice(IX1, IY1, SeedV), FX1, FY1);
+
+        const VectorRegister4Float U = Fade(FX);
+        const VectorRegister4Float V = Fade(FY);
+
+        return Lerp4(Lerp4(N00, N10, U), Lerp4(N01, N11, U), V);
+    }
+
+    // Normalized fBm in [-1, 1]
+    VectorRegister4Float FractalBrownian(VectorRegister4Float X, VectorRegister4Float Y, int32 Seed, int32 Octaves, float Lacunarity, float Gain)
+    {
+        VectorRegister4Float Sum = VectorZeroFloat();
+        float Amplitude = 1.0f;
+        float AmplitudeSum = 0.0f;
+        const VectorRegister4Float LacunarityV = VectorSetFloat1(Lacunarity);
+
+        for (int32 Octave = 0; Octave < Octaves; Octave++)
+        {
+            const VectorRegister4Float N = GradientNoise(X, Y, MixSeed(Seed, Octave));
+            Sum = VectorAdd(Sum, VectorMultiply(N, VectorSetFloat1(Amplitude)));
+            AmplitudeSum += Amplitude;
+
+            Amplitude *= Gain;
+            X = VectorMultiply(X, LacunarityV);
+            Y = VectorMultiply(Y, LacunarityV);
+        }
+
+        return AmplitudeSum > 0.0f ? VectorMultiply(Sum, VectorSetFloat1(1.0f / AmplitudeSum)) : Sum;
+    }
+
+    // Musgrave ridged multifractal, remapped to [-1, 1]
+    VectorRegister4Float RidgedMultifractal(VectorRegister4Float X, VectorRegister4Float Y, int32 Seed, int32 Octaves, float Lacunarity, float Gain, float Offset)
+    {
+        VectorRegister4Float Sum = VectorZeroFloat();
+        VectorRegister4Float Weight = GlobalVectorConstants::FloatOne;
+        float Amplitude = 1.0f;
+        float AmplitudeSum = 0.0f;
+        const VectorRegister4Float LacunarityV = VectorSetFloat1(Lacunarity);
+        const VectorRegister4Float OffsetV = VectorSetFloat1(Offset);
+        const VectorRegister4Float WeightGain = VectorSetFloat1(2.0f);
+
+        for (int32 Octave = 0; Octave < Octaves; Octave++)
+        {
+            const VectorRegister4Float N = GradientNoise(X, Y, MixSeed(Seed, 0x100 + Octave));
+
+            // Sharp crests where the noise crosses zero, damped by the previous octave
+            VectorRegister4Float Signal = VectorSubtract(OffsetV, VectorAbs(N));
+            Signal = VectorMultiply(Signal, Signal);
+            Signal = VectorMultiply(Signal, Weight);
+            Weight = VectorMin(VectorMax(VectorMultiply(Signal, WeightGain), VectorZeroFloat()), GlobalVectorConstants::FloatOne);
+
+            Sum = VectorAdd(Sum, VectorMultiply(Signal, VectorSetFloat1(Amplitude)));
+            AmplitudeSum += Amplitude * Offset * Offset;
+
+            Amplitude *= Gain;
+            X = VectorMultiply(X, LacunarityV);
+            Y = VectorMultiply(Y, LacunarityV);
+        }
+
+        if (AmplitudeSum <= 0.0f)
+        {
+            return Sum;
+        }
+        return VectorSubtract(VectorMultiply(Sum, VectorSetFloat1(2.0f / AmplitudeSum)), GlobalVectorConstants::FloatOne);
+    }
+
+    // Full height response for four samples in map-normalized coordinates
+    VectorRegister4Float EvaluateHeight(const FTerrainNoiseSettings& Settings, const VectorRegister4Float& NormX, const VectorRegister4Float& NormY)
+    {
+        const VectorRegister4Float FrequencyV = VectorSetFloat1(Settings.BaseFrequency);
+        VectorRegister4Float X = VectorMultiply(NormX, FrequencyV);
+        VectorRegister4Float Y = VectorMultiply(NormY, FrequencyV);
+        const int32 Octaves = FMath::Clamp(Settings.Octaves, 1, 16);
+
+        // Domain warp: displace the lookup by a low-octave vector field
+        if (Settings.DomainWarpStrength > 0.0f && Settings.DomainWarpOctaves > 0)
+        {
+            const int32 WarpOctaves = FMath::Clamp(Settings.DomainWarpOctaves, 1, 8);
+            const VectorRegister4Float WarpX = FractalBrownian(
+                VectorAdd(X, VectorSetFloat1(17.3f)), VectorAdd(Y, VectorSetFloat1(9.1f)),
+                MixSeed(Settings.Seed, 0x200), WarpOctaves, Settings.Lacunarity, Settings.Gain);
+            const VectorRegister4Float WarpY = FractalBrownian(
+                VectorSubtract(X, VectorSetFloat1(8.7f)), VectorAdd(Y, VectorSetFloat1(31.9f)),
+                MixSeed(Settings.Seed, 0x300), WarpOctaves, Settings.Lacunarity, Settings.Gain);
+
+            const VectorRegister4Float StrengthV = VectorSetFloat1(Settings.DomainWarpStrength);
+            X = VectorAdd(X, VectorMultiply(WarpX, StrengthV));
+            Y = VectorAdd(Y, VectorMultiply(WarpY, StrengthV));
+        }
+
+        const float RidgeBlend = FMath::Clamp(Settings.RidgeBlend, 0.0f, 1.0f);
+        VectorRegister4Float Response;
+
+        if (RidgeBlend <= 0.0f)
+        {
+            Response = FractalBrownian(X, Y, Settings.Seed, Octaves, Settings.Lacunarity, Settings.Gain);
+        }
+        else if (RidgeBlend >= 1.0f)
+        {
+            Response = RidgedMultifractal(X, Y, Settings.Seed, Octaves, Settings.Lacunarity, Settings.Gain, Settings.RidgeOffset);
+        }
+        else
+        {
+            const VectorRegister4Float Fbm = FractalBrownian(X, Y, Settings.Seed, Octaves, Settings.Lacunarity, Settings.Gain);
+            const VectorRegister4Float Ridged = RidgedMultifractal(X, Y, Settings.Seed, Octaves, Settings.Lacunarity, Settings.Gain, Settings.RidgeOffset);
+            Response = Lerp4(Fbm, Ridged, VectorSetFloat1(RidgeBlend));
+        }
+
+        return VectorMultiply(Response, VectorSetFloat1(Settings.Amplitude));
+    }
+}
+
+void FTerrainNoiseGenerator::Generate(const FTerrainNoiseSettings& Settings, int32 Width, int32 Height, TArray<float>& OutHeights)
+{
+    if (Width <= 0 || Height <= 0)
+    {
+        OutHeights.Reset();
+        return;
+    }
+
+    OutHeights.SetNumUninitialized(Width * Height);
+
+    const float InvWidth = Width > 1 ? 1.0f / (float)(Width - 1) : 0.0f;
+    const float InvHeight = Height > 1 ? 1.0f / (float)(Height - 1) : 0.0f;
+    const int32 NumBlocks = (Width + 3) / 4;
+    float* Heights = OutHeights.GetData();
+
+    // One row per work item; the row's last block is padded instead of taking a scalar tail
+    ParallelFor(Height, [&Settings, Heights, Width, NumBlocks, InvWidth, InvHeight](int32 Y)
+    {
+        const VectorRegister4Float NormY = VectorSetFloat1((float)Y * InvHeight);
+        const VectorRegister4Float InvWidthV = VectorSetFloat1(InvWidth);
+        const VectorRegister4Int LaneOffsets = MakeVectorRegisterInt(0, 1, 2, 3);
+        float* Row = Heights + (int64)Y * Width;
+
+        for (int32 Block = 0; Block < NumBlocks; Block++)
+        {
+            const int32 X0 = Block * 4;
+            const VectorRegister4Float NormX = VectorMultiply(
+                VectorIntToFloat(VectorIntAdd(VectorIntSet1(X0), LaneOffsets)), InvWidthV);
+
+            const VectorRegister4Float Result = EvaluateHeight(Settings, NormX, NormY);
+
+            if (X0 + 4 <= Width)
+            {
+                VectorStore(Result, Row + X0);
+            }
+            else
+            {
+                float Lanes[4];
+                VectorStore(Result, Lanes);
+                for (int32 Lane = 0; X0 + Lane < Width; Lane++)
+                {
+                    Row[X0 + Lane] = Lanes[Lane];
+                }
+            }
+        }
+    });
+}
+
+float FTerrainNoiseGenerator::SampleHeight(const FTerrainNoiseSettings& Settings, float NormX, float NormY)
+{
+    float Lanes[4];
+    VectorStore(EvaluateHeight(Settings, VectorSetFloat1(NormX), VectorSetFloat1(NormY)), Lanes);
+    return Lanes[0];
+}
@@ -0,0 +1,40 @@
+// TerrainNoiseGenerator.h - Seeded fractal heightfield generator
+// Gradient-noise fBm, ridged multifractal and domain warping, evaluated 4-wide and in parallel by row
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Inputs for FTerrainNoiseGenerator. All frequencies are in cycles across the whole
+ * map, so the same settings give the same landforms at every ETerrainWorldSize.
+ */
+struct FTerrainNoiseSettings
+{
+    int32 Seed = 0;
+    int32 Octaves = 6;
+    float BaseFrequency = 4.0f;         // Cycles across the map for octave 0
+    float Lacunarity = 2.0f;            // Frequency multiplier per octave
+    float Gain = 0.5f;                  // Amplitude multiplier per octave
+    float Amplitude = 1000.0f;          // World height units for a unit noise response
+    float RidgeBlend = 0.35f;           // 0 = pure fBm, 1 = pure ridged multifractal
+    float RidgeOffset = 1.0f;           // Musgrave ridge offset
+    float DomainWarpStrength = 0.35f;   // Warp displacement in octave-0 cells
+    int32 DomainWarpOctaves = 3;
+};
+
+/**
+ * Fills a row-major heightfield from FTerrainNoiseSettings.
+ *
+ * Output depends only on the settings and dimensions: rows are independent work items,
+ * every sample goes through the same 4-wide code path (rows are padded to a multiple of
+ * four rather than finished with a scalar tail), and there are no cross-row reductions,
+ * so results are bit-identical for any thread count.
+ */
+class DRIFT_API FTerrainNoiseGenerator
+{
+public:
+    static void Generate(const FTerrainNoiseSettings& Settings, int32 Width, int32 Height, TArray<float>& OutHeights);
+
+    // Single-sample reference (runs the vector kernel on one lane); for tools and spot checks
+    static float SampleHeight(const FTerrainNoiseSettings& Settings, float NormX, float NormY);
+};
@@ -0,0 +1,236 @@
+// VegetationSpatialGrid.cpp - Flat uniform grid over the terrain for vegetation density and range queries
+#include "VegetationSpatialGrid.h"
+
+void FVegetationSpatialGrid::Initialize(const FVector2D& InOrigin, const FVector2D& InSize, float InCellSize)
+{
+    Origin = InOrigin;
+    CellSize = FMath::Max(InCellSize, 1.0f);
+    InvCellSize = 1.0f / CellSize;
+    NumCellsX = FMath::Max(FMath::CeilToInt(InSize.X * InvCellSize), 1);
+    NumCellsY = FMath::Max(FMath::CeilToInt(InSize.Y * InvCellSize), 1);
+
+    CellCounts.Init(0, NumCellsX * NumCellsY);
+    CellStarts.Init(0, NumCellsX * NumCellsY + 1);
+    PackedItems.Reset();
+    PackedLocations.Reset();
+    NumOccupiedCells = 0;
+    NumItems = 0;
+    bPackedDirty = false;
+
+    UE_LOG(LogTemp, Verbose, TEXT("VegetationSpatialGrid: %dx%d cells of %.0f"), NumCellsX, NumCellsY, CellSize);
+}
+
+void FVegetationSpatialGrid::Reset()
+{
+    if (!IsInitialized())
+    {
+        return;
+    }
+
+    FMemory::Memzero(CellCounts.GetData(), CellCounts.Num() * sizeof(int32));
+    FMemory::Memzero(CellStarts.GetData(), CellStarts.Num() * sizeof(int32));
+    PackedItems.Reset();
+    PackedLocations.Reset();
+    NumOccupiedCells = 0;
+    NumItems = 0;
+    bPackedDirty = false;
+}
+
+// ============================================================================
+// CELLS
+// ============================================================================
+
+FIntPoint FVegetationSpatialGrid::GetCellCoord(const FVector& WorldLocation) const
+{
+    const int32 CellX = FMath::FloorToInt32((WorldLocation.X - Origin.X) * InvCellSize);
+    const int32 CellY = FMath::FloorToInt32((WorldLocation.Y - Origin.Y) * InvCellSize);
+    return FIntPoint(FMath::Clamp(CellX, 0, NumCellsX - 1), FMath::Clamp(CellY, 0, NumCellsY - 1));
+}
+
+int32 FVegetationSpatialGrid::GetCellIndex(const FVector& WorldLocation) const
+{
+    if (!IsInitialized())
+    {
+        return INDEX_NONE;
+    }
+
+    const FIntPoint Cell = GetCellCoord(WorldLocation);
+    return Cell.X + Cell.Y * NumCellsX;
+}
+
+FIntRect FVegetationSpatialGrid::GetCellRange(const FVector2D& Min, const FVector2D& Max) const
+{
+    // Inclusive cell bounds, clamped like GetCellCoord
+    const FIntPoint MinCell = GetCellCoord(FVector(Min, 0.0));
+    const FIntPoint MaxCell = GetCellCoord(FVector(Max, 0.0));
+    return FIntRect(MinCell, MaxCell);
+}
+
+int32 FVegetationSpatialGrid::CountInCellNeighborhood(const FVector& WorldLocation, int32 CellRadius) const
+{
+    if (!IsInitialized())
+    {
+        return 0;
+    }
+
+    const FIntPoint Center = GetCellCoord(WorldLocation);
+    const int32 MinX = FMath::Max(Center.X - CellRadius, 0);
+    const int32 MaxX = FMath::Min(Center.X + CellRadius, NumCellsX - 1);
+    const int32 MinY = FMath::Max(Center.Y - CellRadius, 0);
+    const int32 MaxY = FMath::Min(Center.Y + CellRadius, NumCellsY - 1);
+
+    int32 Count = 0;
+    for (int32 Y = MinY; Y <= MaxY; Y++)
+    {
+        const int32* Row = CellCounts.GetData() + Y * NumCellsX;
+        for (int32 X = MinX; X <= MaxX; X++)
+        {
+            Count += Row[X];
+        }
+    }
+    return Count;
+}
+
+// ============================================================================
+// INCREMENTAL BOOKKEEPING
+// ============================================================================
+
+void FVegetationSpatialGrid::AddItem(const FVector& WorldLocation)
+{
+    const int32 CellIndex = GetCellIndex(WorldLocation);
+    if (CellIndex == INDEX_NONE)
+    {
+        return;
+    }
+
+    if (CellCounts[CellIndex]++ == 0)
+    {
+        NumOccupiedCells++;
+    }
+    NumItems++;
+    bPackedDirty = true;
+}
+
+void FVegetationSpatialGrid::RemoveItem(const FVector& WorldLocation)
+{
+    const int32 CellIndex = GetCellIndex(WorldLocation);
+    if (CellIndex == INDEX_NONE || CellCounts[CellIndex] == 0)
+    {
+        return;
+    }
+
+    if (--CellCounts[CellIndex] == 0)
+    {
+        NumOccupiedCells--;
+    }
+    NumItems--;
+    bPackedDirty = true;
+}
+
+// ============================================================================
+// PACKED LAYOUT
+// ============================================================================
+
+void FVegetationSpatialGrid::Rebuild(int32 InNumItems, TFunctionRef<FVector(int32)> GetLocation,
+                                     TFunctionRef<FVegetationHandle(int32)> GetHandle)
+{
+    if (!IsInitialized())
+    {
+        return;
+    }
+
+    const int32 NumCells = CellCounts.Num();
+    InNumItems = FMath::Max(InNumItems, 0);
+
+    // Pass 1: bin every item and recount (counts become authoritative again)
+    FMemory::Memzero(CellCounts.GetData(), NumCells * sizeof(int32));
+    ItemCells.SetNumUninitialized(InNumItems, EAllowShrinking::No);
+    PackedLocations.SetNumUninitialized(InNumItems, EAllowShrinking::No);
+    PackedItems.SetNumUninitialized(InNumItems, EAllowShrinking::No);
+
+    for (int32 Item = 0; Item < InNumItems; Item++)
+    {
+        const int32 CellIndex = GetCellIndex(GetLocation(Item));
+        ItemCells[Item] = CellIndex;
+        CellCounts[CellIndex]++;
+    }
+
+    // Pass 2: exclusive prefix sum
+    NumOccupiedCells = 0;
+    int32 Running = 0;
+    for (int32 Cell = 0; Cell < NumCells; Cell++)
+    {
+        CellStarts[Cell] = Running;
+        Running += CellCounts[Cell];
+        NumOccupiedCells += CellCounts[Cell] > 0 ? 1 : 0;
+    }
+    CellStarts[NumCells] = Running;
+
+    // Pass 3: scatter (stable, so items stay in owner order within a cell)
+    TArray<int32> Cursor(CellStarts.GetData(), NumCells);
+    for (int32 Item = 0; Item < InNumItems; Item++)
+    {
+        const int32 Dest = Cursor[ItemCells[Item]]++;
+        PackedItems[Dest] = GetHandle(Item);
+        PackedLocations[Dest] = GetLocation(Item);
+    }
+
+    NumItems = InNumItems;
+    bPackedDirty = false;
+}
+
+void FVegetationSpatialGrid::QueryRadius(const FVector& Center, float Radius, TArray<FVegetationHandle>& OutItems) const
+{
+    if (!IsInitialized() || Radius < 0.0f)
+    {
+        return;
+    }
+
+    ensureMsgf(!bPackedDirty, TEXT("VegetationSpatialGrid queried before Rebuild()"));
+
+    const FIntRect Cells = GetCellRange(FVector2D(Center) - Radius, FVector2D(Center) + Radius);
+    const double RadiusSq = FMath::Square(static_cast<double>(Radius));
+
+    for (int32 Y = Cells.Min.Y; Y <= Cells.Max.Y; Y++)
+    {
+        // Cells in a row are adjacent in the packed arrays, so each row is one contiguous span
+        const int32 Begin = CellStarts[Y * NumCellsX + Cells.Min.X];
+        const int32 End = CellStarts[Y * NumCellsX + Cells.Max.X + 1];
+
+        for (int32 i = Begin; i < End; i++)
+        {
+            if (FVector::DistSquared(PackedLocations[i], Center) <= RadiusSq)
+            {
+                OutItems.Add(PackedItems[i]);
+            }
+        }
+    }
+}
+
+void FVegetationSpatialGrid::QueryRect(const FBox2D& Rect, TArray<FVegetationHandle>& OutItems) const
+{
+    if (!IsInitialized() || !Rect.bIsValid)
+    {
+        return;
+    }
+
+    ensureMsgf(!bPackedDirty, TEXT("VegetationSpatialGrid queried before Rebuild()"));
+
+    const FIntRect Cells = GetCellRange(Rect.Min, Rect.Max);
+
+    for (int32 Y = Cells.Min.Y; Y <= Cells.Max.Y; Y++)
+    {
+        const int32 Begin = CellStarts[Y * NumCellsX + Cells.Min.X];
+        const int32 End = CellStarts[Y * NumCellsX + Cells.Max.X + 1];
+
+        for (int32 i = Begin; i < End; i++)
+        {
+            const FVector& Location = PackedLocations[i];
+            if (Location.X >= Rect.Min.X && Location.X <= Rect.Max.X &&
+                Location.Y >= Rect.Min.Y && Location.Y <= Rect.Max.Y)
+            {
+                OutItems.Add(PackedItems[i]);
+            }
+        }
+    }
+}
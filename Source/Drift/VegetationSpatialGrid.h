@@ -0,0 +1,86 @@
+// VegetationSpatialGrid.h - Flat uniform grid over the terrain for vegetation density and range queries
+// Per-cell counts are maintained incrementally; the packed item layout is rebuilt with a counting sort
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Stable reference to an item in a slot-mapped vegetation store.
+ * Survives swap-removal of other items; goes stale (generation mismatch) once its own
+ * item is removed, even if the slot is reused. The owning store resolves it.
+ */
+struct FVegetationHandle
+{
+    int32 Slot = INDEX_NONE;
+    uint32 Generation = 0;
+
+    bool IsSet() const { return Slot != INDEX_NONE; }
+    bool operator==(const FVegetationHandle& Other) const { return Slot == Other.Slot && Generation == Other.Generation; }
+};
+
+/**
+ * Dense grid covering the terrain bounds, laid out CSR-style:
+ * - CellStarts[Cell] .. CellStarts[Cell + 1] is the cell's range in PackedItems
+ * - PackedItems / PackedLocations hold item handles and their positions, sorted by cell,
+ *   so range queries walk contiguous memory. Handles (not the owner's array indices) keep
+ *   query results valid while the owner swap-removes other items
+ *
+ * Add/Remove only touch the per-cell counts (O(1), always exact) and mark the packed
+ * layout stale. Rebuild() re-sorts every item in O(items + cells) with no per-cell
+ * allocations. Locations outside the bounds clamp to the border cells.
+ */
+class DRIFT_API FVegetationSpatialGrid
+{
+public:
+    void Initialize(const FVector2D& InOrigin, const FVector2D& InSize, float InCellSize);
+    void Reset();
+    bool IsInitialized() const { return NumCellsX > 0; }
+
+    // ===== CELLS =====
+
+    FIntPoint GetCellCoord(const FVector& WorldLocation) const;
+    int32 GetCellIndex(const FVector& WorldLocation) const;
+    int32 GetCellCount(int32 CellIndex) const { return CellCounts.IsValidIndex(CellIndex) ? CellCounts[CellIndex] : 0; }
+    int32 GetNumCells() const { return CellCounts.Num(); }
+    int32 GetNumOccupiedCells() const { return NumOccupiedCells; }
+    int32 GetNumItems() const { return NumItems; }
+    float GetCellSize() const { return CellSize; }
+
+    // Items in the (2 * CellRadius + 1)^2 block of cells around the location; counts only, always current
+    int32 CountInCellNeighborhood(const FVector& WorldLocation, int32 CellRadius) const;
+
+    // ===== INCREMENTAL BOOKKEEPING =====
+
+    void AddItem(const FVector& WorldLocation);
+    void RemoveItem(const FVector& WorldLocation);
+
+    // ===== PACKED LAYOUT =====
+
+    bool NeedsRebuild() const { return bPackedDirty; }
+
+    // Counting sort of items [0, InNumItems); queries return GetHandle(Item) for each hit
+    void Rebuild(int32 InNumItems, TFunctionRef<FVector(int32)> GetLocation, TFunctionRef<FVegetationHandle(int32)> GetHandle);
+
+    // Require an up-to-date packed layout (see NeedsRebuild)
+    void QueryRadius(const FVector& Center, float Radius, TArray<FVegetationHandle>& OutItems) const;
+    void QueryRect(const FBox2D& Rect, TArray<FVegetationHandle>& OutItems) const;
+
+private:
+    FIntRect GetCellRange(const FVector2D& Min, const FVector2D& Max) const;
+
+    FVector2D Origin = FVector2D::ZeroVector;
+    float CellSize = 1000.0f;
+    float InvCellSize = 1.0f / 1000.0f;
+    int32 NumCellsX = 0;
+    int32 NumCellsY = 0;
+
+    TArray<int32> CellCounts;
+    int32 NumOccupiedCells = 0;
+    int32 NumItems = 0;
+
+    TArray<int32> CellStarts;               // NumCells + 1 prefix sums
+    TArray<FVegetationHandle> PackedItems;
+    TArray<FVector> PackedLocations;
+    TArray<int32> ItemCells;                // Rebuild scratch
+    bool bPackedDirty = true;
+};
@@ -0,0 +1,389 @@
+// WaterPostPass.cpp - Fused per-tile pass producing foam, texture staging and chunk aggregates from the water grid
+#include "WaterPostPass.h"
+#include "GPUUploadStaging.h"
+#include "Algo/BinarySearch.h"
+#include "Algo/Unique.h"
+#include "Async/ParallelFor.h"
+
+// ============================================================================
+// DEPTH ENCODING
+// ============================================================================
+
+FWaterDepthEncoding::FWaterDepthEncoding(float MinWaterDepth, float DepthScale, bool bInUseGamma, float InGamma)
+    : TransitionStart(MinWaterDepth * 0.5f)   // Start fading in
+    , TransitionEnd(MinWaterDepth * 2.0f)     // Fully visible
+    , InvDepthScale(DepthScale != 0.0f ? 1.0f / DepthScale : 0.0f)
+    , Gamma(InGamma)
+    , bUseGamma(bInUseGamma)
+{
+    InvTransitionRange = TransitionEnd > TransitionStart ? 1.0f / (TransitionEnd - TransitionStart) : 0.0f;
+}
+
+// ============================================================================
+// LAYOUT
+// ============================================================================
+
+void FWaterPostPass::FAxisLayout::Build(int32 Size, int32 InTileSize, int32 NumChunks, int32 InChunkStride, int32 InChunkSize)
+{
+    const int32 NumTiles = FMath::DivideAndRoundUp(Size, InTileSize);
+
+    TArray<int32> ChunkBegin;
+    TArray<int32> ChunkEnd;
+    ChunkBegin.SetNumUninitialized(NumChunks);
+    ChunkEnd.SetNumUninitialized(NumChunks);
+    for (int32 Chunk = 0; Chunk < NumChunks; Chunk++)
+    {
+        ChunkBegin[Chunk] = FMath::Min(Chunk * InChunkStride, Size);
+        ChunkEnd[Chunk] = FMath::Min(Chunk * InChunkStride + InChunkSize, Size);
+    }
+
+    // Piece edges: every tile line plus every chunk edge
+    PieceEdges.Reset();
+    for (int32 Edge = 0; Edge < Size; Edge += InTileSize)
+    {
+        PieceEdges.Add(Edge);
+    }
+    PieceEdges.Add(Size);
+    PieceEdges.Append(ChunkBegin);
+    PieceEdges.Append(ChunkEnd);
+    PieceEdges.Sort();
+    PieceEdges.SetNum(Algo::Unique(PieceEdges));
+
+    PieceOfCell.SetNumUninitialized(Size);
+    for (int32 Piece = 0; Piece < NumPieces(); Piece++)
+    {
+        for (int32 Cell = PieceEdges[Piece]; Cell < PieceEdges[Piece + 1]; Cell++)
+        {
+            PieceOfCell[Cell] = Piece;
+        }
+    }
+
+    ChunkPieceBegin.SetNumUninitialized(NumChunks);
+    ChunkPieceEnd.SetNumUninitialized(NumChunks);
+    for (int32 Chunk = 0; Chunk < NumChunks; Chunk++)
+    {
+        ChunkPieceBegin[Chunk] = Algo::LowerBound(PieceEdges, ChunkBegin[Chunk]);
+        ChunkPieceEnd[Chunk] = FMath::Max(Algo::LowerBound(PieceEdges, ChunkEnd[Chunk]), ChunkPieceBegin[Chunk]);
+    }
+
+    TilePieceBegin.SetNumUninitialized(NumTiles);
+    TilePieceEnd.SetNumUninitialized(NumTiles);
+    TileChunkBegin.SetNumUninitialized(NumTiles);
+    TileChunkEnd.SetNumUninitialized(NumTiles);
+    for (int32 Tile = 0; Tile < NumTiles; Tile++)
+    {
+        const int32 Begin = Tile * InTileSize;
+        const int32 End = FMath::Min(Begin + InTileSize, Size);
+        TilePieceBegin[Tile] = Algo::LowerBound(PieceEdges, Begin);
+        TilePieceEnd[Tile] = Algo::LowerBound(PieceEdges, End);
+
+        // Chunk begins and ends are both nondecreasing, so the overlapping chunks are contiguous
+        TileChunkBegin[Tile] = Algo::UpperBound(ChunkEnd, Begin);
+        TileChunkEnd[Tile] = Algo::LowerBound(ChunkBegin, End);
+    }
+}
+
+void FWaterPostPass::Initialize(int32 InWidth, int32 InHeight, int32 InTileSize, int32 InChunksX, int32 InChunksY,
+                                int32 InChunkStride, int32 InChunkSize)
+{
+    Width = FMath::Max(InWidth, 0);
+    Height = FMath::Max(InHeight, 0);
+    TileSize = FMath::Max(InTileSize, 1);
+    ChunksX = FMath::Max(InChunksX, 0);
+    ChunksY = FMath::Max(InChunksY, 0);
+    ChunkStride = FMath::Max(InChunkStride, 1);
+    ChunkSize = FMath::Max(InChunkSize, 1);
+    TilesX = Width > 0 && Height > 0 ? FMath::DivideAndRoundUp(Width, TileSize) : 0;
+    TilesY = TilesX > 0 ? FMath::DivideAndRoundUp(Height, TileSize) : 0;
+
+    AxisX.Build(Width, TileSize, ChunksX, ChunkStride, ChunkSize);
+    AxisY.Build(Height, TileSize, ChunksY, ChunkStride, ChunkSize);
+
+    Pieces.SetNum(AxisX.NumPieces() * AxisY.NumPieces());
+    ChunkStats.Reset();
+    ChunkStats.SetNum(ChunksX * ChunksY);
+    DirtyChunks.SetNumZeroed(ChunksX * ChunksY);
+    ReportedWetCells.Init(INDEX_NONE, ChunksX * ChunksY);
+    ReportedMaxDepth.Init(0.0f, ChunksX * ChunksY);
+    OccupancyPending.SetNumZeroed(ChunksX * ChunksY);
+    OccupancyPendingList.Reset();
+    TileWork.SetNumZeroed(TilesX * TilesY);
+    WorkTileList.Reset();
+
+    for (uint8& Work : TileWork)
+    {
+        Work = Work_ChunkStats;
+    }
+}
+
+bool FWaterPostPass::Matches(int32 InWidth, int32 InHeight, int32 InTileSize, int32 InChunksX, int32 InChunksY,
+                             int32 InChunkStride, int32 InChunkSize) const
+{
+    return IsInitialized() && Width == InWidth && Height == InHeight && TileSize == InTileSize &&
+           ChunksX == InChunksX && ChunksY == InChunksY && ChunkStride == InChunkStride && ChunkSize == InChunkSize;
+}
+
+void FWaterPostPass::MarkCells(const FIntRect& CellRect, uint8 Work)
+{
+    const int32 MinX = FMath::Max(CellRect.Min.X, 0);
+    const int32 MinY = FMath::Max(CellRect.Min.Y, 0);
+    const int32 MaxX = FMath::Min(CellRect.Max.X, Width - 1);
+    const int32 MaxY = FMath::Min(CellRect.Max.Y, Height - 1);
+    if (MaxX < MinX || MaxY < MinY)
+    {
+        return;
+    }
+
+    for (int32 TileY = MinY / TileSize; TileY <= MaxY / TileSize; TileY++)
+    {
+        for (int32 TileX = MinX / TileSize; TileX <= MaxX / TileSize; TileX++)
+        {
+            TileWork[TileY * TilesX + TileX] |= Work;
+        }
+    }
+}
+
+void FWaterPostPass::ConsumeOccupancyChanges(float DepthTolerance, TFunctionRef<void(int32)> Visit)
+{
+    for (int32 ChunkIndex : OccupancyPendingList)
+    {
+        OccupancyPending[ChunkIndex] = 0;
+
+        const FWaterChunkStats& Stats = ChunkStats[ChunkIndex];
+        if (Stats.WetCells != ReportedWetCells[ChunkIndex] ||
+            FMath::Abs(Stats.MaxDepth - ReportedMaxDepth[ChunkIndex]) > DepthTolerance)
+        {
+            ReportedWetCells[ChunkIndex] = Stats.WetCells;
+            ReportedMaxDepth[ChunkIndex] = Stats.MaxDepth;
+            Visit(ChunkIndex);
+        }
+    }
+    OccupancyPendingList.Reset();
+}
+
+SIZE_T FWaterPostPass::GetAllocatedSize() const
+{
+    return TileWork.GetAllocatedSize() + WorkTileList.GetAllocatedSize() + Pieces.GetAllocatedSize() +
+           ChunkStats.GetAllocatedSize() + DirtyChunks.GetAllocatedSize() +
+           ReportedWetCells.GetAllocatedSize() + ReportedMaxDepth.GetAllocatedSize() +
+           OccupancyPending.GetAllocatedSize() + OccupancyPendingList.GetAllocatedSize() +
+           AxisX.PieceOfCell.GetAllocatedSize() + AxisY.PieceOfCell.GetAllocatedSize();
+}
+
+// ============================================================================
+// EXECUTION
+// ============================================================================
+
+void FWaterPostPass::Execute(const FWaterPostPassInputs& Inputs, const FWaterPostPassOutputs& Outputs)
+{
+    NumTilesLastExecute = 0;
+    if (!IsInitialized() || !Inputs.Depth || !Inputs.VelocityX || !Inputs.VelocityY)
+    {
+        return;
+    }
+
+    WorkTileList.Reset();
+    for (int32 TileIndex = 0; TileIndex < TileWork.Num(); TileIndex++)
+    {
+        if (TileWork[TileIndex])
+        {
+            WorkTileList.Add(TileIndex);
+        }
+    }
+    NumTilesLastExecute = WorkTileList.Num();
+
+    // Tiles own disjoint cells and pieces, so they run independently
+    ParallelFor(WorkTileList.Num(), [this, &Inputs, &Outputs](int32 ListIndex)
+    {
+        const int32 TileIndex = WorkTileList[ListIndex];
+        ProcessTile(TileIndex, TileWork[TileIndex], Inputs, Outputs);
+    }, WorkTileList.Num() < 4);
+
+    // Chunks above rebuilt pieces are recombined once each
+    TArray<int32, TInlineAllocator<64>> ChunksToRecombine;
+    for (int32 TileIndex : WorkTileList)
+    {
+        if (TileWork[TileIndex] & Work_ChunkStats)
+        {
+            const int32 TileX = TileIndex % TilesX;
+            const int32 TileY = TileIndex / TilesX;
+            for (int32 ChunkY = AxisY.TileChunkBegin[TileY]; ChunkY < AxisY.TileChunkEnd[TileY]; ChunkY++)
+            {
+                for (int32 ChunkX = AxisX.TileChunkBegin[TileX]; ChunkX < AxisX.TileChunkEnd[TileX]; ChunkX++)
+                {
+                    const int32 ChunkIndex = ChunkY * ChunksX + ChunkX;
+                    if (!DirtyChunks[ChunkIndex])
+                    {
+                        DirtyChunks[ChunkIndex] = 1;
+                        ChunksToRecombine.Add(ChunkIndex);
+                    }
+                }
+            }
+        }
+        TileWork[TileIndex] = 0;
+    }
+
+    for (int32 ChunkIndex : ChunksToRecombine)
+    {
+        RecombineChunk(ChunkIndex);
+        DirtyChunks[ChunkIndex] = 0;
+    }
+}
+
+void FWaterPostPass::ProcessTile(int32 TileIndex, uint8 Work, const FWaterPostPassInputs& Inputs, const FWaterPostPassOutputs& Outputs)
+{
+    const int32 TileX = TileIndex % TilesX;
+    const int32 TileY = TileIndex / TilesX;
+    const int32 StartX = TileX * TileSize;
+    const int32 StartY = TileY * TileSize;
+    const int32 EndX = FMath::Min(StartX + TileSize, Width);
+    const int32 EndY = FMath::Min(StartY + TileSize, Height);
+    const int32 NumPiecesX = AxisX.NumPieces();
+
+    const bool bFoam = (Work & Work_Foam) && Outputs.Foam;
+    const bool bStats = (Work & Work_ChunkStats) != 0;
+    const bool bTexels = (Work & Work_DepthTexels) && Outputs.DepthTexels;
+    const bool bErosion = (Work & Work_ErosionStaging) && Outputs.ErosionDepth && Outputs.ErosionVelocity && Outputs.ErosionSediment;
+
+    if (bStats)
+    {
+        for (int32 PieceY = AxisY.TilePieceBegin[TileY]; PieceY < AxisY.TilePieceEnd[TileY]; PieceY++)
+        {
+            for (int32 PieceX = AxisX.TilePieceBegin[TileX]; PieceX < AxisX.TilePieceEnd[TileX]; PieceX++)
+            {
+                Pieces[PieceY * NumPiecesX + PieceX] = FPieceStats();
+            }
+        }
+    }
+
+    // Foam reads one cell around it and is not defined on the grid border
+    const int32 FoamStartX = FMath::Max(StartX, 1);
+    const int32 FoamEndX = FMath::Min(EndX, Width - 1);
+
+    for (int32 Y = StartY; Y < EndY; Y++)
+    {
+        const int32 RowOffset = Y * Width;
+        const float* Depth = Inputs.Depth + RowOffset;
+        const float* VelX = Inputs.VelocityX + RowOffset;
+        const float* VelY = Inputs.VelocityY + RowOffset;
+        const bool bFoamRow = bFoam && Y > 0 && Y < Height - 1;
+        FPieceStats* PieceRow = bStats ? Pieces.GetData() + AxisY.PieceOfCell[Y] * NumPiecesX : nullptr;
+
+        for (int32 X = StartX; X < EndX; X++)
+        {
+            const float WaterDepth = Depth[X];
+
+            // ===== FOAM =====
+            if (bFoamRow && X >= FoamStartX && X < FoamEndX)
+            {
+                float TotalFoam = 0.0f;
+                if (WaterDepth >= Inputs.WetDepth)
+                {
+                    // Edge foam (shallow water)
+                    const float EdgeFoam = 1.0f - FMath::Clamp(WaterDepth / 0.5f, 0.0f, 1.0f);
+
+                    // Velocity foam (turbulence)
+                    const float FlowSpeed = FMath::Sqrt(VelX[X] * VelX[X] + VelY[X] * VelY[X]);
+                    const float VelocityFoam = FMath::Clamp(FlowSpeed / 20.0f, 0.0f, 1.0f);
+
+                    // Flow convergence foam (where flows meet)
+                    const float Divergence = (VelX[X + 1] - VelX[X - 1]) + (VelY[X + Width] - VelY[X - Width]);
+                    const float ConvergenceFoam = FMath::Clamp(-Divergence * 5.0f, 0.0f, 1.0f);
+
+                    // Terrain slope foam (waterfalls)
+                    float SlopeFoam = 0.0f;
+                    if (Inputs.TerrainHeights)
+                    {
+                        const float* Heights = Inputs.TerrainHeights + RowOffset + X;
+                        const float MaxGradient = FMath::Max(
+                            FMath::Max(FMath::Abs(Heights[0] - Heights[-1]), FMath::Abs(Heights[0] - Heights[1])),
+                            FMath::Max(FMath::Abs(Heights[0] - Heights[-Width]), FMath::Abs(Heights[0] - Heights[Width])));
+                        SlopeFoam = FMath::Clamp(MaxGradient / 100.0f, 0.0f, 1.0f);
+                    }
+
+                    // Combine foam factors
+                    TotalFoam = FMath::Clamp(EdgeFoam + VelocityFoam * 0.5f + ConvergenceFoam + SlopeFoam, 0.0f, 1.0f);
+                }
+                Outputs.Foam[RowOffset + X] = TotalFoam;
+            }
+
+            // ===== CHUNK AGGREGATES =====
+            if (bStats)
+            {
+                FPieceStats& Piece = PieceRow[AxisX.PieceOfCell[X]];
+                Piece.MaxDepth = FMath::Max(Piece.MaxDepth, WaterDepth);
+                if (WaterDepth > Inputs.WetDepth)
+                {
+                    Piece.WetDepthSum += WaterDepth;
+                    Piece.WetSpeedSum += FMath::Sqrt(VelX[X] * VelX[X] + VelY[X] * VelY[X]);
+                    Piece.WetFoamSum += Outputs.Foam ? Outputs.Foam[RowOffset + X] : 0.0f;
+                    Piece.WetVelocityX += VelX[X];
+                    Piece.WetVelocityY += VelY[X];
+                    Piece.WetCells++;
+                }
+            }
+
+            // ===== DEPTH TEXTURE TEXELS =====
+            if (bTexels)
+            {
+                Outputs.DepthTexels[RowOffset + X] = Inputs.DepthEncoding.ToTexel(Inputs.DepthEncoding.Normalize(WaterDepth));
+            }
+        }
+
+        // ===== EROSION TEXTURE STAGING =====
+        // Raw copies of the rows just read, while they are still in cache
+        if (bErosion)
+        {
+            const int32 RowStart = RowOffset + StartX;
+            const SIZE_T RowBytes = (EndX - StartX) * sizeof(float);
+            FMemory::Memcpy(Outputs.ErosionDepth + RowStart, Depth + StartX, RowBytes);
+            FGPUUploadConvert::FloatPairToHalf2(VelX + StartX, VelY + StartX, Outputs.ErosionVelocity + RowStart * 2, EndX - StartX);
+            if (Inputs.Sediment)
+            {
+                FMemory::Memcpy(Outputs.ErosionSediment + RowStart, Inputs.Sediment + RowStart, RowBytes);
+            }
+            else
+            {
+                FMemory::Memzero(Outputs.ErosionSediment + RowStart, RowBytes);
+            }
+        }
+    }
+}
+
+void FWaterPostPass::RecombineChunk(int32 ChunkIndex)
+{
+    const int32 ChunkX = ChunkIndex % ChunksX;
+    const int32 ChunkY = ChunkIndex / ChunksX;
+    const int32 NumPiecesX = AxisX.NumPieces();
+
+    FPieceStats Total;
+    for (int32 PieceY = AxisY.ChunkPieceBegin[ChunkY]; PieceY < AxisY.ChunkPieceEnd[ChunkY]; PieceY++)
+    {
+        for (int32 PieceX = AxisX.ChunkPieceBegin[ChunkX]; PieceX < AxisX.ChunkPieceEnd[ChunkX]; PieceX++)
+        {
+            const FPieceStats& Piece = Pieces[PieceY * NumPiecesX + PieceX];
+            Total.MaxDepth = FMath::Max(Total.MaxDepth, Piece.MaxDepth);
+            Total.WetDepthSum += Piece.WetDepthSum;
+            Total.WetSpeedSum += Piece.WetSpeedSum;
+            Total.WetFoamSum += Piece.WetFoamSum;
+            Total.WetVelocityX += Piece.WetVelocityX;
+            Total.WetVelocityY += Piece.WetVelocityY;
+            Total.WetCells += Piece.WetCells;
+        }
+    }
+
+    FWaterChunkStats& Stats = ChunkStats[ChunkIndex];
+    const float InvWetCells = Total.WetCells > 0 ? 1.0f / Total.WetCells : 0.0f;
+    Stats.MaxDepth = Total.MaxDepth;
+    Stats.AverageDepth = Total.WetDepthSum * InvWetCells;
+    Stats.FlowDirection = FVector2D(Total.WetVelocityX, Total.WetVelocityY).GetSafeNormal();
+    Stats.FlowSpeed = Total.WetSpeedSum * InvWetCells;
+    Stats.AverageFoam = Total.WetFoamSum * InvWetCells;
+    Stats.WetCells = Total.WetCells;
+
+    if (!OccupancyPending[ChunkIndex])
+    {
+        OccupancyPending[ChunkIndex] = 1;
+        OccupancyPendingList.Add(ChunkIndex);
+    }
+}
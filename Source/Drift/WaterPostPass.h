@@ -0,0 +1,203 @@
+// WaterPostPass.h - Fused per-tile pass producing foam, texture staging and chunk aggregates from the water grid
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Math/Float16.h"
+
+// Depth-to-texel mapping of the water depth texture (smooth fade-in around MinWaterDepth, then scale and gamma)
+struct DRIFT_API FWaterDepthEncoding
+{
+    // Any water that survives the fade shows up as at least one texel step
+    static constexpr float MinVisibleValue = 1.0f / 255.0f;
+
+    FWaterDepthEncoding() = default;
+    FWaterDepthEncoding(float MinWaterDepth, float DepthScale, bool bInUseGamma, float InGamma);
+
+    // Smoothstep fade between 0.5x and 2x MinWaterDepth, so shorelines do not flicker, then 0-1 scaled
+    FORCEINLINE float Normalize(float WaterDepth) const
+    {
+        if (WaterDepth <= TransitionStart)
+        {
+            return 0.0f;
+        }
+        if (WaterDepth >= TransitionEnd)
+        {
+            return WaterDepth * InvDepthScale;
+        }
+        const float T = (WaterDepth - TransitionStart) * InvTransitionRange;
+        return WaterDepth * (T * T * (3.0f - 2.0f * T)) * InvDepthScale;
+    }
+
+    FORCEINLINE uint8 ToTexel(float Value) const
+    {
+        if (Value > 0.0f)
+        {
+            Value = FMath::Max(Value, MinVisibleValue);
+            if (bUseGamma)
+            {
+                Value = FMath::Pow(Value, Gamma);
+            }
+        }
+        return (uint8)FMath::RoundToInt(FMath::Clamp(Value * 255.0f, 0.0f, 255.0f));
+    }
+
+    float TransitionStart = 0.0f;
+    float TransitionEnd = 0.0f;
+    float InvTransitionRange = 0.0f;
+    float InvDepthScale = 1.0f;
+    float Gamma = 1.0f;
+    bool bUseGamma = false;
+};
+
+// Water over one terrain chunk's cells; "wet" means deeper than the pass's WetDepth
+struct DRIFT_API FWaterChunkStats
+{
+    float MaxDepth = 0.0f;                            // Over every cell
+    float AverageDepth = 0.0f;                        // Over wet cells
+    FVector2D FlowDirection = FVector2D::ZeroVector;  // Normalized mean wet-cell velocity
+    float FlowSpeed = 0.0f;                           // Mean wet-cell speed
+    float AverageFoam = 0.0f;                         // Mean wet-cell foam
+    int32 WetCells = 0;
+
+    bool HasWater() const { return WetCells > 0; }
+};
+
+// Grids read by the pass, all Width x Height row-major; optional ones may be null
+struct FWaterPostPassInputs
+{
+    const float* Depth = nullptr;
+    const float* VelocityX = nullptr;
+    const float* VelocityY = nullptr;
+    const float* Sediment = nullptr;         // Erosion staging; null stages zeros
+    const float* TerrainHeights = nullptr;   // Foam slope term; null leaves it out
+    float WetDepth = 0.0f;
+    FWaterDepthEncoding DepthEncoding;
+};
+
+// Buffers written by the pass (full-grid layout); a null buffer skips that output
+struct FWaterPostPassOutputs
+{
+    float* Foam = nullptr;                   // Also read back for the chunk foam average
+    float* ErosionDepth = nullptr;
+    FFloat16* ErosionVelocity = nullptr;     // Two halves per cell
+    float* ErosionSediment = nullptr;
+    uint8* DepthTexels = nullptr;
+};
+
+/**
+ * One pass over the tiles the water step touched, writing every per-cell product of the
+ * water grid together: foam, erosion texture staging, depth texture texels and per-chunk
+ * aggregates. Each tile's depth, velocity and terrain rows are read once and stay in cache
+ * for all outputs, instead of each consumer streaming the whole grid on its own.
+ *
+ * Chunk aggregates use the same two-level scheme as the atmosphere surface cache: the grid is
+ * cut along tile lines and chunk edges into pieces (terrain chunks overlap, so a cell may
+ * belong to several), tiles rebuild their own pieces in parallel, and only chunks above a
+ * processed tile are recombined from their pieces.
+ */
+class DRIFT_API FWaterPostPass
+{
+public:
+    // Work items per tile
+    enum EWork : uint8
+    {
+        Work_Foam           = 1 << 0,
+        Work_ChunkStats     = 1 << 1,
+        Work_ErosionStaging = 1 << 2,
+        Work_DepthTexels    = 1 << 3,
+    };
+
+    /**
+     * Chunk (CX, CY) covers cells [C * ChunkStride, C * ChunkStride + ChunkSize) clamped to the
+     * grid, with index CY * ChunksX + CX (the terrain chunk layout). Marks every tile for
+     * chunk stats so the first Execute() fills the table.
+     */
+    void Initialize(int32 InWidth, int32 InHeight, int32 InTileSize, int32 InChunksX, int32 InChunksY,
+                    int32 InChunkStride, int32 InChunkSize);
+
+    bool Matches(int32 InWidth, int32 InHeight, int32 InTileSize, int32 InChunksX, int32 InChunksY,
+                 int32 InChunkStride, int32 InChunkSize) const;
+
+    bool IsInitialized() const { return TilesX > 0; }
+
+    // Queue Work on every tile overlapping the inclusive cell rect
+    void MarkCells(const FIntRect& CellRect, uint8 Work);
+
+    // Runs all queued work (tiles in parallel), then recombines the chunks above stats tiles
+    void Execute(const FWaterPostPassInputs& Inputs, const FWaterPostPassOutputs& Outputs);
+
+    int32 GetNumChunks() const { return ChunkStats.Num(); }
+    const FWaterChunkStats& GetChunkStats(int32 ChunkIndex) const { return ChunkStats[ChunkIndex]; }
+    bool IsValidChunk(int32 ChunkIndex) const { return ChunkStats.IsValidIndex(ChunkIndex); }
+
+    /**
+     * Occupancy summary for consumers that rebuild per-chunk data (surface meshes): calls
+     * Visit(ChunkIndex) for every chunk recombined since the last call whose wet cell count
+     * changed, or whose max depth moved by more than DepthTolerance, since it was last
+     * reported here. Smaller changes accumulate until they cross the tolerance. Every chunk is
+     * reported once after Initialize().
+     */
+    void ConsumeOccupancyChanges(float DepthTolerance, TFunctionRef<void(int32)> Visit);
+
+    // Tiles processed by the last Execute()
+    int32 GetNumTilesLastExecute() const { return NumTilesLastExecute; }
+
+    SIZE_T GetAllocatedSize() const;
+
+private:
+    struct FPieceStats
+    {
+        float MaxDepth = 0.0f;
+        float WetDepthSum = 0.0f;
+        float WetSpeedSum = 0.0f;
+        float WetFoamSum = 0.0f;
+        float WetVelocityX = 0.0f;
+        float WetVelocityY = 0.0f;
+        int32 WetCells = 0;
+    };
+
+    // Per axis: pieces cut at tile lines and chunk edges, and which pieces / chunks each tile and chunk covers
+    struct FAxisLayout
+    {
+        TArray<int32> PieceEdges;       // NumPieces + 1 entries
+        TArray<int32> PieceOfCell;      // Per grid column/row
+        TArray<int32> ChunkPieceBegin;  // Per chunk column/row, [Begin, End)
+        TArray<int32> ChunkPieceEnd;
+        TArray<int32> TilePieceBegin;   // Per tile column/row, [Begin, End)
+        TArray<int32> TilePieceEnd;
+        TArray<int32> TileChunkBegin;   // Chunks overlapping each tile column/row, [Begin, End)
+        TArray<int32> TileChunkEnd;
+
+        void Build(int32 Size, int32 TileSize, int32 NumChunks, int32 ChunkStride, int32 ChunkSize);
+        int32 NumPieces() const { return PieceEdges.Num() - 1; }
+    };
+
+    void ProcessTile(int32 TileIndex, uint8 Work, const FWaterPostPassInputs& Inputs, const FWaterPostPassOutputs& Outputs);
+    void RecombineChunk(int32 ChunkIndex);
+
+    int32 Width = 0;
+    int32 Height = 0;
+    int32 TileSize = 0;
+    int32 TilesX = 0;
+    int32 TilesY = 0;
+    int32 ChunksX = 0;
+    int32 ChunksY = 0;
+    int32 ChunkStride = 0;
+    int32 ChunkSize = 0;
+    int32 NumTilesLastExecute = 0;
+
+    FAxisLayout AxisX;
+    FAxisLayout AxisY;
+
+    TArray<uint8> TileWork;
+    TArray<int32> WorkTileList;
+    TArray<FPieceStats> Pieces;
+    TArray<FWaterChunkStats> ChunkStats;
+    TArray<uint8> DirtyChunks;
+
+    // Occupancy as of the last ConsumeOccupancyChanges() report, and chunks recombined since
+    TArray<int32> ReportedWetCells;
+    TArray<float> ReportedMaxDepth;
+    TArray<uint8> OccupancyPending;
+    TArray<int32> OccupancyPendingList;
+};
@@ -119,6 +119,8 @@
 #include "AtmosphericSystem.h"
 #include "Engine/Engine.h"
 #include "Async/Async.h"
+#include "Async/ParallelFor.h"
+#include "Math/VectorRegister.h"
 #include "Engine/World.h"
 #include "Materials/MaterialInstanceDynamic.h"
 #include "Materials/MaterialParameterCollectionInstance.h"
@@ -135,6 +137,7 @@
 #include "RenderGraphUtils.h"
 #include "Shaders/WaveComputeShader.h"
 #include "Camera/PlayerCameraManager.h"
+#include "GridIndexBufferCache.h"
 
 // Replace all MasterController with CachedMasterController
 #define MasterController CachedMasterController
@@ -150,6 +153,8 @@ DECLARE_CYCLE_STAT(TEXT("Water System Total"), STAT_WaterSystemTotal, STATGROUP_
 DECLARE_CYCLE_STAT(TEXT("Water Physics"), STAT_WaterPhysics, STATGROUP_Game);
 DECLARE_CYCLE_STAT(TEXT("Water Rendering"), STAT_WaterRendering, STATGROUP_Game);
 DECLARE_CYCLE_STAT(TEXT("Water Textures"), STAT_WaterTextures, STATGROUP_Game);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Water Step Allocations"), STAT_WaterStepAllocations, STATGROUP_Game);
+DECLARE_MEMORY_STAT(TEXT("Water Step Allocated Bytes"), STAT_WaterStepAllocatedBytes, STATGROUP_Game);
 
 // ============================================================================
 // SECTION 1: SYSTEM LIFECYCLE
@@ -364,6 +369,9 @@ void UWaterSystem::UpdateWaterSimulation(float DeltaTime)
     // Performance timing
     float SimulationStartTime = FPlatformTime::Seconds();
     
+    // Solver buffers are persistent - anything counted here is heap traffic for this step
+    SimulationData.BeginStepAllocationTracking();
+    
     // Step 1: Track time for time-based effects
    // AccumulatedTime += DeltaTime;
    // AccumulatedScaledTime += DeltaTime * TimeScale;
@@ -374,6 +382,15 @@ void UWaterSystem::UpdateWaterSimulation(float DeltaTime)
         AccumulatePrecipitation(EffectiveDeltaTime);
     }
 
+    // Step 2b: Decide which tiles the solver passes visit this step
+    if (bUseSparseWaterSimulation && !bSparseTilesTracked)
+    {
+        // Pending marks were not maintained while sparse mode was off
+        SimulationData.MarkAllActive();
+    }
+    bSparseTilesTracked = bUseSparseWaterSimulation;
+    SimulationData.BuildActiveSpans(bUseSparseWaterSimulation);
+
     // Step 3: Calculate water flow forces
     CalculateWaterFlow(EffectiveDeltaTime);
     
@@ -396,6 +413,21 @@ void UWaterSystem::UpdateWaterSimulation(float DeltaTime)
     // Step 5: Handle evaporation and absorption
     ProcessWaterEvaporation(EffectiveDeltaTime);
     
+    // Step 5b: Carry the wet region (plus halo) over to the next step
+    RefreshActiveTiles();
+    
+    // Step 5c: Per-cell products of this step's water, on the tiles it touched
+    RunWaterPostPass(FWaterPostPass::Work_ChunkStats | FWaterPostPass::Work_ErosionStaging |
+                     (bUseShaderWater ? FWaterPostPass::Work_Foam | FWaterPostPass::Work_DepthTexels : 0));
+    
+    SET_DWORD_STAT(STAT_WaterStepAllocations, SimulationData.StepAllocationCount);
+    SET_MEMORY_STAT(STAT_WaterStepAllocatedBytes, SimulationData.StepAllocatedBytes);
+    if (SimulationData.StepAllocationCount > 0 && bEnableVerboseLogging)
+    {
+        UE_LOG(LogTemp, Verbose, TEXT("WaterSystem: Step made %d solver allocations (%lld bytes)"),
+               SimulationData.StepAllocationCount, SimulationData.StepAllocatedBytes);
+    }
+    
     // Step 6: Always maintain chunk list
         UpdateWaterSurfaceChunks();
         
@@ -408,73 +440,53 @@ void UWaterSystem::UpdateWaterSimulation(float DeltaTime)
             // Execute wave compute shader EVERY frame
             ExecuteWaveComputeShader();
             
-            // CRITICAL: Check ALL terrain chunks for water, not just existing water chunks
-            for (int32 ChunkIndex = 0; ChunkIndex < OwnerTerrain->TerrainChunks.Num(); ChunkIndex++)
+            // Only terrain chunks whose water occupancy changed get their flat mesh and area rebuilt
+            if (HasChunkWaterStatsTable())
             {
-                // Check if this chunk area has any water
-                const FTerrainChunk& TerrainChunk = OwnerTerrain->TerrainChunks[ChunkIndex];
-                const int32 TerrainChunkSize = OwnerTerrain->ChunkSize;
-                const int32 ChunkOverlap = OwnerTerrain->ChunkOverlap;
-                
-                int32 ChunkStartX = TerrainChunk.ChunkX * (TerrainChunkSize - ChunkOverlap);
-                int32 ChunkStartY = TerrainChunk.ChunkY * (TerrainChunkSize - ChunkOverlap);
-                int32 ChunkEndX = FMath::Min(ChunkStartX + TerrainChunkSize, OwnerTerrain->TerrainWidth);
-                int32 ChunkEndY = FMath::Min(ChunkStartY + TerrainChunkSize, OwnerTerrain->TerrainHeight);
-                
-                bool bChunkHasWater = false;
-                for (int32 Y = ChunkStartY; Y < ChunkEndY && !bChunkHasWater; Y++)
+                WaterPostPass.ConsumeOccupancyChanges(MinWaterDepth, [this](int32 StatsIndex)
                 {
-                    for (int32 X = ChunkStartX; X < ChunkEndX && !bChunkHasWater; X++)
+                    // Stats follow the terrain's row-major chunk order
+                    if (FindChunkWaterStats(StatsIndex) == &WaterPostPass.GetChunkStats(StatsIndex))
                     {
-                        if (GetWaterDepthSafe(X, Y) > MinWaterDepth)
-                        {
-                            bChunkHasWater = true;
-                        }
+                        RefreshDisplacedWaterChunk(StatsIndex, WaterPostPass.GetChunkStats(StatsIndex).HasWater());
                     }
-                }
-                
-                if (bChunkHasWater)
+                });
+            }
+            else
+            {
+                // No aggregate table for this terrain layout: check ALL terrain chunks for water
+                for (int32 ChunkIndex = 0; ChunkIndex < OwnerTerrain->TerrainChunks.Num(); ChunkIndex++)
                 {
-                    // Find or create water chunk
-                    FWaterSurfaceChunk* WaterChunk = WaterSurfaceChunks.FindByPredicate(
-                        [ChunkIndex](FWaterSurfaceChunk& Chunk) {
-                            return Chunk.ChunkIndex == ChunkIndex;
-                        });
-                    
-                    if (!WaterChunk)
-                    {
-                        // Create new water chunk
-                        FWaterSurfaceChunk NewChunk;
-                        NewChunk.ChunkIndex = ChunkIndex;
-                        NewChunk.ChunkX = TerrainChunk.ChunkX;
-                        NewChunk.ChunkY = TerrainChunk.ChunkY;
-                        NewChunk.bHasWater = true;
-                        NewChunk.bNeedsUpdate = true;
-                        WaterSurfaceChunks.Add(NewChunk);
-                        
-                        WaterChunk = &WaterSurfaceChunks.Last();
-                    }
-                    
-                    // Ensure chunk has mesh
-                    if (!WaterChunk->SurfaceMesh)
+                    if (GetChunkMaxDepthFromSimulation(ChunkIndex) > MinWaterDepth)
                     {
-                        InitializeGPUChunkMesh(*WaterChunk);
+                        RefreshDisplacedWaterChunk(ChunkIndex, true);
                     }
-                    
-                    // Always update mesh
-                    GenerateFlatBaseMesh(*WaterChunk);
-                    ChunkWaterAreas.Add(ChunkIndex, CalculateChunkWaterArea(ChunkIndex));
-                    
-                    // Update material parameters
-                    if (WaterChunk->SurfaceMesh)
+                }
+            }
+            
+            const float WorldTime = GetWorld()->GetTimeSeconds();
+            for (FWaterSurfaceChunk& WaterChunk : WaterSurfaceChunks)
+            {
+                if (!WaterChunk.bHasWater)
+                {
+                    continue;
+                }
+                
+                // Chunks (re)created by Step 6 without an occupancy change still need their first mesh
+                if (!WaterChunk.SurfaceMesh)
+                {
+                    GenerateFlatBaseMesh(WaterChunk);
+                    ChunkWaterAreas.Add(WaterChunk.ChunkIndex, CalculateChunkWaterArea(WaterChunk.ChunkIndex));
+                }
+                
+                // Update material parameters
+                if (WaterChunk.SurfaceMesh)
+                {
+                    UMaterialInstanceDynamic* MatInstance = Cast<UMaterialInstanceDynamic>(
+                        WaterChunk.SurfaceMesh->GetMaterial(0));
+                    if (MatInstance)
                     {
-                        UMaterialInstanceDynamic* MatInstance = Cast<UMaterialInstanceDynamic>(
-                            WaterChunk->SurfaceMesh->GetMaterial(0));
-                        if (MatInstance)
-                        {
-                            MatInstance->SetScalarParameterValue(TEXT("Time"),
-                                GetWorld()->GetTimeSeconds());
-                        }
+                        MatInstance->SetScalarParameterValue(TEXT("Time"), WorldTime);
                     }
                 }
             }
@@ -483,14 +495,9 @@ void UWaterSystem::UpdateWaterSimulation(float DeltaTime)
     // Step 8: Update shader system if enabled
     if (bUseShaderWater)
     {
-        CalculateFoamData();
         UpdateAllWaterVisuals(DeltaTime);
         UpdateWaterShaderParameters();
     }
-    if (ErosionWaterDepthRT && ErosionFlowVelocityRT)
-       {
-           UpdateErosionTextures();
-       }
 }
 
 // ===== ISCALABLESYSTEM INTERFACE IMPLEMENTATION =====
@@ -713,7 +720,8 @@ void UWaterSystem::ResetWaterSystem()
 // - Bridson, R. (2015). "Fluid Simulation for Computer Graphics" 2nd Ed.
 //
 // Performance: ~2-3ms for 513x513 grid on modern hardware
-// Threading: Game thread only (modifies shared velocity arrays)
+// Threading: Flow passes split into row bands via ParallelFor (bUseParallelWaterSolver);
+//            budget transfers to MasterController stay on the game thread
 //
 // Key Functions:
 // - CalculateWaterFlow() - Pressure gradient calculation (8-directional)
@@ -724,6 +732,190 @@ void UWaterSystem::ResetWaterSystem()
 // Authority: MasterController for water budget transfers
 // ============================================================================
 
+// ===== SPARSE ACTIVE TILES =====
+
+void FWaterSimulationData::InitializeActiveTiles()
+{
+    ActiveTilesX = FMath::DivideAndRoundUp(TerrainWidth, ActiveTileSize);
+    ActiveTilesY = FMath::DivideAndRoundUp(TerrainHeight, ActiveTileSize);
+    const int32 NumTiles = ActiveTilesX * ActiveTilesY;
+    
+    PendingActiveTiles.SetNumZeroed(NumTiles);
+    ActiveTiles.SetNumZeroed(NumTiles);
+    MarkAllActive(); // First step visits everything, then shrinks to the wet tiles
+    TileWetBounds.SetNum(NumTiles);
+    for (TArray<uint8>& Mask : ChangedTiles)
+    {
+        Mask.Init(1, NumTiles);
+    }
+    ActiveTileList.Empty(NumTiles);
+    ActiveSpans.Empty(NumTiles);
+    ActiveSpanOffsets.SetNumZeroed(ActiveTilesY + 1);
+}
+
+void FWaterSimulationData::MarkRegionActive(int32 MinX, int32 MinY, int32 MaxX, int32 MaxY)
+{
+    if (PendingActiveTiles.Num() == 0)
+    {
+        return;
+    }
+    
+    const int32 MinTileX = FMath::Clamp(MinX, 0, TerrainWidth - 1) / ActiveTileSize;
+    const int32 MinTileY = FMath::Clamp(MinY, 0, TerrainHeight - 1) / ActiveTileSize;
+    const int32 MaxTileX = FMath::Clamp(MaxX, 0, TerrainWidth - 1) / ActiveTileSize;
+    const int32 MaxTileY = FMath::Clamp(MaxY, 0, TerrainHeight - 1) / ActiveTileSize;
+    
+    for (int32 TileY = MinTileY; TileY <= MaxTileY; TileY++)
+    {
+        FMemory::Memset(&PendingActiveTiles[TileY * ActiveTilesX + MinTileX], 1, MaxTileX - MinTileX + 1);
+        
+        // External edits change depths before the tile is next visited, so consumers hear about them now
+        for (TArray<uint8>& Mask : ChangedTiles)
+        {
+            FMemory::Memset(&Mask[TileY * ActiveTilesX + MinTileX], 1, MaxTileX - MinTileX + 1);
+        }
+    }
+}
+
+void FWaterSimulationData::MarkAllActive()
+{
+    FMemory::Memset(PendingActiveTiles.GetData(), 1, PendingActiveTiles.Num());
+    for (TArray<uint8>& Mask : ChangedTiles)
+    {
+        FMemory::Memset(Mask.GetData(), 1, Mask.Num());
+    }
+}
+
+void FWaterSimulationData::BuildActiveSpans(bool bSparse)
+{
+    if (bSparse)
+    {
+        // Pending marks become this step's set; the solver refills pending as it runs
+        Swap(ActiveTiles, PendingActiveTiles);
+        FMemory::Memzero(PendingActiveTiles.GetData(), PendingActiveTiles.Num());
+    }
+    else
+    {
+        FMemory::Memset(ActiveTiles.GetData(), 1, ActiveTiles.Num());
+    }
+    
+    // Capacity is sized for every tile in InitializeActiveTiles, so these never reallocate
+    ActiveTileList.Reset();
+    ActiveSpans.Reset();
+    
+    for (int32 TileY = 0; TileY < ActiveTilesY; TileY++)
+    {
+        ActiveSpanOffsets[TileY] = ActiveSpans.Num();
+        
+        int32 SpanStartTile = INDEX_NONE;
+        for (int32 TileX = 0; TileX <= ActiveTilesX; TileX++)
+        {
+            const bool bActive = TileX < ActiveTilesX && ActiveTiles[TileY * ActiveTilesX + TileX];
+            if (bActive)
+            {
+                ActiveTileList.Add(TileY * ActiveTilesX + TileX);
+                for (TArray<uint8>& Mask : ChangedTiles)
+                {
+                    Mask[TileY * ActiveTilesX + TileX] = 1;
+                }
+                if (SpanStartTile == INDEX_NONE)
+                {
+                    SpanStartTile = TileX;
+                }
+            }
+            else if (SpanStartTile != INDEX_NONE)
+            {
+                ActiveSpans.Add(FIntPoint(SpanStartTile * ActiveTileSize,
+                                          FMath::Min(TileX * ActiveTileSize, TerrainWidth)));
+                SpanStartTile = INDEX_NONE;
+            }
+        }
+    }
+    ActiveSpanOffsets[ActiveTilesY] = ActiveSpans.Num();
+}
+
+void FWaterSimulationData::ConsumeChangedTiles(EWaterChangeConsumer Consumer, TFunctionRef<void(const FIntRect&)> Visit)
+{
+    // Water only changes in solver-visited tiles and in tiles external edits marked active
+    TArray<uint8>& Mask = ChangedTiles[(int32)Consumer];
+    for (int32 TileIndex = 0; TileIndex < Mask.Num(); TileIndex++)
+    {
+        if (Mask[TileIndex])
+        {
+            const int32 MinX = (TileIndex % ActiveTilesX) * ActiveTileSize;
+            const int32 MinY = (TileIndex / ActiveTilesX) * ActiveTileSize;
+            Visit(FIntRect(MinX, MinY,
+                           FMath::Min(MinX + ActiveTileSize, TerrainWidth) - 1,
+                           FMath::Min(MinY + ActiveTileSize, TerrainHeight) - 1));
+            Mask[TileIndex] = 0;
+        }
+    }
+}
+
+/**
+ * Marks next step's active tiles from the water present after this step.
+ * Water moves at most one cell per step and sediment then moves one more from the newly
+ * wet cells, so the wet bounding box of each active tile grown by ActiveHalo cells covers
+ * every cell the next step's passes can read or change.
+ * Cost is proportional to the active area, except for the periodic full rescan.
+ */
+void UWaterSystem::RefreshActiveTiles()
+{
+    if (!bUseSparseWaterSimulation || !SimulationData.IsValid())
+    {
+        return;
+    }
+    
+    const int32 Width = SimulationData.TerrainWidth;
+    const int32 Height = SimulationData.TerrainHeight;
+    const int32 TileSize = FWaterSimulationData::ActiveTileSize;
+    
+    // Safety net: rescan the whole grid now and then in case something wrote water without marking
+    const bool bFullRescan = SparseFullRescanInterval > 0 && ++StepsSinceFullRescan >= SparseFullRescanInterval;
+    if (bFullRescan)
+    {
+        StepsSinceFullRescan = 0;
+        SimulationData.BuildActiveSpans(false);
+    }
+    
+    const TArray<int32>& TileList = SimulationData.ActiveTileList;
+    
+    // Per-tile wet bounds can be computed independently; marking (which touches neighbours) stays serial
+    ParallelFor(TileList.Num(), [&](int32 ListIndex)
+    {
+        const int32 TileIndex = TileList[ListIndex];
+        const int32 StartX = (TileIndex % SimulationData.ActiveTilesX) * TileSize;
+        const int32 StartY = (TileIndex / SimulationData.ActiveTilesX) * TileSize;
+        const int32 EndX = FMath::Min(StartX + TileSize, Width);
+        const int32 EndY = FMath::Min(StartY + TileSize, Height);
+        
+        FIntRect WetBounds(MAX_int32, MAX_int32, MIN_int32, MIN_int32);
+        for (int32 Y = StartY; Y < EndY; Y++)
+        {
+            const float* Row = SimulationData.WaterDepthMap.GetData() + Y * Width;
+            for (int32 X = StartX; X < EndX; X++)
+            {
+                if (Row[X] > MinWaterDepth)
+                {
+                    WetBounds.Include(FIntPoint(X, Y));
+                }
+            }
+        }
+        SimulationData.TileWetBounds[TileIndex] = WetBounds;
+    });
+    
+    for (int32 TileIndex : TileList)
+    {
+        const FIntRect& WetBounds = SimulationData.TileWetBounds[TileIndex];
+        if (WetBounds.Min.X <= WetBounds.Max.X)
+        {
+            const int32 Halo = FWaterSimulationData::ActiveHalo;
+            SimulationData.MarkRegionActive(WetBounds.Min.X - Halo, WetBounds.Min.Y - Halo,
+                                            WetBounds.Max.X + Halo, WetBounds.Max.Y + Halo);
+        }
+    }
+}
+
 // ===== FLOW CALCULATION =====
 
 /**
@@ -732,7 +924,7 @@ void UWaterSystem::ResetWaterSystem()
  * ============================================
  * Algorithm: Finite difference method with pressure gradients
  * Performance: ~2-3ms for 513x513 terrain on modern hardware
- * Threading: Game thread only (modifies shared velocity arrays)
+ * Threading: Row-band parallel (bUseParallelWaterSolver), bit-identical to serial
  */
 
 /**
@@ -763,40 +955,128 @@ void UWaterSystem::CalculateWaterFlow(float DeltaTime)
         return;
     }
     
-    TArray<float> NewVelocityX = SimulationData.WaterVelocityX;
-    TArray<float> NewVelocityY = SimulationData.WaterVelocityY;
-    
     const int32 Width = SimulationData.TerrainWidth;
     const int32 Height = SimulationData.TerrainHeight;
     
-    for (int32 Y = 0; Y < Height; Y++)
+    // Write into the persistent back buffers and swap at the end (no per-step allocation).
+    // In sparse mode the update is done in place instead: a swap would expose stale
+    // back-buffer velocities in tiles that were skipped this step.
+    const bool bUpdateInPlace = bUseSparseWaterSimulation;
+    SimulationData.EnsureBuffer(SimulationData.WaterVelocityXBack, Width * Height);
+    SimulationData.EnsureBuffer(SimulationData.WaterVelocityYBack, Width * Height);
+    TArray<float>& NewVelocityX = bUpdateInPlace ? SimulationData.WaterVelocityX : SimulationData.WaterVelocityXBack;
+    TArray<float>& NewVelocityY = bUpdateInPlace ? SimulationData.WaterVelocityY : SimulationData.WaterVelocityYBack;
+    
+    // Vectorized kernel: read neighbours from a padded surface grid (terrain + water) so the
+    // stencil needs no bounds checks. Only valid when the water grid matches the heightmap.
+    const bool bUseVectorKernel = bUseVectorizedFlowKernel && bUse8DirectionalFlow && OwnerTerrain &&
+                                  OwnerTerrain->TerrainWidth == Width && OwnerTerrain->TerrainHeight == Height &&
+                                  OwnerTerrain->HeightMap.Num() == Width * Height;
+    const int32 PaddedWidth = Width + 2;
+    if (bUseVectorKernel)
+    {
+        TArray<float>& PaddedSurface = SimulationData.PaddedSurfaceMap;
+        if (PaddedSurface.Num() != PaddedWidth * (Height + 2))
+        {
+            SimulationData.EnsureBuffer(PaddedSurface, PaddedWidth * (Height + 2));
+            for (float& Value : PaddedSurface)
+            {
+                Value = MAX_flt;
+            }
+        }
+        
+        // Active spans cover every wet cell and its neighbours, so that is all the kernel reads
+        const float* TerrainHeights = OwnerTerrain->HeightMap.GetData();
+        ParallelFor(Height, [&](int32 Y)
+        {
+            for (const FIntPoint& Span : SimulationData.GetActiveSpans(Y))
+            {
+                float* SurfaceRow = &PaddedSurface[(Y + 1) * PaddedWidth + 1];
+                for (int32 X = Span.X; X < Span.Y; X++)
+                {
+                    SurfaceRow[X] = TerrainHeights[Y * Width + X] + SimulationData.WaterDepthMap[Y * Width + X];
+                }
+            }
+        }, !(bUseParallelWaterSolver && Height > ParallelSolverBandRows));
+    }
+    
+    // Each cell reads the previous velocity/depth and writes only its own new velocity,
+    // so rows are fully independent and can run on any thread in any order
+    auto ProcessCell = [&](int32 X, int32 Y)
     {
-        for (int32 X = 0; X < Width; X++)
+        int32 Index = Y * Width + X;
+        
+        if (SimulationData.WaterDepthMap[Index] <= MinWaterDepth)
         {
-            int32 Index = Y * Width + X;
-            
-            if (SimulationData.WaterDepthMap[Index] <= MinWaterDepth)
+            // Dry cells keep their velocity
+            if (!bUpdateInPlace)
             {
-                continue;
+                NewVelocityX[Index] = SimulationData.WaterVelocityX[Index];
+                NewVelocityY[Index] = SimulationData.WaterVelocityY[Index];
             }
+            return;
+        }
+        
+        float TerrainHeight = OwnerTerrain->GetHeightSafe(X, Y);
+        float WaterSurfaceHeight = TerrainHeight + SimulationData.WaterDepthMap[Index];
+        
+        float TerrainScale = OwnerTerrain ? OwnerTerrain->TerrainScale : 100.0f;
+        float ForceX = 0.0f;
+        float ForceY = 0.0f;
+        
+        // === SURFACE TENSION MODEL (FIXED) ===
+        float LowestNeighborSurface = WaterSurfaceHeight;
+        
+        // Find lowest neighbor
+        for (int32 dy = -1; dy <= 1; dy++)
+        {
+            for (int32 dx = -1; dx <= 1; dx++)
+            {
+                if (dx == 0 && dy == 0) continue;
+                
+                int32 NX = X + dx;
+                int32 NY = Y + dy;
+                
+                if (NX >= 0 && NX < Width && NY >= 0 && NY < Height)
+                {
+                    int32 NIndex = NY * Width + NX;
+                    float NTerrainHeight = OwnerTerrain->GetHeightSafe(NX, NY);
+                    float NWaterSurface = NTerrainHeight + SimulationData.WaterDepthMap[NIndex];
+                    LowestNeighborSurface = FMath::Min(LowestNeighborSurface, NWaterSurface);
+                }
+            }
+        }
+        
+        // Calculate pooling factor with surface tension
+        float PoolingFactor = 0.0f;
+        if (WaterSurfaceHeight > LowestNeighborSurface + 0.01f)
+        {
+            float DepthDiff = WaterSurfaceHeight - LowestNeighborSurface;
             
-            float TerrainHeight = OwnerTerrain->GetHeightSafe(X, Y);
-            float WaterSurfaceHeight = TerrainHeight + SimulationData.WaterDepthMap[Index];
-            
-            float TerrainScale = OwnerTerrain ? OwnerTerrain->TerrainScale : 100.0f;
-            float ForceX = 0.0f;
-            float ForceY = 0.0f;
-            
-            // === SURFACE TENSION MODEL (FIXED) ===
-            float LowestNeighborSurface = WaterSurfaceHeight;
+            if (DepthDiff > 2.0f) // 2cm depression threshold
+            {
+                PoolingFactor = FMath::Clamp(DepthDiff / 10.0f, 0.0f, 0.3f);
+                float SurfaceTensionFlow = 0.2f;
+                PoolingFactor *= (1.0f - SurfaceTensionFlow);
+            }
+        }
+        
+        // === 8-DIRECTIONAL FLOW (FIXED) ===
+        if (bUse8DirectionalFlow)
+        {
+            const float DiagonalDistance = TerrainScale * 1.41421356f;
+            const float CardinalDistance = TerrainScale;
             
-            // Find lowest neighbor
             for (int32 dy = -1; dy <= 1; dy++)
             {
                 for (int32 dx = -1; dx <= 1; dx++)
                 {
                     if (dx == 0 && dy == 0) continue;
                     
+                    bool bIsDiagonal = (dx != 0 && dy != 0);
+                    float Distance = bIsDiagonal ? DiagonalDistance : CardinalDistance;
+                    float Weight = bIsDiagonal ? 0.7071f : 1.0f;
+                    
                     int32 NX = X + dx;
                     int32 NY = Y + dy;
                     
@@ -804,134 +1084,219 @@ void UWaterSystem::CalculateWaterFlow(float DeltaTime)
                     {
                         int32 NIndex = NY * Width + NX;
                         float NTerrainHeight = OwnerTerrain->GetHeightSafe(NX, NY);
-                        float NWaterSurface = NTerrainHeight + SimulationData.WaterDepthMap[NIndex];
-                        LowestNeighborSurface = FMath::Min(LowestNeighborSurface, NWaterSurface);
+                        float NWaterHeight = NTerrainHeight + SimulationData.WaterDepthMap[NIndex];
+                        
+                        float HeightDiff = WaterSurfaceHeight - NWaterHeight;
+                        
+                        /*
+                        // Edge drainage
+                        if ((NX == 0 || NX == Width-1 || NY == 0 || NY == Height-1) &&
+                            HeightDiff > 0)
+                        {
+                            HeightDiff *= 2.0f;
+                        }
+                        */
+                        if (HeightDiff > 0.001f)
+                        {
+                            float Force = (HeightDiff * Weight) / Distance;
+                            ForceX += Force * dx;
+                            ForceY += Force * dy;
+                        }
                     }
                 }
             }
+        }
+        else
+        {
+            // 4-directional fallback
+            int32 LeftIdx = (X > 0) ? Y * Width + (X - 1) : -1;
+            int32 RightIdx = (X < Width - 1) ? Y * Width + (X + 1) : -1;
+            int32 UpIdx = (Y > 0) ? (Y - 1) * Width + X : -1;
+            int32 DownIdx = (Y < Height - 1) ? (Y + 1) * Width + X : -1;
+            
+            if (LeftIdx >= 0)
+            {
+                float NHeight = OwnerTerrain->GetHeightSafe(X-1, Y) + SimulationData.WaterDepthMap[LeftIdx];
+                float Diff = WaterSurfaceHeight - NHeight;
+                if (X == 1 && Diff > 0) Diff *= 2.0f;
+                ForceX += Diff / TerrainScale;
+            }
             
-            // Calculate pooling factor with surface tension
-            float PoolingFactor = 0.0f;
-            if (WaterSurfaceHeight > LowestNeighborSurface + 0.01f)
+            if (RightIdx >= 0)
             {
-                float DepthDiff = WaterSurfaceHeight - LowestNeighborSurface;
-                
-                if (DepthDiff > 2.0f) // 2cm depression threshold
-                {
-                    PoolingFactor = FMath::Clamp(DepthDiff / 10.0f, 0.0f, 0.3f);
-                    float SurfaceTensionFlow = 0.2f;
-                    PoolingFactor *= (1.0f - SurfaceTensionFlow);
-                }
+                float NHeight = OwnerTerrain->GetHeightSafe(X+1, Y) + SimulationData.WaterDepthMap[RightIdx];
+                float Diff = WaterSurfaceHeight - NHeight;
+                if (X == Width-2 && Diff > 0) Diff *= 2.0f;
+                ForceX -= Diff / TerrainScale;
             }
             
-            // === 8-DIRECTIONAL FLOW (FIXED) ===
-            if (bUse8DirectionalFlow)
+            if (UpIdx >= 0)
             {
-                const float DiagonalDistance = TerrainScale * 1.41421356f;
-                const float CardinalDistance = TerrainScale;
-                
-                for (int32 dy = -1; dy <= 1; dy++)
-                {
-                    for (int32 dx = -1; dx <= 1; dx++)
-                    {
-                        if (dx == 0 && dy == 0) continue;
-                        
-                        bool bIsDiagonal = (dx != 0 && dy != 0);
-                        float Distance = bIsDiagonal ? DiagonalDistance : CardinalDistance;
-                        float Weight = bIsDiagonal ? 0.7071f : 1.0f;
-                        
-                        int32 NX = X + dx;
-                        int32 NY = Y + dy;
-                        
-                        if (NX >= 0 && NX < Width && NY >= 0 && NY < Height)
-                        {
-                            int32 NIndex = NY * Width + NX;
-                            float NTerrainHeight = OwnerTerrain->GetHeightSafe(NX, NY);
-                            float NWaterHeight = NTerrainHeight + SimulationData.WaterDepthMap[NIndex];
-                            
-                            float HeightDiff = WaterSurfaceHeight - NWaterHeight;
-                            
-                            /*
-                            // Edge drainage
-                            if ((NX == 0 || NX == Width-1 || NY == 0 || NY == Height-1) &&
-                                HeightDiff > 0)
-                            {
-                                HeightDiff *= 2.0f;
-                            }
-                            */
-                            if (HeightDiff > 0.001f)
-                            {
-                                float Force = (HeightDiff * Weight) / Distance;
-                                ForceX += Force * dx;
-                                ForceY += Force * dy;
-                            }
-                        }
-                    }
-                }
+                float NHeight = OwnerTerrain->GetHeightSafe(X, Y-1) + SimulationData.WaterDepthMap[UpIdx];
+                float Diff = WaterSurfaceHeight - NHeight;
+                if (Y == 1 && Diff > 0) Diff *= 2.0f;
+                ForceY += Diff / TerrainScale;
             }
-            else
+            
+            if (DownIdx >= 0)
+            {
+                float NHeight = OwnerTerrain->GetHeightSafe(X, Y+1) + SimulationData.WaterDepthMap[DownIdx];
+                float Diff = WaterSurfaceHeight - NHeight;
+                if (Y == Height-2 && Diff > 0) Diff *= 2.0f;
+                ForceY -= Diff / TerrainScale;
+            }
+        }
+        
+        // Apply pooling reduction
+        ForceX *= (1.0f - PoolingFactor);
+        ForceY *= (1.0f - PoolingFactor);
+        
+        // Update velocities with damping
+        NewVelocityX[Index] = (SimulationData.WaterVelocityX[Index] + ForceX * WaterFlowSpeed * DeltaTime) * WaterDamping;
+        NewVelocityY[Index] = (SimulationData.WaterVelocityY[Index] + ForceY * WaterFlowSpeed * DeltaTime) * WaterDamping;
+        
+        // Clamp velocities
+        float VelMagnitude = FMath::Sqrt(NewVelocityX[Index] * NewVelocityX[Index] +
+                                        NewVelocityY[Index] * NewVelocityY[Index]);
+        if (VelMagnitude > MaxWaterVelocity)
+        {
+            float Scale = MaxWaterVelocity / VelMagnitude;
+            NewVelocityX[Index] *= Scale;
+            NewVelocityY[Index] *= Scale;
+        }
+    };
+    
+    // Same math as ProcessCell for four consecutive cells of a row (8-directional path only).
+    // Neighbours are visited in the scalar loop's order so the force sums round identically.
+    const float GridSpacing = OwnerTerrain ? OwnerTerrain->TerrainScale : 100.0f;
+    const VectorRegister4Float VZero = VectorZeroFloat();
+    const VectorRegister4Float VMinDepth = VectorSetFloat1(MinWaterDepth);
+    const VectorRegister4Float VForceThreshold = VectorSetFloat1(0.001f);
+    const VectorRegister4Float VPoolingThreshold = VectorSetFloat1(2.0f);
+    const VectorRegister4Float VPoolingDivisor = VectorSetFloat1(10.0f);
+    const VectorRegister4Float VPoolingMax = VectorSetFloat1(0.3f);
+    const VectorRegister4Float VSurfaceTension = VectorSetFloat1(1.0f - 0.2f);
+    const VectorRegister4Float VOne = VectorSetFloat1(1.0f);
+    const VectorRegister4Float VFlowSpeed = VectorSetFloat1(WaterFlowSpeed);
+    const VectorRegister4Float VDeltaTime = VectorSetFloat1(DeltaTime);
+    const VectorRegister4Float VDamping = VectorSetFloat1(WaterDamping);
+    const VectorRegister4Float VMaxVelocity = VectorSetFloat1(MaxWaterVelocity);
+    const VectorRegister4Float VCardinalDistance = VectorSetFloat1(GridSpacing);
+    const VectorRegister4Float VDiagonalDistance = VectorSetFloat1(GridSpacing * 1.41421356f);
+    const VectorRegister4Float VDiagonalWeight = VectorSetFloat1(0.7071f);
+    
+    auto ProcessFourCells = [&](int32 X, int32 Y)
+    {
+        const int32 Index = Y * Width + X;
+        const VectorRegister4Float Depth = VectorLoad(&SimulationData.WaterDepthMap[Index]);
+        const VectorRegister4Float OldVelX = VectorLoad(&SimulationData.WaterVelocityX[Index]);
+        const VectorRegister4Float OldVelY = VectorLoad(&SimulationData.WaterVelocityY[Index]);
+        const VectorRegister4Float WetMask = VectorCompareGT(Depth, VMinDepth);
+        
+        if (VectorMaskBits(WetMask) == 0)
+        {
+            // Dry cells keep their velocity
+            if (!bUpdateInPlace)
             {
-                // 4-directional fallback
-                int32 LeftIdx = (X > 0) ? Y * Width + (X - 1) : -1;
-                int32 RightIdx = (X < Width - 1) ? Y * Width + (X + 1) : -1;
-                int32 UpIdx = (Y > 0) ? (Y - 1) * Width + X : -1;
-                int32 DownIdx = (Y < Height - 1) ? (Y + 1) * Width + X : -1;
+                VectorStore(OldVelX, &NewVelocityX[Index]);
+                VectorStore(OldVelY, &NewVelocityY[Index]);
+            }
+            return;
+        }
+        
+        const float* Center = &SimulationData.PaddedSurfaceMap[(Y + 1) * PaddedWidth + (X + 1)];
+        const VectorRegister4Float Surface = VectorLoad(Center);
+        VectorRegister4Float Lowest = Surface;
+        VectorRegister4Float ForceX = VZero;
+        VectorRegister4Float ForceY = VZero;
+        
+        for (int32 dy = -1; dy <= 1; dy++)
+        {
+            for (int32 dx = -1; dx <= 1; dx++)
+            {
+                if (dx == 0 && dy == 0) continue;
                 
-                if (LeftIdx >= 0)
-                {
-                    float NHeight = OwnerTerrain->GetHeightSafe(X-1, Y) + SimulationData.WaterDepthMap[LeftIdx];
-                    float Diff = WaterSurfaceHeight - NHeight;
-                    if (X == 1 && Diff > 0) Diff *= 2.0f;
-                    ForceX += Diff / TerrainScale;
-                }
+                const bool bIsDiagonal = (dx != 0 && dy != 0);
+                const VectorRegister4Float Neighbor = VectorLoad(Center + dy * PaddedWidth + dx);
+                Lowest = VectorMin(Lowest, Neighbor);
+                
+                VectorRegister4Float HeightDiff = VectorSubtract(Surface, Neighbor);
+                VectorRegister4Float Force = bIsDiagonal
+                    ? VectorDivide(VectorMultiply(HeightDiff, VDiagonalWeight), VDiagonalDistance)
+                    : VectorDivide(HeightDiff, VCardinalDistance);
+                Force = VectorSelect(VectorCompareGT(HeightDiff, VForceThreshold), Force, VZero);
                 
-                if (RightIdx >= 0)
+                if (dx != 0)
                 {
-                    float NHeight = OwnerTerrain->GetHeightSafe(X+1, Y) + SimulationData.WaterDepthMap[RightIdx];
-                    float Diff = WaterSurfaceHeight - NHeight;
-                    if (X == Width-2 && Diff > 0) Diff *= 2.0f;
-                    ForceX -= Diff / TerrainScale;
+                    ForceX = dx > 0 ? VectorAdd(ForceX, Force) : VectorSubtract(ForceX, Force);
                 }
-                
-                if (UpIdx >= 0)
+                if (dy != 0)
                 {
-                    float NHeight = OwnerTerrain->GetHeightSafe(X, Y-1) + SimulationData.WaterDepthMap[UpIdx];
-                    float Diff = WaterSurfaceHeight - NHeight;
-                    if (Y == 1 && Diff > 0) Diff *= 2.0f;
-                    ForceY += Diff / TerrainScale;
+                    ForceY = dy > 0 ? VectorAdd(ForceY, Force) : VectorSubtract(ForceY, Force);
                 }
-                
-                if (DownIdx >= 0)
+            }
+        }
+        
+        // Pooling factor with surface tension (the 0.01 pre-check is implied by DepthDiff > 2)
+        const VectorRegister4Float DepthDiff = VectorSubtract(Surface, Lowest);
+        VectorRegister4Float PoolingFactor = VectorMultiply(
+            VectorMin(VectorMax(VectorDivide(DepthDiff, VPoolingDivisor), VZero), VPoolingMax), VSurfaceTension);
+        PoolingFactor = VectorSelect(VectorCompareGT(DepthDiff, VPoolingThreshold), PoolingFactor, VZero);
+        const VectorRegister4Float PoolingScale = VectorSubtract(VOne, PoolingFactor);
+        ForceX = VectorMultiply(ForceX, PoolingScale);
+        ForceY = VectorMultiply(ForceY, PoolingScale);
+        
+        // Update velocities with damping
+        VectorRegister4Float VelX = VectorMultiply(VectorAdd(OldVelX, VectorMultiply(VectorMultiply(ForceX, VFlowSpeed), VDeltaTime)), VDamping);
+        VectorRegister4Float VelY = VectorMultiply(VectorAdd(OldVelY, VectorMultiply(VectorMultiply(ForceY, VFlowSpeed), VDeltaTime)), VDamping);
+        
+        // Clamp velocities
+        const VectorRegister4Float VelMagnitude = VectorSqrt(VectorAdd(VectorMultiply(VelX, VelX), VectorMultiply(VelY, VelY)));
+        const VectorRegister4Float ClampMask = VectorCompareGT(VelMagnitude, VMaxVelocity);
+        const VectorRegister4Float ClampScale = VectorDivide(VMaxVelocity, VelMagnitude);
+        VelX = VectorSelect(ClampMask, VectorMultiply(VelX, ClampScale), VelX);
+        VelY = VectorSelect(ClampMask, VectorMultiply(VelY, ClampScale), VelY);
+        
+        VectorStore(VectorSelect(WetMask, VelX, OldVelX), &NewVelocityX[Index]);
+        VectorStore(VectorSelect(WetMask, VelY, OldVelY), &NewVelocityY[Index]);
+    };
+    
+    auto ProcessRow = [&](int32 Y)
+    {
+        for (const FIntPoint& Span : SimulationData.GetActiveSpans(Y))
+        {
+            int32 X = Span.X;
+            if (bUseVectorKernel)
+            {
+                for (; X + 4 <= Span.Y; X += 4)
                 {
-                    float NHeight = OwnerTerrain->GetHeightSafe(X, Y+1) + SimulationData.WaterDepthMap[DownIdx];
-                    float Diff = WaterSurfaceHeight - NHeight;
-                    if (Y == Height-2 && Diff > 0) Diff *= 2.0f;
-                    ForceY -= Diff / TerrainScale;
+                    ProcessFourCells(X, Y);
                 }
             }
-            
-            // Apply pooling reduction
-            ForceX *= (1.0f - PoolingFactor);
-            ForceY *= (1.0f - PoolingFactor);
-            
-            // Update velocities with damping
-            NewVelocityX[Index] = (SimulationData.WaterVelocityX[Index] + ForceX * WaterFlowSpeed * DeltaTime) * WaterDamping;
-            NewVelocityY[Index] = (SimulationData.WaterVelocityY[Index] + ForceY * WaterFlowSpeed * DeltaTime) * WaterDamping;
-            
-            // Clamp velocities
-            float VelMagnitude = FMath::Sqrt(NewVelocityX[Index] * NewVelocityX[Index] +
-                                            NewVelocityY[Index] * NewVelocityY[Index]);
-            if (VelMagnitude > MaxWaterVelocity)
+            for (; X < Span.Y; X++)
             {
-                float Scale = MaxWaterVelocity / VelMagnitude;
-                NewVelocityX[Index] *= Scale;
-                NewVelocityY[Index] *= Scale;
+                ProcessCell(X, Y);
             }
         }
+    };
+    
+    if (bUseParallelWaterSolver && Height > ParallelSolverBandRows)
+    {
+        ParallelFor(Height, ProcessRow);
+    }
+    else
+    {
+        for (int32 Y = 0; Y < Height; Y++)
+        {
+            ProcessRow(Y);
+        }
     }
     
-    SimulationData.WaterVelocityX = NewVelocityX;
-    SimulationData.WaterVelocityY = NewVelocityY;
+    if (!bUpdateInPlace)
+    {
+        Swap(SimulationData.WaterVelocityX, SimulationData.WaterVelocityXBack);
+        Swap(SimulationData.WaterVelocityY, SimulationData.WaterVelocityYBack);
+    }
 }
 
 // ===== FLOW APPLICATION =====
@@ -943,9 +1308,34 @@ void UWaterSystem::ApplyWaterFlow(float DeltaTime)
         return;
     }
     
-    TArray<float> NewWaterDepth = SimulationData.WaterDepthMap;
     const int32 Width = SimulationData.TerrainWidth;
     const int32 Height = SimulationData.TerrainHeight;
+    const int32 NumCells = SimulationData.WaterDepthMap.Num();
+    
+    const bool bParallel = bUseParallelWaterSolver && Height > ParallelSolverBandRows;
+    const int32 BandRows = FMath::Max(4, ParallelSolverBandRows);
+    const int32 NumBands = bParallel ? FMath::DivideAndRoundUp(Height, BandRows) : 1;
+    
+    // Accumulate into the persistent back buffer, seeded with the current depths.
+    // In sparse mode only active spans are seeded: every wet cell and its 1-cell
+    // outflow ring lie inside active tiles, so no deposit can land outside them.
+    SimulationData.EnsureBuffer(SimulationData.WaterDepthBack, NumCells);
+    TArray<float>& NewWaterDepth = SimulationData.WaterDepthBack;
+    if (bUseSparseWaterSimulation)
+    {
+        ParallelFor(Height, [&](int32 Y)
+        {
+            for (const FIntPoint& Span : SimulationData.GetActiveSpans(Y))
+            {
+                const int32 SpanStart = Y * Width + Span.X;
+                FMemory::Memcpy(&NewWaterDepth[SpanStart], &SimulationData.WaterDepthMap[SpanStart], (Span.Y - Span.X) * sizeof(float));
+            }
+        }, !bParallel);
+    }
+    else
+    {
+        FMemory::Memcpy(NewWaterDepth.GetData(), SimulationData.WaterDepthMap.GetData(), NumCells * sizeof(float));
+    }
     
     // STABILITY FIX 1: Adaptive timestep scaling
     float StabilityFactor = 1.0f;
@@ -956,238 +1346,360 @@ void UWaterSystem::ApplyWaterFlow(float DeltaTime)
     }
     
     // STABILITY FIX 2: Track previous depths for oscillation detection
-    static TArray<float> PreviousDepths = SimulationData.WaterDepthMap;
-    if (PreviousDepths.Num() != SimulationData.WaterDepthMap.Num())
+    TArray<float>& PreviousDepths = SimulationData.PreviousDepthMap;
+    if (PreviousDepths.Num() != NumCells)
     {
-        PreviousDepths = SimulationData.WaterDepthMap; // Initialize if needed
+        SimulationData.EnsureBuffer(PreviousDepths, NumCells);
+        FMemory::Memcpy(PreviousDepths.GetData(), SimulationData.WaterDepthMap.GetData(), NumCells * sizeof(float)); // Initialize if needed
     }
     
-    // Process ALL cells including edges for waterfall effect
-    for (int32 Y = 0; Y < Height; Y++)
+    // Per-cell outflow. Every depth change this cell causes is handed to Deposit(TargetIndex, Delta)
+    // in the same order the serial loop applies it; water leaving the grid goes to OutEdgeDrainage.
+    // Only reads SimulationData/PreviousDepths/terrain, so it is safe to call from worker threads.
+    auto ProcessCell = [&](int32 X, int32 Y, auto& Deposit, float& OutEdgeDrainage)
     {
-        for (int32 X = 0; X < Width; X++)
-        {
-            int32 Index = Y * Width + X;
-            
-            if (SimulationData.WaterDepthMap[Index] <= MinWaterDepth)
-            {
-                continue;
-            }
-            
-            // STABILITY FIX 3: Detect oscillation and apply damping
-            float OscillationDamping = 1.0f;
-            if (PreviousDepths.IsValidIndex(Index))
-            {
-                float CurrentDepth = SimulationData.WaterDepthMap[Index];
-                float PreviousDepth = PreviousDepths[Index];
-                float DepthChange = CurrentDepth - PreviousDepth;
-                
-                // Simple oscillation check: if depth is bouncing around previous value
-                if (FMath::Abs(DepthChange) > CurrentDepth * 0.3f) // 30% change threshold
-                {
-                    OscillationDamping = 0.7f; // Reduce flow when oscillating
-                }
-            }
-            
-            // Get current velocities with stability adjustments
-            float VelX = SimulationData.WaterVelocityX[Index] * StabilityFactor * OscillationDamping;
-            float VelY = SimulationData.WaterVelocityY[Index] * StabilityFactor * OscillationDamping;
-            
-            // NEW: 8-DIRECTIONAL FLOW DISTRIBUTION
-            // Calculate flow for all 8 directions
-            float Flows[8] = {0}; // E, NE, N, NW, W, SW, S, SE
-            
-            // Decompose velocity into 8 directional components
-            const float sqrt2inv = 0.7071f; // 1/sqrt(2)
-            
-            // East (0)
-            Flows[0] = FMath::Max(0.0f, VelX);
-            // West (4)
-            Flows[4] = FMath::Max(0.0f, -VelX);
-            // North (2) - negative Y in UE
-            Flows[2] = FMath::Max(0.0f, -VelY);
-            // South (6)
-            Flows[6] = FMath::Max(0.0f, VelY);
-            
-            // Calculate diagonal flows based on velocity vector
-            if (VelX > 0 && VelY < 0) // NE
-            {
-                float diagonalSpeed = FMath::Sqrt(VelX * VelX + VelY * VelY) * sqrt2inv;
-                Flows[1] = diagonalSpeed * 0.5f;
-            }
-            if (VelX < 0 && VelY < 0) // NW
-            {
-                float diagonalSpeed = FMath::Sqrt(VelX * VelX + VelY * VelY) * sqrt2inv;
-                Flows[3] = diagonalSpeed * 0.5f;
-            }
-            if (VelX < 0 && VelY > 0) // SW
-            {
-                float diagonalSpeed = FMath::Sqrt(VelX * VelX + VelY * VelY) * sqrt2inv;
-                Flows[5] = diagonalSpeed * 0.5f;
-            }
-            if (VelX > 0 && VelY > 0) // SE
-            {
-                float diagonalSpeed = FMath::Sqrt(VelX * VelX + VelY * VelY) * sqrt2inv;
-                Flows[7] = diagonalSpeed * 0.5f;
-            }
+        int32 Index = Y * Width + X;
+        
+        if (SimulationData.WaterDepthMap[Index] <= MinWaterDepth)
+        {
+            return;
+        }
+        
+        // STABILITY FIX 3: Detect oscillation and apply damping
+        float OscillationDamping = 1.0f;
+        if (PreviousDepths.IsValidIndex(Index))
+        {
+            float CurrentDepth = SimulationData.WaterDepthMap[Index];
+            float PreviousDepth = PreviousDepths[Index];
+            float DepthChange = CurrentDepth - PreviousDepth;
             
-            // Apply flow rate scaling - tunable via FlowRateMultiplier
-            float FlowRate = SimulationData.WaterDepthMap[Index] * DeltaTime * FlowRateMultiplier;
-            for (int i = 0; i < 8; i++)
+            // Simple oscillation check: if depth is bouncing around previous value
+            if (FMath::Abs(DepthChange) > CurrentDepth * 0.3f) // 30% change threshold
             {
-                Flows[i] *= FlowRate;
+                OscillationDamping = 0.7f; // Reduce flow when oscillating
             }
-            
-            // FIXED: Compare WATER SURFACE elevations, not just water depths
-            // A pool at a valley bottom should NOT drain just because it has more water than dry neighbors
-            // Only accelerate outflow if water SURFACE is elevated relative to neighbor SURFACES
-            float CenterTerrainHeight = GetTerrainHeightSafe(X, Y);
-            float CenterSurface = CenterTerrainHeight + SimulationData.WaterDepthMap[Index];
+        }
+        
+        // Get current velocities with stability adjustments
+        float VelX = SimulationData.WaterVelocityX[Index] * StabilityFactor * OscillationDamping;
+        float VelY = SimulationData.WaterVelocityY[Index] * StabilityFactor * OscillationDamping;
+        
+        // NEW: 8-DIRECTIONAL FLOW DISTRIBUTION
+        // Calculate flow for all 8 directions
+        float Flows[8] = {0}; // E, NE, N, NW, W, SW, S, SE
+        
+        // Decompose velocity into 8 directional components
+        const float sqrt2inv = 0.7071f; // 1/sqrt(2)
+        
+        // East (0)
+        Flows[0] = FMath::Max(0.0f, VelX);
+        // West (4)
+        Flows[4] = FMath::Max(0.0f, -VelX);
+        // North (2) - negative Y in UE
+        Flows[2] = FMath::Max(0.0f, -VelY);
+        // South (6)
+        Flows[6] = FMath::Max(0.0f, VelY);
+        
+        // Calculate diagonal flows based on velocity vector
+        if (VelX > 0 && VelY < 0) // NE
+        {
+            float diagonalSpeed = FMath::Sqrt(VelX * VelX + VelY * VelY) * sqrt2inv;
+            Flows[1] = diagonalSpeed * 0.5f;
+        }
+        if (VelX < 0 && VelY < 0) // NW
+        {
+            float diagonalSpeed = FMath::Sqrt(VelX * VelX + VelY * VelY) * sqrt2inv;
+            Flows[3] = diagonalSpeed * 0.5f;
+        }
+        if (VelX < 0 && VelY > 0) // SW
+        {
+            float diagonalSpeed = FMath::Sqrt(VelX * VelX + VelY * VelY) * sqrt2inv;
+            Flows[5] = diagonalSpeed * 0.5f;
+        }
+        if (VelX > 0 && VelY > 0) // SE
+        {
+            float diagonalSpeed = FMath::Sqrt(VelX * VelX + VelY * VelY) * sqrt2inv;
+            Flows[7] = diagonalSpeed * 0.5f;
+        }
+        
+        // Apply flow rate scaling - tunable via FlowRateMultiplier
+        float FlowRate = SimulationData.WaterDepthMap[Index] * DeltaTime * FlowRateMultiplier;
+        for (int i = 0; i < 8; i++)
+        {
+            Flows[i] *= FlowRate;
+        }
+        
+        // FIXED: Compare WATER SURFACE elevations, not just water depths
+        // A pool at a valley bottom should NOT drain just because it has more water than dry neighbors
+        // Only accelerate outflow if water SURFACE is elevated relative to neighbor SURFACES
+        float CenterTerrainHeight = GetTerrainHeightSafe(X, Y);
+        float CenterSurface = CenterTerrainHeight + SimulationData.WaterDepthMap[Index];
 
-            float NeighborSurfaceAvg = 0.0f;
-            int32 NeighborCount = 0;
+        float NeighborSurfaceAvg = 0.0f;
+        int32 NeighborCount = 0;
 
-            for (int32 dy = -1; dy <= 1; dy++)
+        for (int32 dy = -1; dy <= 1; dy++)
+        {
+            for (int32 dx = -1; dx <= 1; dx++)
             {
-                for (int32 dx = -1; dx <= 1; dx++)
-                {
-                    if (dx == 0 && dy == 0) continue;
+                if (dx == 0 && dy == 0) continue;
 
-                    int32 NX = X + dx;
-                    int32 NY = Y + dy;
+                int32 NX = X + dx;
+                int32 NY = Y + dy;
 
-                    if (NX >= 0 && NX < Width && NY >= 0 && NY < Height)
-                    {
-                        int32 NIndex = NY * Width + NX;
-                        float NeighborTerrain = GetTerrainHeightSafe(NX, NY);
-                        float NeighborSurface = NeighborTerrain + SimulationData.WaterDepthMap[NIndex];
-                        NeighborSurfaceAvg += NeighborSurface;
-                        NeighborCount++;
-                    }
+                if (NX >= 0 && NX < Width && NY >= 0 && NY < Height)
+                {
+                    int32 NIndex = NY * Width + NX;
+                    float NeighborTerrain = GetTerrainHeightSafe(NX, NY);
+                    float NeighborSurface = NeighborTerrain + SimulationData.WaterDepthMap[NIndex];
+                    NeighborSurfaceAvg += NeighborSurface;
+                    NeighborCount++;
                 }
             }
+        }
 
-            float OutflowMultiplier = 1.0f;
-            if (NeighborCount > 0)
+        float OutflowMultiplier = 1.0f;
+        if (NeighborCount > 0)
+        {
+            NeighborSurfaceAvg /= NeighborCount;
+            // Compare SURFACE elevations: terrain + water
+            float SurfaceDiff = CenterSurface - NeighborSurfaceAvg;
+
+            // Only boost outflow if water SURFACE is significantly elevated
+            // A pool at a valley bottom will have SurfaceDiff <= 0 and won't drain
+            if (SurfaceDiff > 0.5f)
             {
-                NeighborSurfaceAvg /= NeighborCount;
-                // Compare SURFACE elevations: terrain + water
-                float SurfaceDiff = CenterSurface - NeighborSurfaceAvg;
+                OutflowMultiplier = 1.0f + (SurfaceDiff * 0.3f);  // Reduced from 0.5f
+                OutflowMultiplier = FMath::Min(OutflowMultiplier, 2.0f);  // Reduced from 3.0f
+            }
+        }
 
-                // Only boost outflow if water SURFACE is significantly elevated
-                // A pool at a valley bottom will have SurfaceDiff <= 0 and won't drain
-                if (SurfaceDiff > 0.5f)
-                {
-                    OutflowMultiplier = 1.0f + (SurfaceDiff * 0.3f);  // Reduced from 0.5f
-                    OutflowMultiplier = FMath::Min(OutflowMultiplier, 2.0f);  // Reduced from 3.0f
-                }
+        // Apply multiplier to all flows
+        for (int i = 0; i < 8; i++)
+        {
+            Flows[i] *= OutflowMultiplier;
+        }
+        
+        // Ensure total outflow doesn't exceed available water
+        float TotalOutflow = 0.0f;
+        for (int i = 0; i < 8; i++)
+        {
+            TotalOutflow += Flows[i];
+        }
+
+        // DEPTH-DEPENDENT COHESION: Deeper water is more stable (like real pressure)
+        // - Shallow water (splashes): flows freely, preserves dynamic behavior
+        // - Deep water (pool bottoms): resists outflow, allows accumulation
+        // Tunable via CohesionReferenceDepth and CohesionStrength
+        if (CohesionStrength > 0.0f)
+        {
+            // Normalized depth: 0 = shallow/surface, 1+ = deep
+            float NormalizedDepth = FMath::Clamp(SimulationData.WaterDepthMap[Index] / CohesionReferenceDepth, 0.0f, 1.0f);
+
+            // Cohesion scales with depth squared (pressure increases non-linearly)
+            float CohesionFactor = NormalizedDepth * NormalizedDepth * CohesionStrength;
+
+            // Reduce outflow based on cohesion - deep water stays, shallow water splashes
+            TotalOutflow *= (1.0f - CohesionFactor);
+
+            // Also scale individual flows to maintain distribution ratios
+            float CohesionScale = (1.0f - CohesionFactor);
+            for (int i = 0; i < 8; i++)
+            {
+                Flows[i] *= CohesionScale;
             }
+        }
 
-            // Apply multiplier to all flows
+        if (TotalOutflow > SimulationData.WaterDepthMap[Index])
+        {
+            float Scale = SimulationData.WaterDepthMap[Index] / TotalOutflow;
             for (int i = 0; i < 8; i++)
             {
-                Flows[i] *= OutflowMultiplier;
+                Flows[i] *= Scale;
             }
+            TotalOutflow = SimulationData.WaterDepthMap[Index];
+        }
+        
+        // Remove water from current cell
+        Deposit(Index, -TotalOutflow);
+        
+        // Distribute to all 8 neighbors
+        const int32 dx[8] = {1, 1, 0, -1, -1, -1, 0, 1};
+        const int32 dy[8] = {0, -1, -1, -1, 0, 1, 1, 1};
+        
+        for (int i = 0; i < 8; i++)
+        {
+            int32 NX = X + dx[i];
+            int32 NY = Y + dy[i];
             
-            // Ensure total outflow doesn't exceed available water
-            float TotalOutflow = 0.0f;
-            for (int i = 0; i < 8; i++)
+            if (NX >= 0 && NX < Width && NY >= 0 && NY < Height)
             {
-                TotalOutflow += Flows[i];
+                int32 NIndex = NY * Width + NX;
+                Deposit(NIndex, Flows[i]);
             }
-
-            // DEPTH-DEPENDENT COHESION: Deeper water is more stable (like real pressure)
-            // - Shallow water (splashes): flows freely, preserves dynamic behavior
-            // - Deep water (pool bottoms): resists outflow, allows accumulation
-            // Tunable via CohesionReferenceDepth and CohesionStrength
-            if (CohesionStrength > 0.0f)
+            else
             {
-                // Normalized depth: 0 = shallow/surface, 1+ = deep
-                float NormalizedDepth = FMath::Clamp(SimulationData.WaterDepthMap[Index] / CohesionReferenceDepth, 0.0f, 1.0f);
-
-                // Cohesion scales with depth squared (pressure increases non-linearly)
-                float CohesionFactor = NormalizedDepth * NormalizedDepth * CohesionStrength;
-
-                // Reduce outflow based on cohesion - deep water stays, shallow water splashes
-                TotalOutflow *= (1.0f - CohesionFactor);
-
-                // Also scale individual flows to maintain distribution ratios
-                float CohesionScale = (1.0f - CohesionFactor);
-                for (int i = 0; i < 8; i++)
-                {
-                    Flows[i] *= CohesionScale;
-                }
+                OutEdgeDrainage += Flows[i];
             }
-
-            if (TotalOutflow > SimulationData.WaterDepthMap[Index])
+        }
+    };
+    
+    // Track edge drainage with water budget
+    auto TransferEdgeDrainage = [this](int32 X, int32 Y, float EdgeDrainageVolume)
+    {
+        if (EdgeDrainageVolume > 0.0f && CachedMasterController)
+        {
+            float VolumeM3 = CachedMasterController->GetWaterCellVolume(EdgeDrainageVolume);
+            FVector WorldPos = OwnerTerrain->TerrainToWorldPosition(X, Y);
+            CachedMasterController->TransferSurfaceToGroundwater(WorldPos, VolumeM3);
+        }
+    };
+    
+    if (!bParallel)
+    {
+        auto DepositDirect = [&NewWaterDepth](int32 TargetIndex, float Delta)
+        {
+            NewWaterDepth[TargetIndex] += Delta;
+        };
+        
+        // Process ALL cells including edges for waterfall effect
+        for (int32 Y = 0; Y < Height; Y++)
+        {
+            for (const FIntPoint& Span : SimulationData.GetActiveSpans(Y))
             {
-                float Scale = SimulationData.WaterDepthMap[Index] / TotalOutflow;
-                for (int i = 0; i < 8; i++)
+                for (int32 X = Span.X; X < Span.Y; X++)
                 {
-                    Flows[i] *= Scale;
+                    float EdgeDrainageVolume = 0.0f;
+                    ProcessCell(X, Y, DepositDirect, EdgeDrainageVolume);
+                    TransferEdgeDrainage(X, Y, EdgeDrainageVolume);
                 }
-                TotalOutflow = SimulationData.WaterDepthMap[Index];
             }
+        }
+    }
+    else
+    {
+        // PARALLEL PATH: row bands run concurrently. Rows strictly inside a band only receive water
+        // from the same band and are written directly. The first/last row of a band (and the rows
+        // just outside it) also receive from the neighbouring band, so those deposits are logged and
+        // replayed band by band afterwards - each seam cell then sums lower-band inflows before
+        // upper-band inflows, exactly like the serial Y-major loop, keeping results bit-identical.
+        TArray<FWaterFlowBandScratch>& Bands = FlowBandScratch;
+        if (Bands.Num() != NumBands)
+        {
+            SimulationData.TrackScratchGrowth(Bands.Max(), FMath::Max(Bands.Max(), NumBands), sizeof(FWaterFlowBandScratch));
+            Bands.SetNum(NumBands);
+        }
+        
+        TArray<int32, TInlineAllocator<256>> PreviousCapacity;
+        PreviousCapacity.SetNumUninitialized(NumBands * 2);
+        for (int32 BandIndex = 0; BandIndex < NumBands; BandIndex++)
+        {
+            PreviousCapacity[BandIndex * 2] = Bands[BandIndex].SeamDeposits.Max();
+            PreviousCapacity[BandIndex * 2 + 1] = Bands[BandIndex].EdgeDrainage.Max();
+            Bands[BandIndex].SeamDeposits.Reset();
+            Bands[BandIndex].EdgeDrainage.Reset();
+        }
+        
+        ParallelFor(NumBands, [&](int32 BandIndex)
+        {
+            const int32 BandStartY = BandIndex * BandRows;
+            const int32 BandEndY = FMath::Min(BandStartY + BandRows, Height);
+            FWaterFlowBandScratch& Band = Bands[BandIndex];
             
-            // Remove water from current cell
-            NewWaterDepth[Index] -= TotalOutflow;
-            
-            // Distribute to all 8 neighbors
-            const int32 dx[8] = {1, 1, 0, -1, -1, -1, 0, 1};
-            const int32 dy[8] = {0, -1, -1, -1, 0, 1, 1, 1};
-            
-            float EdgeDrainageVolume = 0.0f;
-            
-            for (int i = 0; i < 8; i++)
+            auto DepositBanded = [&](int32 TargetIndex, float Delta)
             {
-                int32 NX = X + dx[i];
-                int32 NY = Y + dy[i];
-                
-                if (NX >= 0 && NX < Width && NY >= 0 && NY < Height)
+                const int32 TargetY = TargetIndex / Width;
+                if (TargetY > BandStartY && TargetY < BandEndY - 1)
                 {
-                    int32 NIndex = NY * Width + NX;
-                    NewWaterDepth[NIndex] += Flows[i];
+                    NewWaterDepth[TargetIndex] += Delta;
                 }
                 else
                 {
-                    EdgeDrainageVolume += Flows[i];
+                    Band.SeamDeposits.Add({TargetIndex, Delta});
                 }
-            }
+            };
             
-            // Track edge drainage with water budget
-            if (EdgeDrainageVolume > 0.0f && CachedMasterController)
+            for (int32 Y = BandStartY; Y < BandEndY; Y++)
+            {
+                for (const FIntPoint& Span : SimulationData.GetActiveSpans(Y))
+                {
+                    for (int32 X = Span.X; X < Span.Y; X++)
+                    {
+                        float EdgeDrainageVolume = 0.0f;
+                        ProcessCell(X, Y, DepositBanded, EdgeDrainageVolume);
+                        if (EdgeDrainageVolume > 0.0f)
+                        {
+                            Band.EdgeDrainage.Add({X, Y, EdgeDrainageVolume});
+                        }
+                    }
+                }
+            }
+        });
+        
+        // Seam merge + water budget reporting stay on the game thread, in band order
+        for (int32 BandIndex = 0; BandIndex < NumBands; BandIndex++)
+        {
+            const FWaterFlowBandScratch& Band = Bands[BandIndex];
+            for (const FWaterFlowBandScratch::FSeamDeposit& SeamDeposit : Band.SeamDeposits)
             {
-                float VolumeM3 = CachedMasterController->GetWaterCellVolume(EdgeDrainageVolume);
-                FVector WorldPos = OwnerTerrain->TerrainToWorldPosition(X, Y);
-                CachedMasterController->TransferSurfaceToGroundwater(WorldPos, VolumeM3);
+                NewWaterDepth[SeamDeposit.Index] += SeamDeposit.Delta;
             }
+            for (const FWaterFlowBandScratch::FEdgeDrainage& Drainage : Band.EdgeDrainage)
+            {
+                TransferEdgeDrainage(Drainage.X, Drainage.Y, Drainage.Volume);
+            }
+            
+            SimulationData.TrackScratchGrowth(PreviousCapacity[BandIndex * 2], Band.SeamDeposits.Max(),
+                                              sizeof(FWaterFlowBandScratch::FSeamDeposit));
+            SimulationData.TrackScratchGrowth(PreviousCapacity[BandIndex * 2 + 1], Band.EdgeDrainage.Max(),
+                                              sizeof(FWaterFlowBandScratch::FEdgeDrainage));
         }
     }
     
-    // STABILITY FIX 4: Post-process smoothing for spikes
-    for (int32 i = 0; i < SimulationData.WaterDepthMap.Num(); i++)
+    // STABILITY FIX 4: Post-process smoothing for spikes (per-cell, order independent).
+    // Dense mode finishes into the back buffer and swaps; sparse mode writes the active
+    // spans straight into the front buffer so skipped tiles keep their current depths.
+    TArray<float>& FinalWaterDepth = bUseSparseWaterSimulation ? SimulationData.WaterDepthMap : NewWaterDepth;
+    auto FinalizeRows = [&](int32 BandIndex)
     {
-        float NewDepth = FMath::Max(0.0f, NewWaterDepth[i]);
+        const int32 StartY = BandIndex * BandRows;
+        const int32 EndY = bParallel ? FMath::Min(StartY + BandRows, Height) : Height;
         
-        // Gentle smoothing: if change is too dramatic, blend it
-        if (PreviousDepths.IsValidIndex(i))
+        for (int32 Y = StartY; Y < EndY; Y++)
         {
-            float OldDepth = SimulationData.WaterDepthMap[i];
-            float DepthChange = NewDepth - OldDepth;
-            
-            // If depth changed by more than 50%, smooth it
-            if (FMath::Abs(DepthChange) > OldDepth * 0.5f && OldDepth > MinWaterDepth)
+            for (const FIntPoint& Span : SimulationData.GetActiveSpans(Y))
             {
-                // Blend 70% new, 30% old for stability
-                NewDepth = NewDepth * 0.7f + OldDepth * 0.3f;
+                for (int32 i = Y * Width + Span.X; i < Y * Width + Span.Y; i++)
+                {
+                    float NewDepth = FMath::Max(0.0f, NewWaterDepth[i]);
+                    
+                    // Gentle smoothing: if change is too dramatic, blend it
+                    float OldDepth = SimulationData.WaterDepthMap[i];
+                    float DepthChange = NewDepth - OldDepth;
+                    
+                    // If depth changed by more than 50%, smooth it
+                    if (FMath::Abs(DepthChange) > OldDepth * 0.5f && OldDepth > MinWaterDepth)
+                    {
+                        // Blend 70% new, 30% old for stability
+                        NewDepth = NewDepth * 0.7f + OldDepth * 0.3f;
+                    }
+                    
+                    FinalWaterDepth[i] = NewDepth;
+                    
+                    // Store current depths for next frame's oscillation detection
+                    PreviousDepths[i] = NewDepth;
+                }
             }
         }
-        
-        SimulationData.WaterDepthMap[i] = NewDepth;
-    }
+    };
     
-    // Store current depths for next frame's oscillation detection
-    PreviousDepths = SimulationData.WaterDepthMap;
+    ParallelFor(NumBands, FinalizeRows, !bParallel);
+    
+    if (!bUseSparseWaterSimulation)
+    {
+        // Back buffer now holds the finished depths - make it the front
+        Swap(SimulationData.WaterDepthMap, SimulationData.WaterDepthBack);
+    }
     
     bWaterChangedThisFrame = true;
     bVolumeNeedsUpdate = true;
@@ -1212,29 +1724,37 @@ void UWaterSystem::ProcessWaterEvaporation(float DeltaTime)
     float CellArea = CachedMasterController->GetWaterCellArea();
     
     // Process all water cells locally (FAST - no external calls)
-    for (int32 i = 0; i < SimulationData.WaterDepthMap.Num(); i++)
+    // Sparse mode visits active spans only; cells outside them are dry by construction
+    const int32 Width = SimulationData.TerrainWidth;
+    for (int32 Y = 0; Y < SimulationData.TerrainHeight; Y++)
     {
-        if (SimulationData.WaterDepthMap[i] > MinWaterDepth)
+        for (const FIntPoint& Span : SimulationData.GetActiveSpans(Y))
         {
-            // Calculate evaporation
-            float EvaporationDepth = WaterEvaporationRate * DeltaTime;
-            EvaporationDepth = FMath::Min(EvaporationDepth, SimulationData.WaterDepthMap[i]);
-            
-            // Calculate infiltration from remaining water
-            float RemainingDepth = SimulationData.WaterDepthMap[i] - EvaporationDepth;
-            float InfiltrationDepth = 0.0f;
-            if (RemainingDepth > MinWaterDepth)
+            for (int32 i = Y * Width + Span.X; i < Y * Width + Span.Y; i++)
             {
-                InfiltrationDepth = WaterAbsorptionRate * DeltaTime;
-                InfiltrationDepth = FMath::Min(InfiltrationDepth, RemainingDepth);
+                if (SimulationData.WaterDepthMap[i] > MinWaterDepth)
+                {
+                    // Calculate evaporation
+                    float EvaporationDepth = WaterEvaporationRate * DeltaTime;
+                    EvaporationDepth = FMath::Min(EvaporationDepth, SimulationData.WaterDepthMap[i]);
+                    
+                    // Calculate infiltration from remaining water
+                    float RemainingDepth = SimulationData.WaterDepthMap[i] - EvaporationDepth;
+                    float InfiltrationDepth = 0.0f;
+                    if (RemainingDepth > MinWaterDepth)
+                    {
+                        InfiltrationDepth = WaterAbsorptionRate * DeltaTime;
+                        InfiltrationDepth = FMath::Min(InfiltrationDepth, RemainingDepth);
+                    }
+                    
+                    // Update water depth locally
+                    SimulationData.WaterDepthMap[i] -= (EvaporationDepth + InfiltrationDepth);
+                    
+                    // Accumulate totals
+                    TotalEvaporation += EvaporationDepth * CellArea;
+                    TotalInfiltration += InfiltrationDepth * CellArea;
+                }
             }
-            
-            // Update water depth locally
-            SimulationData.WaterDepthMap[i] -= (EvaporationDepth + InfiltrationDepth);
-            
-            // Accumulate totals
-            TotalEvaporation += EvaporationDepth * CellArea;
-            TotalInfiltration += InfiltrationDepth * CellArea;
         }
     }
     
@@ -1271,114 +1791,152 @@ void UWaterSystem::ApplySedimentTransport(float DeltaTime)
         return;
     }
 
-    TArray<float> NewSediment = SimulationData.SedimentMap;
     const int32 Width = SimulationData.TerrainWidth;
     const int32 Height = SimulationData.TerrainHeight;
+    const int32 NumCells = SimulationData.SedimentMap.Num();
 
-    // Sediment advects with water flow - follows same 8-directional pattern as water
-    for (int32 Y = 0; Y < Height; Y++)
+    SimulationData.EnsureBuffer(SimulationData.SedimentBack, NumCells);
+    TArray<float>& NewSediment = SimulationData.SedimentBack;
+    if (bUseSparseWaterSimulation)
     {
-        for (int32 X = 0; X < Width; X++)
+        for (int32 Y = 0; Y < Height; Y++)
         {
-            int32 Index = Y * Width + X;
-
-            // Need water to transport sediment
-            float WaterDepth = SimulationData.WaterDepthMap[Index];
-            if (WaterDepth <= MinWaterDepth)
+            for (const FIntPoint& Span : SimulationData.GetActiveSpans(Y))
             {
-                continue;
+                const int32 SpanStart = Y * Width + Span.X;
+                FMemory::Memcpy(&NewSediment[SpanStart], &SimulationData.SedimentMap[SpanStart], (Span.Y - Span.X) * sizeof(float));
             }
+        }
+    }
+    else
+    {
+        FMemory::Memcpy(NewSediment.GetData(), SimulationData.SedimentMap.GetData(), NumCells * sizeof(float));
+    }
 
-            float CurrentSediment = SimulationData.SedimentMap[Index];
-            if (CurrentSediment <= 0.0f)
+    // Sediment advects with water flow - follows same 8-directional pattern as water
+    for (int32 Y = 0; Y < Height; Y++)
+    {
+        for (const FIntPoint& Span : SimulationData.GetActiveSpans(Y))
+        {
+            for (int32 X = Span.X; X < Span.Y; X++)
             {
-                continue;
-            }
+                int32 Index = Y * Width + X;
 
-            // Get water velocity
-            float VelX = SimulationData.WaterVelocityX[Index];
-            float VelY = SimulationData.WaterVelocityY[Index];
+                // Need water to transport sediment
+                float WaterDepth = SimulationData.WaterDepthMap[Index];
+                if (WaterDepth <= MinWaterDepth)
+                {
+                    continue;
+                }
 
-            // 8-directional decomposition (same as water flow)
-            float Flows[8] = {0}; // E, NE, N, NW, W, SW, S, SE
-            const float sqrt2inv = 0.7071f;
+                float CurrentSediment = SimulationData.SedimentMap[Index];
+                if (CurrentSediment <= 0.0f)
+                {
+                    continue;
+                }
 
-            // Cardinal directions
-            Flows[0] = FMath::Max(0.0f, VelX);      // East
-            Flows[4] = FMath::Max(0.0f, -VelX);     // West
-            Flows[2] = FMath::Max(0.0f, -VelY);     // North
-            Flows[6] = FMath::Max(0.0f, VelY);      // South
+                // Get water velocity
+                float VelX = SimulationData.WaterVelocityX[Index];
+                float VelY = SimulationData.WaterVelocityY[Index];
 
-            // Diagonal flows
-            if (VelX > 0 && VelY < 0) // NE
-            {
-                Flows[1] = FMath::Sqrt(VelX * VelX + VelY * VelY) * sqrt2inv * 0.5f;
-            }
-            if (VelX < 0 && VelY < 0) // NW
-            {
-                Flows[3] = FMath::Sqrt(VelX * VelX + VelY * VelY) * sqrt2inv * 0.5f;
-            }
-            if (VelX < 0 && VelY > 0) // SW
-            {
-                Flows[5] = FMath::Sqrt(VelX * VelX + VelY * VelY) * sqrt2inv * 0.5f;
-            }
-            if (VelX > 0 && VelY > 0) // SE
-            {
-                Flows[7] = FMath::Sqrt(VelX * VelX + VelY * VelY) * sqrt2inv * 0.5f;
-            }
+                // 8-directional decomposition (same as water flow)
+                float Flows[8] = {0}; // E, NE, N, NW, W, SW, S, SE
+                const float sqrt2inv = 0.7071f;
 
-            // Sediment transport rate - proportional to water velocity and current sediment
-            // Use same FlowRateMultiplier as water for consistency
-            float TransportRate = CurrentSediment * DeltaTime * FlowRateMultiplier;
-            for (int i = 0; i < 8; i++)
-            {
-                Flows[i] *= TransportRate;
-            }
+                // Cardinal directions
+                Flows[0] = FMath::Max(0.0f, VelX);      // East
+                Flows[4] = FMath::Max(0.0f, -VelX);     // West
+                Flows[2] = FMath::Max(0.0f, -VelY);     // North
+                Flows[6] = FMath::Max(0.0f, VelY);      // South
 
-            // Calculate total outflow
-            float TotalOutflow = 0.0f;
-            for (int i = 0; i < 8; i++)
-            {
-                TotalOutflow += Flows[i];
-            }
+                // Diagonal flows
+                if (VelX > 0 && VelY < 0) // NE
+                {
+                    Flows[1] = FMath::Sqrt(VelX * VelX + VelY * VelY) * sqrt2inv * 0.5f;
+                }
+                if (VelX < 0 && VelY < 0) // NW
+                {
+                    Flows[3] = FMath::Sqrt(VelX * VelX + VelY * VelY) * sqrt2inv * 0.5f;
+                }
+                if (VelX < 0 && VelY > 0) // SW
+                {
+                    Flows[5] = FMath::Sqrt(VelX * VelX + VelY * VelY) * sqrt2inv * 0.5f;
+                }
+                if (VelX > 0 && VelY > 0) // SE
+                {
+                    Flows[7] = FMath::Sqrt(VelX * VelX + VelY * VelY) * sqrt2inv * 0.5f;
+                }
 
-            // Clamp to available sediment
-            if (TotalOutflow > CurrentSediment)
-            {
-                float Scale = CurrentSediment / TotalOutflow;
+                // Sediment transport rate - proportional to water velocity and current sediment
+                // Use same FlowRateMultiplier as water for consistency
+                float TransportRate = CurrentSediment * DeltaTime * FlowRateMultiplier;
                 for (int i = 0; i < 8; i++)
                 {
-                    Flows[i] *= Scale;
+                    Flows[i] *= TransportRate;
+                }
+
+                // Calculate total outflow
+                float TotalOutflow = 0.0f;
+                for (int i = 0; i < 8; i++)
+                {
+                    TotalOutflow += Flows[i];
                 }
-                TotalOutflow = CurrentSediment;
-            }
 
-            // Remove sediment from current cell
-            NewSediment[Index] -= TotalOutflow;
+                // Clamp to available sediment
+                if (TotalOutflow > CurrentSediment)
+                {
+                    float Scale = CurrentSediment / TotalOutflow;
+                    for (int i = 0; i < 8; i++)
+                    {
+                        Flows[i] *= Scale;
+                    }
+                    TotalOutflow = CurrentSediment;
+                }
 
-            // Distribute to 8 neighbors
-            const int32 dx[8] = {1, 1, 0, -1, -1, -1, 0, 1};
-            const int32 dy[8] = {0, -1, -1, -1, 0, 1, 1, 1};
+                // Remove sediment from current cell
+                NewSediment[Index] -= TotalOutflow;
 
-            for (int i = 0; i < 8; i++)
-            {
-                int32 NX = X + dx[i];
-                int32 NY = Y + dy[i];
+                // Distribute to 8 neighbors
+                const int32 dx[8] = {1, 1, 0, -1, -1, -1, 0, 1};
+                const int32 dy[8] = {0, -1, -1, -1, 0, 1, 1, 1};
 
-                if (NX >= 0 && NX < Width && NY >= 0 && NY < Height)
+                for (int i = 0; i < 8; i++)
                 {
-                    int32 NIndex = NY * Width + NX;
-                    NewSediment[NIndex] += Flows[i];
+                    int32 NX = X + dx[i];
+                    int32 NY = Y + dy[i];
+
+                    if (NX >= 0 && NX < Width && NY >= 0 && NY < Height)
+                    {
+                        int32 NIndex = NY * Width + NX;
+                        NewSediment[NIndex] += Flows[i];
+                    }
+                    // Sediment leaving edges is lost (washed away)
                 }
-                // Sediment leaving edges is lost (washed away)
             }
         }
     }
 
-    // Apply updates
-    for (int32 i = 0; i < SimulationData.SedimentMap.Num(); i++)
+    // Apply updates (sparse mode writes active spans back into the front buffer)
+    if (bUseSparseWaterSimulation)
+    {
+        for (int32 Y = 0; Y < Height; Y++)
+        {
+            for (const FIntPoint& Span : SimulationData.GetActiveSpans(Y))
+            {
+                for (int32 i = Y * Width + Span.X; i < Y * Width + Span.Y; i++)
+                {
+                    SimulationData.SedimentMap[i] = FMath::Max(0.0f, NewSediment[i]);
+                }
+            }
+        }
+    }
+    else
     {
-        SimulationData.SedimentMap[i] = FMath::Max(0.0f, NewSediment[i]);
+        for (int32 i = 0; i < NumCells; i++)
+        {
+            NewSediment[i] = FMath::Max(0.0f, NewSediment[i]);
+        }
+        Swap(SimulationData.SedimentMap, SimulationData.SedimentBack);
     }
 }
 
@@ -1523,10 +2081,7 @@ void UWaterSystem::UpdateWaterSurfaceChunks()
         
         bool bShouldHaveWater = ShouldGenerateSurfaceForChunk_AuthorityOnly(ChunkIndex);
         
-        FWaterSurfaceChunk* ExistingChunk = WaterSurfaceChunks.FindByPredicate(
-            [ChunkIndex](const FWaterSurfaceChunk& Chunk) {
-                return Chunk.ChunkIndex == ChunkIndex;
-            });
+        FWaterSurfaceChunk* ExistingChunk = FindWaterSurfaceChunk(ChunkIndex);
         
         if (bShouldHaveWater && !ExistingChunk && WaterSurfaceChunks.Num() < MaxVolumeChunks)
         {
@@ -1655,9 +2210,34 @@ void UWaterSystem::SynchronizeChunkWithSimulation(FWaterSurfaceChunk& SurfaceChu
     float* LastDepth = LastKnownDepths.Find(SurfaceChunk.ChunkIndex);
     if (!LastDepth || FMath::Abs(*LastDepth - SurfaceChunk.AverageDepth) > 0.1f)
     {
-        SurfaceChunk.bNeedsUpdate = true;
-        LastKnownDepths.Add(SurfaceChunk.ChunkIndex, SurfaceChunk.AverageDepth);
+        SurfaceChunk.bNeedsUpdate = true;
+        LastKnownDepths.Add(SurfaceChunk.ChunkIndex, SurfaceChunk.AverageDepth);
+    }
+}
+
+bool UWaterSystem::HasChunkWaterStatsTable() const
+{
+    return OwnerTerrain &&
+        WaterPostPass.Matches(SimulationData.TerrainWidth, SimulationData.TerrainHeight, FWaterSimulationData::ActiveTileSize,
+                              OwnerTerrain->ChunksX, OwnerTerrain->ChunksY,
+                              FMath::Max(OwnerTerrain->ChunkSize - OwnerTerrain->ChunkOverlap, 1), FMath::Max(OwnerTerrain->ChunkSize, 1));
+}
+
+const FWaterChunkStats* UWaterSystem::FindChunkWaterStats(int32 ChunkIndex) const
+{
+    if (!HasChunkWaterStatsTable() || !OwnerTerrain->TerrainChunks.IsValidIndex(ChunkIndex))
+    {
+        return nullptr;
+    }
+    
+    // Stats are as of the last post-pass (end of the previous water step)
+    const FTerrainChunk& TerrainChunk = OwnerTerrain->TerrainChunks[ChunkIndex];
+    if (TerrainChunk.ChunkX < 0 || TerrainChunk.ChunkX >= OwnerTerrain->ChunksX)
+    {
+        return nullptr;
     }
+    const int32 StatsIndex = TerrainChunk.ChunkY * OwnerTerrain->ChunksX + TerrainChunk.ChunkX;
+    return WaterPostPass.IsValidChunk(StatsIndex) ? &WaterPostPass.GetChunkStats(StatsIndex) : nullptr;
 }
 
 /**
@@ -1672,6 +2252,12 @@ float UWaterSystem::GetChunkMaxDepthFromSimulation(int32 ChunkIndex) const
         return 0.0f;
     }
     
+    // Aggregated by the water post-pass; the scan below covers chunks outside its table
+    if (const FWaterChunkStats* Stats = FindChunkWaterStats(ChunkIndex))
+    {
+        return Stats->MaxDepth;
+    }
+    
     const auto& TerrainChunk = OwnerTerrain->TerrainChunks[ChunkIndex];
     int32 ChunkSize = OwnerTerrain->ChunkSize;
     int32 ChunkOverlap = OwnerTerrain->ChunkOverlap;
@@ -1706,6 +2292,11 @@ float UWaterSystem::GetChunkAverageDepthFromSimulation(int32 ChunkIndex) const
         return 0.0f;
     }
     
+    if (const FWaterChunkStats* Stats = FindChunkWaterStats(ChunkIndex))
+    {
+        return Stats->AverageDepth;
+    }
+    
     const auto& TerrainChunk = OwnerTerrain->TerrainChunks[ChunkIndex];
     int32 ChunkSize = OwnerTerrain->ChunkSize;
     int32 ChunkOverlap = OwnerTerrain->ChunkOverlap;
@@ -1745,6 +2336,11 @@ FVector2D UWaterSystem::GetChunkFlowDirectionFromSimulation(int32 ChunkIndex) co
     {
         return FVector2D::ZeroVector;
     }
+    
+    if (const FWaterChunkStats* Stats = FindChunkWaterStats(ChunkIndex))
+    {
+        return Stats->FlowDirection;
+    }
 
     const auto& TerrainChunk = OwnerTerrain->TerrainChunks[ChunkIndex];
     int32 ChunkSize = OwnerTerrain->ChunkSize;
@@ -1795,6 +2391,11 @@ float UWaterSystem::GetChunkFlowSpeedFromSimulation(int32 ChunkIndex) const
         return 0.0f;
     }
     
+    if (const FWaterChunkStats* Stats = FindChunkWaterStats(ChunkIndex))
+    {
+        return Stats->FlowSpeed;
+    }
+    
     const auto& TerrainChunk = OwnerTerrain->TerrainChunks[ChunkIndex];
     int32 ChunkSize = OwnerTerrain->ChunkSize;
     int32 ChunkOverlap = OwnerTerrain->ChunkOverlap;
@@ -1841,6 +2442,11 @@ bool UWaterSystem::GetChunkFoamStateFromSimulation(int32 ChunkIndex) const
         return false;
     }
     
+    if (const FWaterChunkStats* Stats = FindChunkWaterStats(ChunkIndex))
+    {
+        return Stats->AverageFoam > 0.3f;
+    }
+    
     const auto& TerrainChunk = OwnerTerrain->TerrainChunks[ChunkIndex];
     int32 ChunkSize = OwnerTerrain->ChunkSize;
     int32 ChunkOverlap = OwnerTerrain->ChunkOverlap;
@@ -2938,6 +3544,19 @@ void UWaterSystem::CreateWaterSurfaceMesh(FWaterSurfaceChunk& SurfaceChunk)
 
 void UWaterSystem::GenerateWaterSurfaceTriangles(int32 Resolution, TArray<int32>& Triangles, const TArray<int32>& VertexIndexMap)
 {
+    // Every grid vertex present in order: reuse the shared grid index buffer
+    bool bIdentityMap = VertexIndexMap.Num() == Resolution * Resolution;
+    for (int32 i = 0; bIdentityMap && i < VertexIndexMap.Num(); i++)
+    {
+        bIdentityMap = VertexIndexMap[i] == i;
+    }
+    
+    if (bIdentityMap)
+    {
+        Triangles = *FGridIndexBufferCache::Get().GetIndexBuffer(Resolution, Resolution);
+        return;
+    }
+    
     Triangles.Empty();
     
     // Generate triangles for the water surface grid
@@ -3576,26 +4195,8 @@ void UWaterSystem::GenerateStableWaterMesh(FWaterSurfaceChunk& SurfaceChunk,
         }
     }
     
-    // Generate triangles
-    for (int32 Y = 0; Y < Resolution - 1; Y++)
-    {
-        for (int32 X = 0; X < Resolution - 1; X++)
-        {
-            int32 TopLeft = Y * Resolution + X;
-            int32 TopRight = Y * Resolution + (X + 1);
-            int32 BottomLeft = (Y + 1) * Resolution + X;
-            int32 BottomRight = (Y + 1) * Resolution + (X + 1);
-            
-            // Create triangles
-            Triangles.Add(TopLeft);
-            Triangles.Add(BottomLeft);
-            Triangles.Add(TopRight);
-            
-            Triangles.Add(TopRight);
-            Triangles.Add(BottomLeft);
-            Triangles.Add(BottomRight);
-        }
-    }
+    // Dense grid: triangles come from the shared index buffer
+    Triangles = *FGridIndexBufferCache::Get().GetIndexBuffer(Resolution, Resolution);
 }
 
 void UWaterSystem::ApplyMaterialToChunk(FWaterSurfaceChunk& Chunk)
@@ -3898,8 +4499,43 @@ void UWaterSystem::UpdateAdvancedWaterTexture()
 // Physically-based foam effects from flow properties
 
 void UWaterSystem::CalculateFoamData()
+{
+    // Foam comes out of the fused post-pass, on the tiles the water step touched
+    RunWaterPostPass(FWaterPostPass::Work_Foam | FWaterPostPass::Work_ChunkStats);
+}
+
+// ===== SUBSYSTEM 3.8: FUSED WATER POST-PASS =====
+// Foam, erosion texture staging, depth texels and per-chunk aggregates in one sweep over changed tiles
+
+bool UWaterSystem::EnsureWaterPostPassLayout()
 {
     if (!SimulationData.IsValid())
+    {
+        return false;
+    }
+    
+    // Chunk aggregates follow the terrain chunk layout (overlapping chunks); none without a terrain
+    const int32 NumChunksX = OwnerTerrain ? OwnerTerrain->ChunksX : 0;
+    const int32 NumChunksY = OwnerTerrain ? OwnerTerrain->ChunksY : 0;
+    const int32 TerrainChunkSize = OwnerTerrain ? FMath::Max(OwnerTerrain->ChunkSize, 1) : 1;
+    const int32 TerrainChunkStride = OwnerTerrain ? FMath::Max(OwnerTerrain->ChunkSize - OwnerTerrain->ChunkOverlap, 1) : 1;
+    
+    if (!WaterPostPass.Matches(SimulationData.TerrainWidth, SimulationData.TerrainHeight, FWaterSimulationData::ActiveTileSize,
+                               NumChunksX, NumChunksY, TerrainChunkStride, TerrainChunkSize))
+    {
+        WaterPostPass.Initialize(SimulationData.TerrainWidth, SimulationData.TerrainHeight, FWaterSimulationData::ActiveTileSize,
+                                 NumChunksX, NumChunksY, TerrainChunkStride, TerrainChunkSize);
+        
+        // Foam is only kept up to date on changed tiles, so a fresh layout recomputes it everywhere
+        WaterPostPass.MarkCells(FIntRect(0, 0, SimulationData.TerrainWidth - 1, SimulationData.TerrainHeight - 1),
+                                FWaterPostPass::Work_Foam);
+    }
+    return true;
+}
+
+void UWaterSystem::RunWaterPostPass(uint8 Work)
+{
+    if (!EnsureWaterPostPassLayout())
     {
         return;
     }
@@ -3907,67 +4543,64 @@ void UWaterSystem::CalculateFoamData()
     const int32 Width = SimulationData.TerrainWidth;
     const int32 Height = SimulationData.TerrainHeight;
     
-    // Calculate foam based on multiple conditions
-    for (int32 Y = 1; Y < Height - 1; Y++)
+    // Per-cell products of the water grid only change on tiles the water step touched
+    const uint8 TileWork = Work & (FWaterPostPass::Work_Foam | FWaterPostPass::Work_ChunkStats);
+    if (TileWork)
     {
-        for (int32 X = 1; X < Width - 1; X++)
+        // Grown by one cell: foam at a tile edge reads the neighbouring tile's velocities
+        SimulationData.ConsumeChangedTiles(EWaterChangeConsumer::PostPass, [this, TileWork](const FIntRect& CellRect)
         {
-            int32 Index = Y * Width + X;
-            
-            float WaterDepth = SimulationData.WaterDepthMap[Index];
-            if (WaterDepth < MinWaterDepth)
-            {
-                SimulationData.FoamMap[Index] = 0.0f;
-                continue;
-            }
-            
-            // Edge foam (shallow water)
-            float EdgeFoam = 1.0f - FMath::Clamp(WaterDepth / 0.5f, 0.0f, 1.0f);
-            
-            // Velocity foam (turbulence)
-            float FlowSpeed = FMath::Sqrt(
-                SimulationData.WaterVelocityX[Index] * SimulationData.WaterVelocityX[Index] +
-                SimulationData.WaterVelocityY[Index] * SimulationData.WaterVelocityY[Index]
-            );
-            float VelocityFoam = FMath::Clamp(FlowSpeed / 20.0f, 0.0f, 1.0f);
-            
-            // Flow convergence foam (where flows meet)
-            float LeftVelX = SimulationData.WaterVelocityX[Y * Width + (X - 1)];
-            float RightVelX = SimulationData.WaterVelocityX[Y * Width + (X + 1)];
-            float UpVelY = SimulationData.WaterVelocityY[(Y - 1) * Width + X];
-            float DownVelY = SimulationData.WaterVelocityY[(Y + 1) * Width + X];
-            
-            float Divergence = (RightVelX - LeftVelX) + (DownVelY - UpVelY);
-            float ConvergenceFoam = FMath::Clamp(-Divergence * 5.0f, 0.0f, 1.0f);
-            
-            // Terrain slope foam (waterfalls)
-            float TerrainHeight = GetTerrainHeightSafe(X, Y);
-            float LeftHeight = GetTerrainHeightSafe(X - 1, Y);
-            float RightHeight = GetTerrainHeightSafe(X + 1, Y);
-            float UpHeight = GetTerrainHeightSafe(X, Y - 1);
-            float DownHeight = GetTerrainHeightSafe(X, Y + 1);
-            
-            float MaxGradient = FMath::Max(
-                FMath::Abs(TerrainHeight - LeftHeight),
-                FMath::Max(
-                    FMath::Abs(TerrainHeight - RightHeight),
-                    FMath::Max(
-                        FMath::Abs(TerrainHeight - UpHeight),
-                        FMath::Abs(TerrainHeight - DownHeight)
-                    )
-                )
-            );
-            float SlopeFoam = FMath::Clamp(MaxGradient / 100.0f, 0.0f, 1.0f);
-            
-            // Combine foam factors
-            float TotalFoam = FMath::Clamp(
-                EdgeFoam + VelocityFoam * 0.5f + ConvergenceFoam + SlopeFoam,
-                0.0f, 1.0f
-            );
-            
-            SimulationData.FoamMap[Index] = TotalFoam;
+            WaterPostPass.MarkCells(FIntRect(CellRect.Min - 1, CellRect.Max + 1), TileWork);
+        });
+    }
+    
+    FWaterPostPassOutputs Outputs;
+    Outputs.Foam = SimulationData.FoamMap.Num() == Width * Height ? SimulationData.FoamMap.GetData() : nullptr;
+    
+    // Texture staging covers the upload regions, which already carry their own change tracking
+    FGPUUploadStagingRing::FSlot* ErosionSlot = (Work & FWaterPostPass::Work_ErosionStaging) ? BeginErosionUpload() : nullptr;
+    if (ErosionSlot)
+    {
+        GetErosionStagingPlanes(ErosionSlot, Outputs);
+        for (const FUpdateTextureRegion2D& Region : ErosionSlot->Regions)
+        {
+            WaterPostPass.MarkCells(FIntRect(Region.SrcX, Region.SrcY, Region.SrcX + Region.Width - 1, Region.SrcY + Region.Height - 1),
+                                    FWaterPostPass::Work_ErosionStaging);
+        }
+    }
+    
+    // Smoothed depth textures need neighbourhood windows and stay on UpdateWaterDepthTexture's filter path
+    FGPUUploadStagingRing::FSlot* DepthSlot = ((Work & FWaterPostPass::Work_DepthTexels) && !bUse8DirectionalFlow) ?
+        BeginDepthTextureUpload(0) : nullptr;
+    if (DepthSlot)
+    {
+        Outputs.DepthTexels = DepthSlot->Data.GetData();
+        for (const FUpdateTextureRegion2D& Region : DepthSlot->Regions)
+        {
+            WaterPostPass.MarkCells(FIntRect(Region.SrcX, Region.SrcY, Region.SrcX + Region.Width - 1, Region.SrcY + Region.Height - 1),
+                                    FWaterPostPass::Work_DepthTexels);
         }
     }
+    
+    FWaterPostPassInputs Inputs;
+    Inputs.Depth = SimulationData.WaterDepthMap.GetData();
+    Inputs.VelocityX = SimulationData.WaterVelocityX.GetData();
+    Inputs.VelocityY = SimulationData.WaterVelocityY.GetData();
+    Inputs.Sediment = SimulationData.SedimentMap.Num() == Width * Height ? SimulationData.SedimentMap.GetData() : nullptr;
+    Inputs.TerrainHeights = (OwnerTerrain && OwnerTerrain->HeightMap.Num() == Width * Height) ? OwnerTerrain->HeightMap.GetData() : nullptr;
+    Inputs.WetDepth = MinWaterDepth;
+    Inputs.DepthEncoding = FWaterDepthEncoding(MinWaterDepth, WaterDepthScale, bUseGammaCorrection, WaterDepthGamma);
+    
+    WaterPostPass.Execute(Inputs, Outputs);
+    
+    if (ErosionSlot)
+    {
+        SubmitErosionUpload(ErosionSlot);
+    }
+    if (DepthSlot)
+    {
+        SubmitDepthTextureUpload(DepthSlot);
+    }
 }
 
 
@@ -4112,6 +4745,9 @@ void UWaterSystem::AddWaterInRadius(int32 CenterX, int32 CenterY, float Radius,
     float TotalWaterAdded = 0.0f;
     if (TotalWeight > 0.0f)
     {
+        const int32 Halo = IntRadius + FWaterSimulationData::ActiveHalo;
+        SimulationData.MarkRegionActive(CenterX - Halo, CenterY - Halo, CenterX + Halo, CenterY + Halo);
+        
         for (int32 OffsetY = -IntRadius; OffsetY <= IntRadius; OffsetY++)
         {
             for (int32 OffsetX = -IntRadius; OffsetX <= IntRadius; OffsetX++)
@@ -4170,6 +4806,7 @@ void UWaterSystem::AddWaterAtIndex(int32 X, int32 Y, float Amount)
     if (Index >= 0 && Index < SimulationData.WaterDepthMap.Num())
     {
         SimulationData.WaterDepthMap[Index] += Amount;
+        SimulationData.MarkCellActive(X, Y);
         
         // Mark chunk for visual update
         MarkChunkForUpdate(X, Y);
@@ -4322,6 +4959,20 @@ float UWaterSystem::GetWaterDepthAtIndex(int32 X, int32 Y) const
     return GetWaterDepthSafe(X, Y);
 }
 
+int32 UWaterSystem::GetWaterCellIndexAtPosition(FVector WorldPosition) const
+{
+    if (!SimulationData.IsValid())
+    {
+        return INDEX_NONE;
+    }
+    
+    // Same mapping as GetWaterDepthAtPosition
+    FVector2D TerrainCoords = WorldToTerrainCoordinates(WorldPosition);
+    int32 Index = GetTerrainIndex(FMath::FloorToInt(TerrainCoords.X), FMath::FloorToInt(TerrainCoords.Y));
+    
+    return SimulationData.WaterDepthMap.IsValidIndex(Index) ? Index : INDEX_NONE;
+}
+
 // ===== WEATHER SYSTEM =====
 
 
@@ -4418,6 +5069,7 @@ void UWaterSystem::SetWaterDepthSafe(int32 X, int32 Y, float Depth)
     if (Index >= 0 && Index < SimulationData.WaterDepthMap.Num())
     {
         SimulationData.WaterDepthMap[Index] = FMath::Max(0.0f, Depth);
+        SimulationData.MarkCellActive(X, Y);
     }
 }
 
@@ -4948,6 +5600,7 @@ void UWaterSystem::CreateWaterDepthTexture()
         UE_LOG(LogTemp, Log, TEXT("Water depth texture created and GPU-validated: %dx%d"), Width, Height);
         
         // Immediately populate with initial data
+        DepthTextureDirtyRegions.Initialize(Width, Height, FWaterSimulationData::ActiveTileSize);
         UpdateWaterDepthTexture();
     }
     else
@@ -4959,187 +5612,109 @@ void UWaterSystem::CreateWaterDepthTexture()
 
 void UWaterSystem::UpdateWaterDepthTexture()
 {
-    if (!WaterDepthTexture || !SimulationData.IsValid())
+    // Without smoothing every texel depends only on its own cell, so the fused post-pass writes them
+    if (!bUse8DirectionalFlow)
+    {
+        RunWaterPostPass(FWaterPostPass::Work_DepthTexels);
+        return;
+    }
+    
+    // Two smoothing passes plus the edge-preserving pass each reach one texel further
+    const int32 FilterHalo = 3;
+    FGPUUploadStagingRing::FSlot* Slot = BeginDepthTextureUpload(FilterHalo);
+    if (!Slot)
         return;
     
     const int32 Width = SimulationData.TerrainWidth;
     const int32 Height = SimulationData.TerrainHeight;
+    uint8* TextureData = Slot->Data.GetData();
+    const FWaterDepthEncoding Encoding(MinWaterDepth, WaterDepthScale, bUseGammaCorrection, WaterDepthGamma);
     
-    // Create floating-point buffer for smooth processing
-    TArray<float> FloatBuffer;
-    FloatBuffer.SetNum(Width * Height);
-    
-    // Track water statistics for debugging
+    // Track water statistics for debugging (over the regions processed this frame)
     int32 NonZeroPixels = 0;
     float MaxWaterDepth = 0.0f;
     float MinNonZeroDepth = FLT_MAX;
     
-    // Step 1: Convert water depth to normalized float values with smooth thresholding
-    for (int32 Y = 0; Y < Height; Y++)
-    {
-        for (int32 X = 0; X < Width; X++)
-        {
-            int32 Index = Y * Width + X;
-            if (Index < SimulationData.WaterDepthMap.Num())
+    // Each region is filtered in a window grown by the filter reach. Texels within FilterHalo of
+    // a window edge that is not the texture edge see padding instead of real neighbours, but only
+    // the region itself (FilterHalo inside the window) is converted, so the result is exact.
+    for (const FUpdateTextureRegion2D& Region : Slot->Regions)
+    {
+        const FIntRect Window(FMath::Max((int32)Region.SrcX - FilterHalo, 0),
+                              FMath::Max((int32)Region.SrcY - FilterHalo, 0),
+                              FMath::Min((int32)(Region.SrcX + Region.Width) + FilterHalo, Width),
+                              FMath::Min((int32)(Region.SrcY + Region.Height) + FilterHalo, Height));
+        FPaddedGrid* FloatBuffer = &DepthTextureFilterGrids[0];
+        FPaddedGrid* TempBuffer = &DepthTextureFilterGrids[1];
+        FloatBuffer->Resize(Window.Width(), Window.Height());
+        int32 WindowNonZeroPixels = 0;
+        
+        // Step 1: Convert water depth to normalized float values with smooth thresholding
+        for (int32 Y = Window.Min.Y; Y < Window.Max.Y; Y++)
+        {
+            float* FloatRow = FloatBuffer->Row(Y - Window.Min.Y) - Window.Min.X;
+            for (int32 X = Window.Min.X; X < Window.Max.X; X++)
             {
-                float WaterDepth = SimulationData.WaterDepthMap[Index];
-                
-                // ELEGANT SMOOTH THRESHOLD: Use smooth step instead of hard cutoff
-                float ProcessedDepth = 0.0f;
-                
-                // Define the transition zone
-                float TransitionStart = MinWaterDepth * 0.5f;  // Start fading in
-                float TransitionEnd = MinWaterDepth * 2.0f;    // Fully visible
-                
-                if (WaterDepth <= TransitionStart)
-                {
-                    // No water
-                    ProcessedDepth = 0.0f;
-                }
-                else if (WaterDepth >= TransitionEnd)
-                {
-                    // Full water
-                    ProcessedDepth = WaterDepth;
-                }
-                else
-                {
-                    // Smooth transition zone - this prevents shoreline dancing
-                    float t = (WaterDepth - TransitionStart) / (TransitionEnd - TransitionStart);
-                    // Smooth step function: 3t  - 2t
-                    float smoothT = t * t * (3.0f - 2.0f * t);
-                    ProcessedDepth = WaterDepth * smoothT;
-                }
+                const float WaterDepth = SimulationData.WaterDepthMap[Y * Width + X];
+                const float Value = Encoding.Normalize(WaterDepth);
                 
                 // Update statistics
-                if (ProcessedDepth > 0.0f)
+                if (Value > 0.0f)
                 {
-                    NonZeroPixels++;
+                    WindowNonZeroPixels++;
                     MaxWaterDepth = FMath::Max(MaxWaterDepth, WaterDepth);
                     MinNonZeroDepth = FMath::Min(MinNonZeroDepth, WaterDepth);
                 }
-                
-                // Normalize to 0-1 range for processing
-                FloatBuffer[Index] = ProcessedDepth / WaterDepthScale;
-            }
-            else
-            {
-                FloatBuffer[Index] = 0.0f;
+                FloatRow[X] = Value;
             }
         }
-    }
-    
-    // Step 2: Apply 8-directional smoothing if enabled
-    if (bUse8DirectionalFlow && NonZeroPixels > 0)
-    {
-        // Number of smoothing iterations - more passes = smoother result
-        const int32 SmoothingPasses = 2;
+        NonZeroPixels += WindowNonZeroPixels;
         
-        // Temporary buffer for ping-pong smoothing
-        TArray<float> TempBuffer;
-        TempBuffer.SetNum(Width * Height);
-        
-        for (int32 Pass = 0; Pass < SmoothingPasses; Pass++)
+        // Step 2: Apply 8-directional smoothing (a dry window stays all zero)
+        if (WindowNonZeroPixels > 0)
         {
-            // Copy current state
-            TempBuffer = FloatBuffer;
+            // Number of smoothing iterations - more passes = smoother result
+            const int32 SmoothingPasses = 2;
             
-            // Apply smoothing filter to all pixels
-            for (int32 Y = 0; Y < Height; Y++)
+            // 8-directional Gaussian-like kernel; the padded border reproduces edge clamping
+            for (int32 Pass = 0; Pass < SmoothingPasses; Pass++)
             {
-                for (int32 X = 0; X < Width; X++)
-                {
-                    int32 Index = Y * Width + X;
-                    
-                    // 8-directional Gaussian-like kernel
-                    const float CenterWeight = 4.0f;
-                    const float CardinalWeight = 2.0f;
-                    const float DiagonalWeight = DiagonalFlowWeight;
-                    
-                    float WeightedSum = 0.0f;
-                    float TotalWeight = 0.0f;
-                    
-                    // Process all 9 positions (8 neighbors + center)
-                    for (int32 dy = -1; dy <= 1; dy++)
-                    {
-                        for (int32 dx = -1; dx <= 1; dx++)
-                        {
-                            int32 NX = X + dx;
-                            int32 NY = Y + dy;
-                            
-                            // Handle boundaries with clamping
-                            NX = FMath::Clamp(NX, 0, Width - 1);
-                            NY = FMath::Clamp(NY, 0, Height - 1);
-                            
-                            int32 NeighborIndex = NY * Width + NX;
-                            float NeighborValue = TempBuffer[NeighborIndex];
-                            
-                            // Determine weight based on position
-                            float Weight;
-                            if (dx == 0 && dy == 0)
-                            {
-                                Weight = CenterWeight;
-                            }
-                            else if (dx == 0 || dy == 0)
-                            {
-                                Weight = CardinalWeight;
-                            }
-                            else
-                            {
-                                Weight = DiagonalWeight;
-                            }
-                            
-                            WeightedSum += NeighborValue * Weight;
-                            TotalWeight += Weight;
-                        }
-                    }
-                    
-                    // Apply smoothed value
-                    FloatBuffer[Index] = WeightedSum / TotalWeight;
-                }
+                FloatBuffer->ReplicateBorder();
+                DepthTextureFilter.WeightedSmooth(*FloatBuffer, *TempBuffer, 4.0f, 2.0f, DiagonalFlowWeight);
+                Swap(FloatBuffer, TempBuffer);
+            }
+            
+            // Optional: Apply edge-preserving filter to maintain sharp features where needed
+            if (bPreserveWaterEdges)
+            {
+                ApplyEdgePreservingFilter(*FloatBuffer, *TempBuffer, Window);
+                Swap(FloatBuffer, TempBuffer);
             }
         }
         
-        // Optional: Apply edge-preserving filter to maintain sharp features where needed
-        if (bPreserveWaterEdges)
-        {
-            ApplyEdgePreservingFilter(FloatBuffer, Width, Height);
-        }
-    }
-    
-    // Step 3: Convert back to uint8 texture data with proper scaling
-    TArray<uint8> TextureData;
-    TextureData.SetNum(Width * Height);
-    
-    for (int32 i = 0; i < FloatBuffer.Num(); i++)
-    {
-        float Value = FloatBuffer[i];
-        
-        // Apply final adjustments
-        if (Value > 0.0f)
+        // Step 3: Convert the region to uint8 texels in the staging slot
+        for (uint32 Row = Region.SrcY; Row < Region.SrcY + Region.Height; Row++)
         {
-            // Ensure minimum visible value for any water
-            Value = FMath::Max(Value, 1.0f / 255.0f);
+            const float* FloatRow = FloatBuffer->Row(Row - Window.Min.Y) + (Region.SrcX - Window.Min.X);
+            uint8* TexelRow = TextureData + Row * Width + Region.SrcX;
             
-            // Optional: Apply gamma correction for better visual distribution
             if (bUseGammaCorrection)
             {
-                Value = FMath::Pow(Value, WaterDepthGamma);
+                // Optional: Apply gamma correction for better visual distribution
+                for (uint32 i = 0; i < Region.Width; i++)
+                {
+                    TexelRow[i] = Encoding.ToTexel(FloatRow[i]);
+                }
+            }
+            else
+            {
+                FGPUUploadConvert::FloatToUNorm8(FloatRow, TexelRow, Region.Width, FWaterDepthEncoding::MinVisibleValue);
             }
         }
-        
-        // Convert to uint8 with proper rounding
-        TextureData[i] = (uint8)FMath::RoundToInt(FMath::Clamp(Value * 255.0f, 0.0f, 255.0f));
     }
     
-    // Step 4: Upload to GPU
-    FTexture2DMipMap& Mip = WaterDepthTexture->GetPlatformData()->Mips[0];
-    void* Data = Mip.BulkData.Lock(LOCK_READ_WRITE);
-    if (Data)
-    {
-        FMemory::Memcpy(Data, TextureData.GetData(), TextureData.Num() * sizeof(uint8));
-        Mip.BulkData.Unlock();
-        WaterDepthTexture->UpdateResource();
-    }
+    // Step 4: Upload only the dirty regions
+    SubmitDepthTextureUpload(Slot);
     
     // Step 5: Log statistics (throttled)
     static float LastLogTime = 0.0f;
@@ -5150,159 +5725,106 @@ void UWaterSystem::UpdateWaterDepthTexture()
                NonZeroPixels, MaxWaterDepth, MinNonZeroDepth);
         LastLogTime = CurrentTime;
     }
-
-    // PHASE 1.5: Copy current depth to previous depth for next frame's displacement detection
-    if (PreviousWaterDepthTexture)
-    {
-        FTexture2DMipMap& PrevMip = PreviousWaterDepthTexture->GetPlatformData()->Mips[0];
-        void* PrevData = PrevMip.BulkData.Lock(LOCK_READ_WRITE);
-        if (PrevData)
-        {
-            FMemory::Memcpy(PrevData, TextureData.GetData(), TextureData.Num() * sizeof(uint8));
-            PrevMip.BulkData.Unlock();
-            PreviousWaterDepthTexture->UpdateResource();
-        }
-    }
 }
 
-
-// ============================================================
-// SUBSYSTEM 5.4: QUALITY & FILTERING
-// ============================================================
-// Edge-preserving filters and spatial smoothing for visual quality.
-// Applies sophisticated filtering to prevent aliasing and artifacts
-// while preserving sharp features like shorelines and flow boundaries.
-// ============================================================
-
-void UWaterSystem::ApplyEdgePreservingFilter(TArray<float>& Buffer, int32 Width, int32 Height)
+FGPUUploadStagingRing::FSlot* UWaterSystem::BeginDepthTextureUpload(int32 FilterHalo)
 {
-    TArray<float> TempBuffer = Buffer;
+    if (!WaterDepthTexture || !SimulationData.IsValid())
+        return nullptr;
     
-    for (int32 Y = 1; Y < Height - 1; Y++)
-    {
-        for (int32 X = 1; X < Width - 1; X++)
-        {
-            int32 Index = Y * Width + X;
-            float CenterValue = TempBuffer[Index];
-            
-            // Skip if no water
-            if (CenterValue < 0.0001f)
-                continue;
-            
-            // Calculate local gradient
-            float GradientX = FMath::Abs(TempBuffer[Index + 1] - TempBuffer[Index - 1]);
-            float GradientY = FMath::Abs(TempBuffer[Index + Width] - TempBuffer[Index - Width]);
-            float Gradient = FMath::Max(GradientX, GradientY);
-            
-            // Only smooth low-gradient areas
-            const float GradientThreshold = 0.1f;
-            if (Gradient < GradientThreshold)
-            {
-                // Apply smoothing
-                float Sum = 0.0f;
-                int32 Count = 0;
-                
-                for (int32 dy = -1; dy <= 1; dy++)
-                {
-                    for (int32 dx = -1; dx <= 1; dx++)
-                    {
-                        int32 NeighborIndex = (Y + dy) * Width + (X + dx);
-                        if (TempBuffer[NeighborIndex] > 0.001f)
-                        {
-                            Sum += TempBuffer[NeighborIndex];
-                            Count++;
-                        }
-                    }
-                }
-                
-                if (Count > 0)
-                {
-                    float SmoothedValue = Sum / Count;
-                    // Blend based on gradient
-                    float BlendFactor = 1.0f - (Gradient / GradientThreshold);
-                    Buffer[Index] = FMath::Lerp(CenterValue, SmoothedValue, BlendFactor * 0.5f);
-                }
-            }
-        }
-    }
-}
-
-void UWaterSystem::SmoothWaterDepthMap()
-{
-    if (!SimulationData.IsValid() || !bEnableSimulationSmoothing)
-        return;
-        
     const int32 Width = SimulationData.TerrainWidth;
     const int32 Height = SimulationData.TerrainHeight;
     
-    TArray<float> SmoothedDepths = SimulationData.WaterDepthMap;
+    if (WaterDepthTexture->GetSizeX() != Width || WaterDepthTexture->GetSizeY() != Height ||
+        SimulationData.WaterDepthMap.Num() < Width * Height)
+        return nullptr;
     
-    // Apply Gaussian-like smoothing
-    for (int32 Y = 1; Y < Height - 1; Y++)
+    // Which texels can differ from the last upload: tiles with water changes, grown by the smoothing reach
+    const uint32 SettingsHash = HashCombine(HashCombine(GetTypeHash(MinWaterDepth), GetTypeHash(WaterDepthScale)),
+        HashCombine(HashCombine(GetTypeHash(bUse8DirectionalFlow), GetTypeHash(DiagonalFlowWeight)),
+        HashCombine(GetTypeHash(bPreserveWaterEdges), HashCombine(GetTypeHash(bUseGammaCorrection), GetTypeHash(WaterDepthGamma)))));
+    if (!DepthTextureDirtyRegions.Matches(Width, Height))
     {
-        for (int32 X = 1; X < Width - 1; X++)
-        {
-            int32 Index = Y * Width + X;
-            
-            // Only smooth cells that have water or are near water
-            float CenterDepth = SimulationData.WaterDepthMap[Index];
-            if (CenterDepth <= 0.001f)
-            {
-                // Check if any neighbor has water
-                bool bHasWaterNearby = false;
-                for (int32 dy = -1; dy <= 1 && !bHasWaterNearby; dy++)
-                {
-                    for (int32 dx = -1; dx <= 1 && !bHasWaterNearby; dx++)
-                    {
-                        if (dx == 0 && dy == 0) continue;
-                        int32 NIndex = (Y + dy) * Width + (X + dx);
-                        if (SimulationData.WaterDepthMap[NIndex] > MinWaterDepth)
-                            bHasWaterNearby = true;
-                    }
-                }
-                
-                if (!bHasWaterNearby) continue;
-            }
-                
-            float Sum = 0.0f;
-            float Weight = 0.0f;
-            
-            // 3x3 Gaussian kernel approximation
-            const float Kernel[3][3] = {
-                {0.0625f, 0.125f, 0.0625f},
-                {0.125f,  0.25f,  0.125f},
-                {0.0625f, 0.125f, 0.0625f}
-            };
-            
-            for (int32 dy = -1; dy <= 1; dy++)
-            {
-                for (int32 dx = -1; dx <= 1; dx++)
-                {
-                    int32 NX = X + dx;
-                    int32 NY = Y + dy;
-                    
-                    // Boundary check
-                    if (NX >= 0 && NX < Width && NY >= 0 && NY < Height)
-                    {
-                        int32 NIndex = NY * Width + NX;
-                        float KernelWeight = Kernel[dy + 1][dx + 1];
-                        Sum += SimulationData.WaterDepthMap[NIndex] * KernelWeight;
-                        Weight += KernelWeight;
-                    }
-                }
-            }
-            
-            if (Weight > 0.0f)
-            {
-                float SmoothedValue = Sum / Weight;
-                // Blend with original based on smoothing strength
-                SmoothedDepths[Index] = FMath::Lerp(CenterDepth, SmoothedValue, SimulationSmoothingStrength * 2.0f); //doubled smoothing
-            }
-        }
+        DepthTextureDirtyRegions.Initialize(Width, Height, FWaterSimulationData::ActiveTileSize);
+    }
+    else if (SettingsHash != DepthTextureSettingsHash)
+    {
+        DepthTextureDirtyRegions.MarkAll();
+    }
+    DepthTextureSettingsHash = SettingsHash;
+    
+    CollectTextureDirtyRegions(EWaterChangeConsumer::DepthTexture, DepthTextureDirtyRegions, FilterHalo);
+    if (DepthTextureDirtyRegions.IsEmpty())
+        return nullptr;
+    
+    FGPUUploadStagingRing::FSlot* Slot = DepthTextureUploadRing.Acquire(int64(Width) * Height);
+    if (!Slot)
+    {
+        // Every slot is still queued on the render thread; the regions stay dirty for next frame
+        return nullptr;
+    }
+    
+    DepthTextureDirtyRegions.Consume(Slot->Regions);
+    return Slot;
+}
+
+void UWaterSystem::SubmitDepthTextureUpload(FGPUUploadStagingRing::FSlot* Slot)
+{
+    const int32 Width = SimulationData.TerrainWidth;
+    const int32 Height = SimulationData.TerrainHeight;
+    
+    // Only the dirty regions (no bulk data lock, no resource recreation)
+    WaterDepthTexture->UpdateTextureRegions(0, Slot->Regions.Num(), Slot->Regions.GetData(), Width, sizeof(uint8), Slot->Data.GetData());
+    
+    // PHASE 1.5: Copy current depth to previous depth for next frame's displacement detection
+    if (PreviousWaterDepthTexture && PreviousWaterDepthTexture->GetSizeX() == Width && PreviousWaterDepthTexture->GetSizeY() == Height)
+    {
+        PreviousWaterDepthTexture->UpdateTextureRegions(0, Slot->Regions.Num(), Slot->Regions.GetData(), Width, sizeof(uint8), Slot->Data.GetData());
     }
     
-    // Apply smoothed values back
-    SimulationData.WaterDepthMap = SmoothedDepths;
+    DepthTextureUploadRing.Submit(Slot);
+}
+
+
+// ============================================================
+// SUBSYSTEM 5.4: QUALITY & FILTERING
+// ============================================================
+// Edge-preserving filters and spatial smoothing for visual quality.
+// Applies sophisticated filtering to prevent aliasing and artifacts
+// while preserving sharp features like shorelines and flow boundaries.
+// ============================================================
+
+void UWaterSystem::ApplyEdgePreservingFilter(const FPaddedGrid& Source, FPaddedGrid& Dest, const FIntRect& ImageRect)
+{
+    // The texture's outermost texels are left unfiltered; ImageRect places the window in the texture
+    const FIntRect Cells(FMath::Max(1 - ImageRect.Min.X, 0),
+                         FMath::Max(1 - ImageRect.Min.Y, 0),
+                         FMath::Min(SimulationData.TerrainWidth - 1, ImageRect.Max.X) - ImageRect.Min.X,
+                         FMath::Min(SimulationData.TerrainHeight - 1, ImageRect.Max.Y) - ImageRect.Min.Y);
+    
+    // Only smooth low-gradient areas, blending toward the mean of the wet neighbours
+    DepthTextureFilter.EdgePreservingSmooth(Source, Dest, Cells, 0.001f, 0.1f);
+}
+
+void UWaterSystem::SmoothWaterDepthMap()
+{
+    if (!SimulationData.IsValid() || !bEnableSimulationSmoothing)
+        return;
+        
+    const int32 Width = SimulationData.TerrainWidth;
+    const int32 Height = SimulationData.TerrainHeight;
+    
+    // Only active tiles are filtered; cells outside them hold at most a sub-MinWaterDepth film
+    // with no wet neighbour, which the solver passes leave alone as well
+    auto ActiveSpans = [this](int32 Y) { return SimulationData.GetActiveSpans(Y); };
+    SmoothingSourceGrid.Resize(Width, Height);
+    SmoothingSourceGrid.GatherSpans(SimulationData.WaterDepthMap.GetData(), ActiveSpans);
+    
+    // 3x3 Gaussian kernel approximation on cells that have water or are near water,
+    // blended with original based on smoothing strength (doubled smoothing)
+    SimulationSmoothingFilter.bParallel = bUseParallelWaterSolver;
+    SimulationSmoothingFilter.WetGaussianBlend(SmoothingSourceGrid, SimulationData.WaterDepthMap.GetData(), Width, ActiveSpans,
+                                               0.001f, MinWaterDepth, SimulationSmoothingStrength * 2.0f);
 }
 
 // Apply edge-aware spatial smoothing to reduce artifacts
@@ -5314,83 +5836,17 @@ void UWaterSystem::ApplySpatialSmoothing()
     const int32 Width = SimulationData.TerrainWidth;
     const int32 Height = SimulationData.TerrainHeight;
     
-    // Only smooth areas with water gradients
-    TArray<float> SmoothedDepths = SimulationData.WaterDepthMap;
-    
-    for (int32 Y = 1; Y < Height - 1; Y++)
-    {
-        for (int32 X = 1; X < Width - 1; X++)
-        {
-            int32 Index = Y * Width + X;
-            float CenterDepth = SimulationData.WaterDepthMap[Index];
-            
-            // Skip completely dry cells
-            if (CenterDepth <= 0.0f)
-                continue;
-            
-            // Check if this cell is near a water edge (high gradient)
-            bool bNearEdge = false;
-            float MaxDiff = 0.0f;
-            
-            for (int32 dy = -1; dy <= 1; dy++)
-            {
-                for (int32 dx = -1; dx <= 1; dx++)
-                {
-                    if (dx == 0 && dy == 0) continue;
-                    
-                    int32 NIndex = (Y + dy) * Width + (X + dx);
-                    float Diff = FMath::Abs(SimulationData.WaterDepthMap[NIndex] - CenterDepth);
-                    MaxDiff = FMath::Max(MaxDiff, Diff);
-                    
-                    // Detect edges
-                    if (Diff > MinWaterDepth * 2.0f)
-                    {
-                        bNearEdge = true;
-                    }
-                }
-            }
-            
-            // Apply smoothing only near edges to preserve bulk water behavior
-            if (bNearEdge && MaxDiff > 0.0f)
-            {
-                float Sum = 0.0f;
-                float TotalWeight = 0.0f;
-                
-                // Use distance-weighted averaging
-                for (int32 dy = -1; dy <= 1; dy++)
-                {
-                    for (int32 dx = -1; dx <= 1; dx++)
-                    {
-                        int32 NX = X + dx;
-                        int32 NY = Y + dy;
-                        
-                        if (NX >= 0 && NX < Width && NY >= 0 && NY < Height)
-                        {
-                            int32 NIndex = NY * Width + NX;
-                            float NeighborDepth = SimulationData.WaterDepthMap[NIndex];
-                            
-                            // Weight by inverse depth difference
-                            float DepthDiff = FMath::Abs(NeighborDepth - CenterDepth);
-                            float Weight = 1.0f / (1.0f + DepthDiff * 10.0f);
-                            
-                            Sum += NeighborDepth * Weight;
-                            TotalWeight += Weight;
-                        }
-                    }
-                }
-                
-                if (TotalWeight > 0.0f)
-                {
-                    // Blend smoothed value with original
-                    float SmoothValue = Sum / TotalWeight;
-                    float BlendFactor = FMath::Clamp(MaxDiff / (MinWaterDepth * 10.0f), 0.0f, SimulationSmoothingStrength);
-                    SmoothedDepths[Index] = FMath::Lerp(CenterDepth, SmoothValue, BlendFactor);
-                }
-            }
-        }
-    }
+    // Only smooth areas with water gradients. Cells outside the active tiles are at least
+    // ActiveHalo + 1 cells from any wet cell, so no neighbour differs by the edge threshold
+    // and only the active spans need to be snapshotted and filtered
+    auto ActiveSpans = [this](int32 Y) { return SimulationData.GetActiveSpans(Y); };
+    SmoothingSourceGrid.Resize(Width, Height);
+    SmoothingSourceGrid.GatherSpans(SimulationData.WaterDepthMap.GetData(), ActiveSpans);
     
-    SimulationData.WaterDepthMap = SmoothedDepths;
+    // Distance-weighted averaging near water edges, preserving bulk water behavior
+    SimulationSmoothingFilter.bParallel = bUseParallelWaterSolver;
+    SimulationSmoothingFilter.EdgeAwareSmooth(SmoothingSourceGrid, SimulationData.WaterDepthMap.GetData(), Width, ActiveSpans,
+                                              MinWaterDepth, SimulationSmoothingStrength);
 }
 
 // ============================================================
@@ -5781,42 +6237,50 @@ void UWaterSystem::GenerateSmoothWaterSurface(FWaterSurfaceChunk& SurfaceChunk,
     }
     
     // Third pass: Generate triangles only where water exists
-    Triangles.Empty();
-    for (int32 Y = 0; Y < Resolution - 1; Y++)
+    // Fully submerged chunk: every vertex exists in grid order, so the shared grid index buffer applies
+    if (!WaterPresenceMap.Contains(false))
     {
-        for (int32 X = 0; X < Resolution - 1; X++)
+        Triangles = *FGridIndexBufferCache::Get().GetIndexBuffer(Resolution, Resolution);
+    }
+    else
+    {
+        Triangles.Empty();
+        for (int32 Y = 0; Y < Resolution - 1; Y++)
         {
-            int32 TopLeft = Y * Resolution + X;
-            int32 TopRight = Y * Resolution + (X + 1);
-            int32 BottomLeft = (Y + 1) * Resolution + X;
-            int32 BottomRight = (Y + 1) * Resolution + (X + 1);
-            
-            // Check if any corner has water
-            bool bHasWater = WaterPresenceMap[TopLeft] || WaterPresenceMap[TopRight] ||
-                            WaterPresenceMap[BottomLeft] || WaterPresenceMap[BottomRight];
-            
-            if (!bHasWater)
-                continue; // Skip triangles in completely dry areas
-            
-            // Get vertex indices (-1 if vertex doesn't exist)
-            int32 V0 = VertexIndexMap[TopLeft];
-            int32 V1 = VertexIndexMap[TopRight];
-            int32 V2 = VertexIndexMap[BottomLeft];
-            int32 V3 = VertexIndexMap[BottomRight];
-            
-            // Create triangles only if all three vertices exist
-            if (V0 >= 0 && V1 >= 0 && V2 >= 0)
+            for (int32 X = 0; X < Resolution - 1; X++)
             {
-                Triangles.Add(V0);
-                Triangles.Add(V2);
-                Triangles.Add(V1);
-            }
+                int32 TopLeft = Y * Resolution + X;
+                int32 TopRight = Y * Resolution + (X + 1);
+                int32 BottomLeft = (Y + 1) * Resolution + X;
+                int32 BottomRight = (Y + 1) * Resolution + (X + 1);
+            
+                // Check if any corner has water
+                bool bHasWater = WaterPresenceMap[TopLeft] || WaterPresenceMap[TopRight] ||
+                                WaterPresenceMap[BottomLeft] || WaterPresenceMap[BottomRight];
+            
+                if (!bHasWater)
+                    continue; // Skip triangles in completely dry areas
+            
+                // Get vertex indices (-1 if vertex doesn't exist)
+                int32 V0 = VertexIndexMap[TopLeft];
+                int32 V1 = VertexIndexMap[TopRight];
+                int32 V2 = VertexIndexMap[BottomLeft];
+                int32 V3 = VertexIndexMap[BottomRight];
+            
+                // Create triangles only if all three vertices exist
+                if (V0 >= 0 && V1 >= 0 && V2 >= 0)
+                {
+                    Triangles.Add(V0);
+                    Triangles.Add(V2);
+                    Triangles.Add(V1);
+                }
             
-            if (V1 >= 0 && V2 >= 0 && V3 >= 0)
-            {
-                Triangles.Add(V1);
-                Triangles.Add(V2);
-                Triangles.Add(V3);
+                if (V1 >= 0 && V2 >= 0 && V3 >= 0)
+                {
+                    Triangles.Add(V1);
+                    Triangles.Add(V2);
+                    Triangles.Add(V3);
+                }
             }
         }
     }
@@ -5991,42 +6455,50 @@ void UWaterSystem::GenerateSmoothWaterSurface_HighQuality(FWaterSurfaceChunk& Su
     SurfaceChunk.AverageDepth = WaterVertices > 0 ? (TotalDepth / WaterVertices) : 0.0f;
     
     // Third pass: Generate triangles only where water exists
-    Triangles.Empty();
-    for (int32 Y = 0; Y < Resolution - 1; Y++)
+    // Fully submerged chunk: every vertex exists in grid order, so the shared grid index buffer applies
+    if (!WaterPresenceMap.Contains(false))
     {
-        for (int32 X = 0; X < Resolution - 1; X++)
+        Triangles = *FGridIndexBufferCache::Get().GetIndexBuffer(Resolution, Resolution);
+    }
+    else
+    {
+        Triangles.Empty();
+        for (int32 Y = 0; Y < Resolution - 1; Y++)
         {
-            int32 TopLeft = Y * Resolution + X;
-            int32 TopRight = Y * Resolution + (X + 1);
-            int32 BottomLeft = (Y + 1) * Resolution + X;
-            int32 BottomRight = (Y + 1) * Resolution + (X + 1);
+            for (int32 X = 0; X < Resolution - 1; X++)
+            {
+                int32 TopLeft = Y * Resolution + X;
+                int32 TopRight = Y * Resolution + (X + 1);
+                int32 BottomLeft = (Y + 1) * Resolution + X;
+                int32 BottomRight = (Y + 1) * Resolution + (X + 1);
             
-            // Check if any corner has water
-            bool bHasWater = WaterPresenceMap[TopLeft] || WaterPresenceMap[TopRight] ||
-                            WaterPresenceMap[BottomLeft] || WaterPresenceMap[BottomRight];
+                // Check if any corner has water
+                bool bHasWater = WaterPresenceMap[TopLeft] || WaterPresenceMap[TopRight] ||
+                                WaterPresenceMap[BottomLeft] || WaterPresenceMap[BottomRight];
             
-            if (!bHasWater)
-                continue;
+                if (!bHasWater)
+                    continue;
             
-            // Get vertex indices
-            int32 V0 = VertexIndexMap[TopLeft];
-            int32 V1 = VertexIndexMap[TopRight];
-            int32 V2 = VertexIndexMap[BottomLeft];
-            int32 V3 = VertexIndexMap[BottomRight];
+                // Get vertex indices
+                int32 V0 = VertexIndexMap[TopLeft];
+                int32 V1 = VertexIndexMap[TopRight];
+                int32 V2 = VertexIndexMap[BottomLeft];
+                int32 V3 = VertexIndexMap[BottomRight];
             
-            // Create triangles only if vertices exist
-            if (V0 >= 0 && V1 >= 0 && V2 >= 0)
-            {
-                Triangles.Add(V0);
-                Triangles.Add(V2);
-                Triangles.Add(V1);
-            }
+                // Create triangles only if vertices exist
+                if (V0 >= 0 && V1 >= 0 && V2 >= 0)
+                {
+                    Triangles.Add(V0);
+                    Triangles.Add(V2);
+                    Triangles.Add(V1);
+                }
             
-            if (V1 >= 0 && V2 >= 0 && V3 >= 0)
-            {
-                Triangles.Add(V1);
-                Triangles.Add(V2);
-                Triangles.Add(V3);
+                if (V1 >= 0 && V2 >= 0 && V3 >= 0)
+                {
+                    Triangles.Add(V1);
+                    Triangles.Add(V2);
+                    Triangles.Add(V3);
+                }
             }
         }
     }
@@ -6263,8 +6735,7 @@ void UWaterSystem::CheckChunkBoundaryContinuity()
         for (int32 NeighborIndex : Neighbors)
         {
             // Find neighbor chunk in water chunks
-            const FWaterSurfaceChunk* ChunkB = WaterSurfaceChunks.FindByPredicate(
-                [NeighborIndex](const FWaterSurfaceChunk& C) { return C.ChunkIndex == NeighborIndex; });
+            const FWaterSurfaceChunk* ChunkB = FindWaterSurfaceChunk(NeighborIndex);
             
             if (ChunkB && ChunkA.SurfaceMesh && ChunkB->SurfaceMesh)
             {
@@ -7814,10 +8285,7 @@ bool UWaterSystem::NeedsMeshRegeneration(int32 ChunkIndex) const
     }
     
     // Find the water chunk for this terrain chunk
-    const FWaterSurfaceChunk* WaterChunk = WaterSurfaceChunks.FindByPredicate(
-        [ChunkIndex](const FWaterSurfaceChunk& Chunk) {
-            return Chunk.ChunkIndex == ChunkIndex;
-        });
+    const FWaterSurfaceChunk* WaterChunk = FindWaterSurfaceChunk(ChunkIndex);
     
     // ALWAYS regenerate if no water chunk exists yet
     if (!WaterChunk || !WaterChunk->SurfaceMesh)
@@ -7829,7 +8297,8 @@ bool UWaterSystem::NeedsMeshRegeneration(int32 ChunkIndex) const
     // Lowered the threshold significantly (was 100.0f, then 1.0f)
     const float REGENERATION_THRESHOLD = 0.1f; // Much more sensitive
     
-    // Calculate current water coverage
+    // Calculate current water coverage (wet cell count from the post-pass when it covers this chunk)
+    const FWaterChunkStats* ChunkStats = FindChunkWaterStats(ChunkIndex);
     const FTerrainChunk& TerrainChunk = OwnerTerrain->TerrainChunks[ChunkIndex];
     const int32 TerrainChunkSize = OwnerTerrain->ChunkSize;
     const int32 ChunkOverlap = OwnerTerrain->ChunkOverlap;
@@ -7839,8 +8308,8 @@ bool UWaterSystem::NeedsMeshRegeneration(int32 ChunkIndex) const
     int32 ChunkEndX = FMath::Min(ChunkStartX + TerrainChunkSize, OwnerTerrain->TerrainWidth);
     int32 ChunkEndY = FMath::Min(ChunkStartY + TerrainChunkSize, OwnerTerrain->TerrainHeight);
     
-    float CurrentArea = 0.0f;
-    for (int32 Y = ChunkStartY; Y < ChunkEndY; Y++)
+    float CurrentArea = ChunkStats ? (float)ChunkStats->WetCells : 0.0f;
+    for (int32 Y = ChunkStartY; Y < ChunkEndY && !ChunkStats; Y++)
     {
         for (int32 X = ChunkStartX; X < ChunkEndX; X++)
         {
@@ -7862,6 +8331,104 @@ bool UWaterSystem::NeedsMeshRegeneration(int32 ChunkIndex) const
     return false;
 }
 
+void UWaterSystem::RebuildWaterChunkIndex() const
+{
+    int32 NumEntries = OwnerTerrain ? OwnerTerrain->TerrainChunks.Num() : 0;
+    for (const FWaterSurfaceChunk& Chunk : WaterSurfaceChunks)
+    {
+        NumEntries = FMath::Max(NumEntries, Chunk.ChunkIndex + 1);
+    }
+    
+    WaterChunkByTerrainChunk.Init(INDEX_NONE, NumEntries);
+    for (int32 i = 0; i < WaterSurfaceChunks.Num(); i++)
+    {
+        // First match wins, as with a linear search
+        const int32 TerrainChunkIndex = WaterSurfaceChunks[i].ChunkIndex;
+        if (TerrainChunkIndex >= 0 && WaterChunkByTerrainChunk[TerrainChunkIndex] == INDEX_NONE)
+        {
+            WaterChunkByTerrainChunk[TerrainChunkIndex] = i;
+        }
+    }
+    
+    IndexedWaterChunkCount = WaterSurfaceChunks.Num();
+    IndexedLastWaterChunk = WaterSurfaceChunks.Num() > 0 ? WaterSurfaceChunks.Last().ChunkIndex : INDEX_NONE;
+}
+
+const FWaterSurfaceChunk* UWaterSystem::FindWaterSurfaceChunk(int32 TerrainChunkIndex) const
+{
+    const int32 LastChunkIndex = WaterSurfaceChunks.Num() > 0 ? WaterSurfaceChunks.Last().ChunkIndex : INDEX_NONE;
+    if (IndexedWaterChunkCount != WaterSurfaceChunks.Num() || IndexedLastWaterChunk != LastChunkIndex)
+    {
+        RebuildWaterChunkIndex();
+    }
+    
+    if (!WaterChunkByTerrainChunk.IsValidIndex(TerrainChunkIndex))
+    {
+        return nullptr;
+    }
+    
+    int32 WaterChunkIndex = WaterChunkByTerrainChunk[TerrainChunkIndex];
+    if (WaterChunkIndex != INDEX_NONE &&
+        (!WaterSurfaceChunks.IsValidIndex(WaterChunkIndex) || WaterSurfaceChunks[WaterChunkIndex].ChunkIndex != TerrainChunkIndex))
+    {
+        // Chunks were removed and appended in the same frame; the stale entry forces one rebuild
+        RebuildWaterChunkIndex();
+        WaterChunkIndex = WaterChunkByTerrainChunk[TerrainChunkIndex];
+    }
+    
+    return WaterChunkIndex != INDEX_NONE ? &WaterSurfaceChunks[WaterChunkIndex] : nullptr;
+}
+
+FWaterSurfaceChunk* UWaterSystem::FindWaterSurfaceChunk(int32 TerrainChunkIndex)
+{
+    return const_cast<FWaterSurfaceChunk*>(static_cast<const UWaterSystem*>(this)->FindWaterSurfaceChunk(TerrainChunkIndex));
+}
+
+void UWaterSystem::RefreshDisplacedWaterChunk(int32 ChunkIndex, bool bChunkHasWater)
+{
+    FWaterSurfaceChunk* WaterChunk = FindWaterSurfaceChunk(ChunkIndex);
+    
+    if (!bChunkHasWater)
+    {
+        // Water drained away: hide the old surface until it comes back
+        if (WaterChunk && WaterChunk->bHasWater)
+        {
+            WaterChunk->bHasWater = false;
+            if (WaterChunk->SurfaceMesh)
+            {
+                WaterChunk->SurfaceMesh->SetVisibility(false);
+            }
+        }
+        ChunkWaterAreas.Add(ChunkIndex, 0.0f);
+        return;
+    }
+    
+    if (!WaterChunk)
+    {
+        // Create new water chunk
+        const FTerrainChunk& TerrainChunk = OwnerTerrain->TerrainChunks[ChunkIndex];
+        FWaterSurfaceChunk NewChunk;
+        NewChunk.ChunkIndex = ChunkIndex;
+        NewChunk.ChunkX = TerrainChunk.ChunkX;
+        NewChunk.ChunkY = TerrainChunk.ChunkY;
+        NewChunk.bHasWater = true;
+        NewChunk.bNeedsUpdate = true;
+        WaterSurfaceChunks.Add(NewChunk);
+        
+        WaterChunk = &WaterSurfaceChunks.Last();
+    }
+    WaterChunk->bHasWater = true;
+    
+    // Ensure chunk has mesh
+    if (!WaterChunk->SurfaceMesh)
+    {
+        InitializeGPUChunkMesh(*WaterChunk);
+    }
+    
+    GenerateFlatBaseMesh(*WaterChunk);
+    ChunkWaterAreas.Add(ChunkIndex, CalculateChunkWaterArea(ChunkIndex));
+}
+
 void UWaterSystem::UpdateGPUWaterChunks()
 {
     if (!OwnerTerrain || !SimulationData.IsValid())
@@ -7904,12 +8471,14 @@ void UWaterSystem::UpdateGPUWaterChunks()
         
         // Check if chunk has water
         const FTerrainChunk& TerrainChunk = OwnerTerrain->TerrainChunks[ChunkIndex];
+        const FWaterChunkStats* ChunkStats = FindChunkWaterStats(ChunkIndex);
+        bHasWater = ChunkStats && ChunkStats->HasWater();
         int32 ChunkStartX = TerrainChunk.ChunkX * (OwnerTerrain->ChunkSize - OwnerTerrain->ChunkOverlap);
         int32 ChunkStartY = TerrainChunk.ChunkY * (OwnerTerrain->ChunkSize - OwnerTerrain->ChunkOverlap);
         int32 ChunkEndX = FMath::Min(ChunkStartX + OwnerTerrain->ChunkSize, SimulationData.TerrainWidth);
         int32 ChunkEndY = FMath::Min(ChunkStartY + OwnerTerrain->ChunkSize, SimulationData.TerrainHeight);
         
-        for (int32 Y = ChunkStartY; Y < ChunkEndY && !bHasWater; Y++)
+        for (int32 Y = ChunkStartY; Y < ChunkEndY && !bHasWater && !ChunkStats; Y++)
         {
             for (int32 X = ChunkStartX; X < ChunkEndX && !bHasWater; X++)
             {
@@ -7923,10 +8492,7 @@ void UWaterSystem::UpdateGPUWaterChunks()
         }
         
         // Find or create water chunk
-        FWaterSurfaceChunk* WaterChunk = WaterSurfaceChunks.FindByPredicate(
-            [ChunkIndex](const FWaterSurfaceChunk& Chunk) {
-                return Chunk.ChunkIndex == ChunkIndex;
-            });
+        FWaterSurfaceChunk* WaterChunk = FindWaterSurfaceChunk(ChunkIndex);
         
         if (bHasWater)
         {
@@ -7965,10 +8531,7 @@ void UWaterSystem::UpdateGPUWaterChunks()
     // Batch update all affected chunks
     for (int32 ChunkIndex : ChunksToUpdate)
     {
-        FWaterSurfaceChunk* Chunk = WaterSurfaceChunks.FindByPredicate(
-            [ChunkIndex](const FWaterSurfaceChunk& C) {
-                return C.ChunkIndex == ChunkIndex;
-            });
+        FWaterSurfaceChunk* Chunk = FindWaterSurfaceChunk(ChunkIndex);
         
         if (Chunk && Chunk->bHasWater)
         {
@@ -8186,53 +8749,61 @@ void UWaterSystem::GenerateFlatBaseMesh(FWaterSurfaceChunk& Chunk)
     int32 MeshWidth = MaxWaterX - MinWaterX + 1;
     int32 MeshHeight = MaxWaterY - MinWaterY + 1;
     
-    for (int32 Y = 0; Y < MeshHeight - 1; Y++)
+    // Solid rectangle of water: vertices are in grid order, use the shared index buffer
+    if (Vertices.Num() == MeshWidth * MeshHeight)
+    {
+        Triangles = *FGridIndexBufferCache::Get().GetIndexBuffer(MeshWidth, MeshHeight);
+    }
+    else
     {
-        for (int32 X = 0; X < MeshWidth - 1; X++)
+        for (int32 Y = 0; Y < MeshHeight - 1; Y++)
         {
-            FIntPoint TopLeft(X, Y);
-            FIntPoint TopRight(X + 1, Y);
-            FIntPoint BottomLeft(X, Y + 1);
-            FIntPoint BottomRight(X + 1, Y + 1);
+            for (int32 X = 0; X < MeshWidth - 1; X++)
+            {
+                FIntPoint TopLeft(X, Y);
+                FIntPoint TopRight(X + 1, Y);
+                FIntPoint BottomLeft(X, Y + 1);
+                FIntPoint BottomRight(X + 1, Y + 1);
             
-            int32* TL = VertexIndexMap.Find(TopLeft);
-            int32* TR = VertexIndexMap.Find(TopRight);
-            int32* BL = VertexIndexMap.Find(BottomLeft);
-            int32* BR = VertexIndexMap.Find(BottomRight);
+                int32* TL = VertexIndexMap.Find(TopLeft);
+                int32* TR = VertexIndexMap.Find(TopRight);
+                int32* BL = VertexIndexMap.Find(BottomLeft);
+                int32* BR = VertexIndexMap.Find(BottomRight);
             
-            if (TL && TR && BL && BR)
-            {
-                Triangles.Add(*TL);
-                Triangles.Add(*BL);
-                Triangles.Add(*TR);
+                if (TL && TR && BL && BR)
+                {
+                    Triangles.Add(*TL);
+                    Triangles.Add(*BL);
+                    Triangles.Add(*TR);
                 
-                Triangles.Add(*TR);
-                Triangles.Add(*BL);
-                Triangles.Add(*BR);
-            }
-            else if (TL && TR && BL)
-            {
-                Triangles.Add(*TL);
-                Triangles.Add(*BL);
-                Triangles.Add(*TR);
-            }
-            else if (TR && BL && BR)
-            {
-                Triangles.Add(*TR);
-                Triangles.Add(*BL);
-                Triangles.Add(*BR);
-            }
-            else if (TL && BL && BR)
-            {
-                Triangles.Add(*TL);
-                Triangles.Add(*BL);
-                Triangles.Add(*BR);
-            }
-            else if (TL && TR && BR)
-            {
-                Triangles.Add(*TL);
-                Triangles.Add(*TR);
-                Triangles.Add(*BR);
+                    Triangles.Add(*TR);
+                    Triangles.Add(*BL);
+                    Triangles.Add(*BR);
+                }
+                else if (TL && TR && BL)
+                {
+                    Triangles.Add(*TL);
+                    Triangles.Add(*BL);
+                    Triangles.Add(*TR);
+                }
+                else if (TR && BL && BR)
+                {
+                    Triangles.Add(*TR);
+                    Triangles.Add(*BL);
+                    Triangles.Add(*BR);
+                }
+                else if (TL && BL && BR)
+                {
+                    Triangles.Add(*TL);
+                    Triangles.Add(*BL);
+                    Triangles.Add(*BR);
+                }
+                else if (TL && TR && BR)
+                {
+                    Triangles.Add(*TL);
+                    Triangles.Add(*TR);
+                    Triangles.Add(*BR);
+                }
             }
         }
     }
@@ -8483,16 +9054,19 @@ bool UWaterSystem::HasWaterNeighbor(int32 X, int32 Y) const
 float UWaterSystem::CalculateChunkWaterArea(int32 TerrainChunkIndex) const
 {
     // Find the water chunk for this terrain chunk
-    const FWaterSurfaceChunk* WaterChunk = WaterSurfaceChunks.FindByPredicate(
-        [TerrainChunkIndex](const FWaterSurfaceChunk& Chunk) {
-            return Chunk.ChunkIndex == TerrainChunkIndex;
-        });
+    const FWaterSurfaceChunk* WaterChunk = FindWaterSurfaceChunk(TerrainChunkIndex);
     
     if (!WaterChunk)
     {
         return 0.0f;
     }
     
+    // Wet cell count over the terrain chunk's cells, the same measure NeedsMeshRegeneration compares against
+    if (const FWaterChunkStats* ChunkStats = FindChunkWaterStats(TerrainChunkIndex))
+    {
+        return (float)ChunkStats->WetCells;
+    }
+    
     float TotalArea = 0.0f;
     int32 StartX = WaterChunk->ChunkX * ChunkSize;
     int32 StartY = WaterChunk->ChunkY * ChunkSize;
@@ -8987,10 +9561,7 @@ void UWaterSystem::ForceGPUMeshRegeneration()
             ChunksWithWater++;
             
             // Find or create water chunk
-            FWaterSurfaceChunk* WaterChunk = WaterSurfaceChunks.FindByPredicate(
-                [ChunkIndex](FWaterSurfaceChunk& Chunk) {
-                    return Chunk.ChunkIndex == ChunkIndex;
-                });
+            FWaterSurfaceChunk* WaterChunk = FindWaterSurfaceChunk(ChunkIndex);
             
             if (!WaterChunk)
             {
@@ -9219,6 +9790,17 @@ void UWaterSystem::AccumulatePrecipitation(float DeltaTime)
     // Sample precipitation at a lower resolution for performance
     // Atmosphere grid is typically 64x64, terrain is 513x513
     const int32 SampleStep = FMath::Max(1, Width / 64);
+    const int32 SamplesX = FMath::DivideAndRoundUp(Width, SampleStep);
+    const int32 SamplesY = FMath::DivideAndRoundUp(Height, SampleStep);
+
+    // Query precipitation rate from atmosphere (mm/hour) for every sample point in one
+    // lock-free bilinear pass over an immutable snapshot
+    const FVector TerrainOrigin = OwnerTerrain->GetActorLocation();
+    const float SampleSpacing = SampleStep * OwnerTerrain->TerrainScale;
+    Atmosphere->SampleFieldToGrid(EAtmosphericField::Precipitation,
+                                  FVector2D(TerrainOrigin.X, TerrainOrigin.Y),
+                                  FVector2D(SampleSpacing, SampleSpacing),
+                                  SamplesX, SamplesY, PrecipitationSampleScratch);
 
     float TotalPrecipAdded = 0.0f;
     int32 CellsWithPrecip = 0;
@@ -9227,14 +9809,7 @@ void UWaterSystem::AccumulatePrecipitation(float DeltaTime)
     {
         for (int32 X = 0; X < Width; X += SampleStep)
         {
-            // Get world position for this grid cell
-            FVector WorldPos = OwnerTerrain->GetActorLocation() +
-                               FVector(X * OwnerTerrain->TerrainScale,
-                                       Y * OwnerTerrain->TerrainScale,
-                                       0.0f);
-
-            // Query precipitation rate from atmosphere (mm/hour)
-            float PrecipRate = Atmosphere->GetPrecipitationAt(WorldPos);
+            float PrecipRate = PrecipitationSampleScratch[(Y / SampleStep) * SamplesX + (X / SampleStep)];
 
             if (PrecipRate > 0.01f)
             {
@@ -9246,6 +9821,9 @@ void UWaterSystem::AccumulatePrecipitation(float DeltaTime)
                 // Apply to a region of cells around this sample point
                 int32 RegionEndX = FMath::Min(X + SampleStep, Width);
                 int32 RegionEndY = FMath::Min(Y + SampleStep, Height);
+                SimulationData.MarkRegionActive(X - FWaterSimulationData::ActiveHalo, Y - FWaterSimulationData::ActiveHalo,
+                                                RegionEndX - 1 + FWaterSimulationData::ActiveHalo,
+                                                RegionEndY - 1 + FWaterSimulationData::ActiveHalo);
 
                 for (int32 RY = Y; RY < RegionEndY; RY++)
                 {
@@ -9289,9 +9867,9 @@ void UWaterSystem::AccumulatePrecipitation(float DeltaTime)
 //    - Configures UAV access for compute shader writes
 //
 // 2. UpdateErosionTextures(): Upload current simulation data
-//    - Called every simulation frame (~60 Hz)
-//    - Copies WaterDepthMap and velocity arrays to GPU
-//    - Thread-safe upload via ENQUEUE_RENDER_COMMAND
+//    - Runs every simulation step as part of the fused water post-pass (Step 5c)
+//    - Copies only water tiles changed since the last upload into a staging ring slot
+//    - Thread-safe upload via ENQUEUE_RENDER_COMMAND, slot reused once its fence passes
 //
 // 3. CleanupErosionTextures(): Release GPU resources
 //    - Called during shutdown or before recreation
@@ -9304,8 +9882,8 @@ void UWaterSystem::AccumulatePrecipitation(float DeltaTime)
 //
 // THREAD SAFETY:
 // GPU uploads MUST be thread-safe:
-// - Game thread: Prepare data (copy to TArray)
-// - Render command: Transfer to render thread via lambda capture
+// - Game thread: Prepare data in a FGPUUploadStagingRing slot
+// - Render command: Reads the slot in place (fence-protected, no copy)
 // - Render thread: Execute RHICmdList.UpdateTexture2D
 // Never directly access GPU resources from game thread!
 //
@@ -9357,115 +9935,121 @@ void UWaterSystem::CreateErosionTextures()
     UE_LOG(LogTemp, Warning, TEXT(" Created erosion textures: %dx%d (Depth: R32F, Velocity: RG16F, Sediment: R32F)"),
            Width, Height);
     
-    // Initial population with current simulation data
+    // Initial population with current simulation data (fresh targets need every texel)
+    ErosionTextureDirtyRegions.Initialize(Width, Height, FWaterSimulationData::ActiveTileSize);
     UpdateErosionTextures();
 }
 
 
 void UWaterSystem::UpdateErosionTextures()
+{
+    // Staging is filled by the fused post-pass, on the tiles covered by the dirty regions
+    RunWaterPostPass(FWaterPostPass::Work_ErosionStaging);
+}
+
+FGPUUploadStagingRing::FSlot* UWaterSystem::BeginErosionUpload()
 {
     if (!ErosionWaterDepthRT || !ErosionFlowVelocityRT || !SimulationData.IsValid())
     {
-        return;
+        return nullptr;
     }
 
-    int32 Width = SimulationData.TerrainWidth;
-    int32 Height = SimulationData.TerrainHeight;
+    const int32 Width = SimulationData.TerrainWidth;
+    const int32 Height = SimulationData.TerrainHeight;
 
-    // Prepare data on game thread
-    TArray<float> DepthData;
-    TArray<FFloat16> VelocityData;
-    TArray<float> SedimentData;
+    if (!ErosionTextureDirtyRegions.Matches(Width, Height))
+    {
+        ErosionTextureDirtyRegions.Initialize(Width, Height, FWaterSimulationData::ActiveTileSize);
+    }
 
-    DepthData.SetNumUninitialized(Width * Height);
-    VelocityData.SetNumUninitialized(Width * Height * 2); // 2 channels (X, Y)
-    SedimentData.SetNumUninitialized(Width * Height);
+    // Raw simulation values, so only tiles the water step touched can differ from the last upload
+    CollectTextureDirtyRegions(EWaterChangeConsumer::ErosionTextures, ErosionTextureDirtyRegions, 0);
+    if (ErosionTextureDirtyRegions.IsEmpty())
+    {
+        return nullptr;
+    }
 
-    // Copy simulation data to upload buffers
-    for (int32 i = 0; i < SimulationData.WaterDepthMap.Num(); i++)
+    // One slot holds all three planes at full-texture layout: depth (R32F), velocity (RG16F), sediment (R32F)
+    FGPUUploadStagingRing::FSlot* Slot = ErosionUploadRing.Acquire(int64(Width) * Height * sizeof(float) * 3);
+    if (Slot)
     {
-        DepthData[i] = SimulationData.WaterDepthMap[i];
-        VelocityData[i * 2 + 0] = FFloat16(SimulationData.WaterVelocityX[i]);
-        VelocityData[i * 2 + 1] = FFloat16(SimulationData.WaterVelocityY[i]);
-        SedimentData[i] = (SimulationData.SedimentMap.Num() > i) ? SimulationData.SedimentMap[i] : 0.0f;
+        ErosionTextureDirtyRegions.Consume(Slot->Regions);
     }
+    return Slot;
+}
+
+void UWaterSystem::GetErosionStagingPlanes(FGPUUploadStagingRing::FSlot* Slot, FWaterPostPassOutputs& Outputs) const
+{
+    const int64 PlaneBytes = int64(SimulationData.TerrainWidth) * SimulationData.TerrainHeight * sizeof(float);
+    Outputs.ErosionDepth = reinterpret_cast<float*>(Slot->Data.GetData());
+    Outputs.ErosionVelocity = reinterpret_cast<FFloat16*>(Slot->Data.GetData() + PlaneBytes);
+    Outputs.ErosionSediment = reinterpret_cast<float*>(Slot->Data.GetData() + PlaneBytes * 2);
+}
+
+void UWaterSystem::SubmitErosionUpload(FGPUUploadStagingRing::FSlot* Slot)
+{
+    const int32 Width = SimulationData.TerrainWidth;
+    const int64 PlaneBytes = int64(Width) * SimulationData.TerrainHeight * sizeof(float);
+
+    // The slot stays untouched until the ring's fence passes, so the render thread reads it in place
+    const FGPUUploadStagingRing::FSlot* UploadSlot = Slot;
+    UTextureRenderTarget2D* DepthRT = ErosionWaterDepthRT;
+    UTextureRenderTarget2D* VelocityRT = ErosionFlowVelocityRT;
+    UTextureRenderTarget2D* SedimentRT = ErosionSedimentRT;
 
-    // Enqueue render command for GPU upload
     ENQUEUE_RENDER_COMMAND(UpdateErosionTextures)(
-        [this, DepthData = MoveTemp(DepthData), VelocityData = MoveTemp(VelocityData),
-         SedimentData = MoveTemp(SedimentData), Width, Height](FRHICommandListImmediate& RHICmdList)
+        [UploadSlot, DepthRT, VelocityRT, SedimentRT, Width, PlaneBytes](FRHICommandListImmediate& RHICmdList)
         {
-            // ===== UPDATE WATER DEPTH TEXTURE =====
-            FTextureRenderTargetResource* DepthResource = ErosionWaterDepthRT->GetRenderTargetResource();
-            if (DepthResource)
+            // Every region uses the full-texture stride, offset to its first texel. The offset is applied
+            // here, so the region handed to the RHI has a zero source origin (as UpdateTextureRegions does)
+            auto UploadPlane = [&RHICmdList, UploadSlot, Width](UTextureRenderTarget2D* RenderTarget, const uint8* Plane, uint32 BytesPerTexel)
             {
-                // MODERN UE5: Use FTextureRHIRef instead of deprecated FTexture2DRHIRef
-                FTextureRHIRef DepthTexture = DepthResource->GetRenderTargetTexture();
-
-                if (DepthTexture.IsValid())
+                FTextureRenderTargetResource* Resource = RenderTarget ? RenderTarget->GetRenderTargetResource() : nullptr;
+                if (!Resource)
                 {
-                    uint32 Stride = Width * sizeof(float);
-                    FUpdateTextureRegion2D Region(0, 0, 0, 0, Width, Height);
-
-                    // Modern RHI texture update
-                    RHICmdList.UpdateTexture2D(
-                        DepthTexture,
-                        0,  // Mip level
-                        Region,
-                        Stride,
-                        (const uint8*)DepthData.GetData()
-                    );
+                    return;
                 }
-            }
 
-            // ===== UPDATE FLOW VELOCITY TEXTURE =====
-            FTextureRenderTargetResource* VelocityResource = ErosionFlowVelocityRT->GetRenderTargetResource();
-            if (VelocityResource)
-            {
                 // MODERN UE5: Use FTextureRHIRef instead of deprecated FTexture2DRHIRef
-                FTextureRHIRef VelocityTexture = VelocityResource->GetRenderTargetTexture();
-
-                if (VelocityTexture.IsValid())
+                FTextureRHIRef Texture = Resource->GetRenderTargetTexture();
+                if (!Texture.IsValid())
                 {
-                    uint32 Stride = Width * sizeof(FFloat16) * 2; // 2 channels
-                    FUpdateTextureRegion2D Region(0, 0, 0, 0, Width, Height);
-
-                    // Modern RHI texture update
-                    RHICmdList.UpdateTexture2D(
-                        VelocityTexture,
-                        0,  // Mip level
-                        Region,
-                        Stride,
-                        (const uint8*)VelocityData.GetData()
-                    );
+                    return;
                 }
-            }
 
-            // ===== UPDATE SEDIMENT CONCENTRATION TEXTURE =====
-            if (ErosionSedimentRT)
-            {
-                FTextureRenderTargetResource* SedimentResource = ErosionSedimentRT->GetRenderTargetResource();
-                if (SedimentResource)
+                const uint32 Stride = Width * BytesPerTexel;
+                for (const FUpdateTextureRegion2D& Region : UploadSlot->Regions)
                 {
-                    FTextureRHIRef SedimentTexture = SedimentResource->GetRenderTargetTexture();
-
-                    if (SedimentTexture.IsValid())
-                    {
-                        uint32 Stride = Width * sizeof(float);
-                        FUpdateTextureRegion2D Region(0, 0, 0, 0, Width, Height);
-
-                        RHICmdList.UpdateTexture2D(
-                            SedimentTexture,
-                            0,  // Mip level
-                            Region,
-                            Stride,
-                            (const uint8*)SedimentData.GetData()
-                        );
-                    }
+                    const uint8* Source = Plane + (SIZE_T(Region.SrcY) * Width + Region.SrcX) * BytesPerTexel;
+                    FUpdateTextureRegion2D DestRegion = Region;
+                    DestRegion.SrcX = 0;
+                    DestRegion.SrcY = 0;
+                    RHICmdList.UpdateTexture2D(Texture, 0, DestRegion, Stride, Source);
                 }
-            }
+            };
+
+            const uint8* Base = UploadSlot->Data.GetData();
+
+            // ===== UPDATE WATER DEPTH TEXTURE =====
+            UploadPlane(DepthRT, Base, sizeof(float));
+
+            // ===== UPDATE FLOW VELOCITY TEXTURE =====
+            UploadPlane(VelocityRT, Base + PlaneBytes, sizeof(FFloat16) * 2);
+
+            // ===== UPDATE SEDIMENT CONCENTRATION TEXTURE =====
+            UploadPlane(SedimentRT, Base + PlaneBytes * 2, sizeof(float));
         }
     );
+
+    ErosionUploadRing.Submit(Slot);
+}
+
+void UWaterSystem::CollectTextureDirtyRegions(EWaterChangeConsumer Consumer, FTextureDirtyRegions& Regions, int32 Halo)
+{
+    SimulationData.ConsumeChangedTiles(Consumer, [&Regions, Halo](const FIntRect& TileRect)
+    {
+        Regions.MarkRect(FIntRect(TileRect.Min - FIntPoint(Halo), TileRect.Max + FIntPoint(Halo)));
+    });
 }
 
 void UWaterSystem::UpdateSedimentTexture()
@@ -9480,6 +10064,8 @@ void UWaterSystem::CleanupErosionTextures()
     UE_LOG(LogTemp, Verbose, TEXT("Cleaning up erosion textures..."));
     
     // PERFORMANCE FIX: Async cleanup - NO blocking flush (saves 5-8ms)
+    // Only uploads still reading the staging ring are waited on; they reference these targets
+    ErosionUploadRing.Flush();
     
     // Release water depth texture
     if (ErosionWaterDepthRT)
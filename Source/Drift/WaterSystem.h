@@ -73,6 +73,9 @@
 #include "AtmosphereController.h"
 #include "Engine/TextureRenderTarget2D.h"
 #include "Shaders/WaveComputeShader.h"
+#include "GPUUploadStaging.h"
+#include "GridFilter.h"
+#include "WaterPostPass.h"
 #include "WaterSystem.generated.h"
 
 // Forward declarations
@@ -175,6 +178,29 @@ struct FWaterRipple
     }
 };
 
+/**
+ * Per-band scratch for the parallel ApplyWaterFlow path.
+ * Kept on UWaterSystem and Reset() each step so steady-state steps do not allocate.
+ */
+struct FWaterFlowBandScratch
+{
+    struct FSeamDeposit
+    {
+        int32 Index;
+        float Delta;
+    };
+
+    struct FEdgeDrainage
+    {
+        int32 X;
+        int32 Y;
+        float Volume;
+    };
+
+    TArray<FSeamDeposit> SeamDeposits;    // Deposits into rows shared with a neighbouring band
+    TArray<FEdgeDrainage> EdgeDrainage;   // Outflow past the grid edge, reported on the game thread
+};
+
 struct FWaveTuningParams
 {
     // Classification
@@ -243,6 +269,17 @@ struct FWaterMaterialParams
     }
 };
 
+// Systems that consume "tiles whose water may have changed"; each keeps its own mask and clears it
+enum class EWaterChangeConsumer : uint8
+{
+    AtmosphereSurface,
+    DepthTexture,
+    ErosionTextures,
+    PostPass,           // Foam and per-chunk water aggregates
+
+    Count
+};
+
 /**
  * Water simulation data container for physics calculations
  * Layout: 2D grid flattened to 1D arrays using index = Y * Width + X
@@ -260,6 +297,39 @@ struct FWaterSimulationData
     TArray<float> SedimentMap;        // Suspended sediment concentration [0-10 kg/m³]
     TArray<float> FoamMap;            // Foam intensity for rendering (0-1)
 
+    // Persistent back buffers - solver passes write the next state here and swap
+    // with the front arrays above (TArray swap = pointer swap, no copy/allocation)
+    TArray<float> WaterDepthBack;
+    TArray<float> WaterVelocityXBack;
+    TArray<float> WaterVelocityYBack;
+    TArray<float> SedimentBack;
+    TArray<float> PreviousDepthMap;   // Post-flow depths from last step (oscillation detection)
+
+    // Terrain + water surface on a (Width + 2) x (Height + 2) grid for the vectorized flow
+    // kernel. The one-cell border holds MAX_flt so off-grid neighbours never attract flow.
+    TArray<float> PaddedSurfaceMap;
+
+    // Heap traffic of the solver buffers during the current step (0 in steady state)
+    int32 StepAllocationCount = 0;
+    int64 StepAllocatedBytes = 0;
+
+    // ===== SPARSE ACTIVE TILES =====
+    // Solver passes only visit tiles holding wet cells or their ActiveHalo-cell ring
+    // (one cell for water outflow, one more for the sediment that follows it).
+    // Visited columns are stored per tile row as [StartX, EndX) spans of consecutive
+    // active tiles: tile row R uses ActiveSpans[ActiveSpanOffsets[R] .. ActiveSpanOffsets[R + 1]).
+    static constexpr int32 ActiveTileSize = 16;
+    static constexpr int32 ActiveHalo = 2;
+    int32 ActiveTilesX = 0;
+    int32 ActiveTilesY = 0;
+    TArray<uint8> PendingActiveTiles;      // Tiles to visit next step (solver results + external edits)
+    TArray<uint8> ActiveTiles;             // Tiles visited this step
+    TArray<int32> ActiveTileList;          // Indices of set ActiveTiles, row-major
+    TArray<FIntPoint> ActiveSpans;
+    TArray<int32> ActiveSpanOffsets;
+    TArray<FIntRect> TileWetBounds;        // Scratch for RefreshActiveTiles (per tile, cell coords)
+    TArray<uint8> ChangedTiles[(int32)EWaterChangeConsumer::Count];   // Per consumer: tiles visited or marked since it last looked
+
     // System state
     bool bIsInitialized = false;
     int32 TerrainWidth = 0;
@@ -284,6 +354,12 @@ struct FWaterSimulationData
         SedimentMap.SetNum(TotalSize);
         FoamMap.SetNum(TotalSize);
 
+        WaterDepthBack.SetNum(TotalSize);
+        WaterVelocityXBack.SetNum(TotalSize);
+        WaterVelocityYBack.SetNum(TotalSize);
+        SedimentBack.SetNum(TotalSize);
+        PreviousDepthMap.SetNum(TotalSize);
+
         // Initialize all to zero
         for (int32 i = 0; i < TotalSize; i++)
         {
@@ -292,15 +368,72 @@ struct FWaterSimulationData
             WaterVelocityY[i] = 0.0f;
             SedimentMap[i] = 0.0f;
             FoamMap[i] = 0.0f;
+            PreviousDepthMap[i] = 0.0f;
         }
 
+        InitializeActiveTiles();
+
         bIsInitialized = true;
     }
 
+    // ===== SPARSE ACTIVE TILE INTERFACE (WaterSystem.cpp) =====
+    void InitializeActiveTiles();
+    void MarkRegionActive(int32 MinX, int32 MinY, int32 MaxX, int32 MaxY);
+    void MarkCellActive(int32 X, int32 Y) { MarkRegionActive(X - ActiveHalo, Y - ActiveHalo, X + ActiveHalo, Y + ActiveHalo); }
+    void MarkAllActive();
+
+    // Promote pending tiles to this step's active set and rebuild spans (bSparse = false visits everything)
+    void BuildActiveSpans(bool bSparse);
+
+    // Column spans to visit on grid row Y this step
+    TConstArrayView<FIntPoint> GetActiveSpans(int32 Y) const
+    {
+        const int32 TileRow = Y / ActiveTileSize;
+        const int32 First = ActiveSpanOffsets[TileRow];
+        return TConstArrayView<FIntPoint>(ActiveSpans.GetData() + First, ActiveSpanOffsets[TileRow + 1] - First);
+    }
+
+    int32 GetNumActiveTiles() const { return ActiveTileList.Num(); }
+
+    // Visits the cell rect (inclusive) of every tile whose water may have changed since Consumer last called this, then clears them
+    void ConsumeChangedTiles(EWaterChangeConsumer Consumer, TFunctionRef<void(const FIntRect&)> Visit);
+
     bool IsValid() const
     {
         return bIsInitialized && WaterDepthMap.Num() > 0;
     }
+
+    // Reset the per-step allocation counters (called at the start of each simulation step)
+    void BeginStepAllocationTracking()
+    {
+        StepAllocationCount = 0;
+        StepAllocatedBytes = 0;
+    }
+
+    // Size a solver buffer to match the grid; only counts as an allocation when capacity grows
+    template <typename ElementType>
+    void EnsureBuffer(TArray<ElementType>& Buffer, int32 TotalSize)
+    {
+        if (Buffer.Max() < TotalSize)
+        {
+            StepAllocationCount++;
+            StepAllocatedBytes += (int64)(TotalSize - Buffer.Max()) * sizeof(ElementType);
+        }
+        if (Buffer.Num() != TotalSize)
+        {
+            Buffer.SetNumUninitialized(TotalSize, EAllowShrinking::No);
+        }
+    }
+
+    // Record growth of a scratch container that was Reset() and refilled this step
+    void TrackScratchGrowth(int32 PreviousMax, int32 NewMax, int32 ElementSize)
+    {
+        if (NewMax > PreviousMax)
+        {
+            StepAllocationCount++;
+            StepAllocatedBytes += (int64)(NewMax - PreviousMax) * ElementSize;
+        }
+    }
 };
 
 
@@ -521,6 +654,9 @@ class DRIFT_API UWaterSystem : public UObject//,public IScalableSystem
 {
     GENERATED_BODY()
 
+    // Headless solver benchmark drives the private simulation passes directly
+    friend class UDriftBenchmarkCommandlet;
+
 public:
     UWaterSystem();
     
@@ -592,6 +728,10 @@ public:
     
     UFUNCTION(BlueprintCallable, Category = "Water Interaction")
     float GetWaterDepthAtIndex(int32 X, int32 Y) const;
+    
+    // Index into SimulationData arrays for a world position (INDEX_NONE off-grid).
+    // Callers with fixed sample points cache this and read GetSimulationData() directly.
+    int32 GetWaterCellIndexAtPosition(FVector WorldPosition) const;
 
 
     // ===== UTILITIES =====
@@ -604,6 +744,10 @@ public:
     
     UFUNCTION(BlueprintCallable, Category = "Water Utilities")
     float GetMaxFlowSpeed() const;
+
+    // Solver buffer allocations made by the last simulation step (0 = no heap traffic)
+    UFUNCTION(BlueprintPure, Category = "Water Utilities")
+    int32 GetLastStepAllocationCount() const { return SimulationData.StepAllocationCount; }
     
     UFUNCTION(BlueprintCallable, Category = "Water Terrain")
     float GetTerrainGradientMagnitude(FVector2D WorldPos) const;
@@ -655,6 +799,38 @@ public:
               meta = (ClampMin = "0.0", ClampMax = "0.95"))
     float CohesionStrength = 0.7f;
 
+    // ===== PARALLEL SOLVER SETTINGS =====
+
+    // Run CalculateWaterFlow/ApplyWaterFlow across worker threads in row bands
+    // Seam rows between bands are merged in serial order, so results match the serial path exactly
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Water Physics|Parallel Solver")
+    bool bUseParallelWaterSolver = true;
+
+    // Rows per band - fixed (not per-core) so output never depends on thread count
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Water Physics|Parallel Solver",
+              meta = (ClampMin = "4", ClampMax = "256"))
+    int32 ParallelSolverBandRows = 32;
+
+    // Compute 8-directional flow forces four cells at a time (SSE/NEON) from a padded
+    // surface grid instead of per-neighbour GetHeightSafe calls
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Water Physics|Parallel Solver")
+    bool bUseVectorizedFlowKernel = true;
+
+    // ===== SPARSE SIMULATION SETTINGS =====
+
+    // Only visit 16x16 tiles that hold water (plus a two-cell halo) in the flow, sediment,
+    // evaporation and foam passes - dry regions of the grid cost nothing
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Water Physics|Sparse Simulation")
+    bool bUseSparseWaterSimulation = true;
+
+    // Full-grid rescan every N steps as a safety net for writes that bypass the tile markers (0 = never)
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Water Physics|Sparse Simulation",
+              meta = (ClampMin = "0", ClampMax = "10000"))
+    int32 SparseFullRescanInterval = 120;
+
+    UFUNCTION(BlueprintPure, Category = "Water Physics|Sparse Simulation")
+    int32 GetActiveTileCount() const { return SimulationData.GetNumActiveTiles(); }
+
 
     // ===== SEDIMENT TRANSPORT SETTINGS =====
 
@@ -1283,7 +1459,7 @@ public:
 
 private:
     
-    void ApplyEdgePreservingFilter(TArray<float>& Buffer, int32 Width, int32 Height);
+    void ApplyEdgePreservingFilter(const FPaddedGrid& Source, FPaddedGrid& Dest, const FIntRect& ImageRect);
     
     bool HasWaterNeighbor(int32 X, int32 Y) const;
     
@@ -1318,6 +1494,14 @@ private:
     
     // ===== INTERNAL FUNCTIONS =====
     
+    // Parallel ApplyWaterFlow band scratch (persistent, see FWaterFlowBandScratch)
+    TArray<FWaterFlowBandScratch> FlowBandScratch;
+
+    // Sparse tile bookkeeping - marks tiles holding water after this step for the next one
+    void RefreshActiveTiles();
+    int32 StepsSinceFullRescan = 0;
+    bool bSparseTilesTracked = false;
+
     // Core water simulation
     void CalculateWaterFlow(float DeltaTime);
     void ApplyWaterFlow(float DeltaTime);
@@ -1541,6 +1725,21 @@ public:
     
     void UpdateGPUWaterChunks();
     
+    // Creates, rebuilds or hides the displaced surface mesh of one terrain chunk after its water occupancy changed
+    void RefreshDisplacedWaterChunk(int32 ChunkIndex, bool bChunkHasWater);
+    
+    // Water surface chunk for a terrain chunk index (or null) through the index below, not a linear search
+    FWaterSurfaceChunk* FindWaterSurfaceChunk(int32 TerrainChunkIndex);
+    const FWaterSurfaceChunk* FindWaterSurfaceChunk(int32 TerrainChunkIndex) const;
+    
+    // Terrain chunk index -> WaterSurfaceChunks index (INDEX_NONE if it has none). Chunks are only
+    // appended or removed, so the index is rebuilt when the length or last chunk changes, and
+    // every hit is also checked against the chunk's own index
+    void RebuildWaterChunkIndex() const;
+    mutable TArray<int32> WaterChunkByTerrainChunk;
+    mutable int32 IndexedWaterChunkCount = INDEX_NONE;
+    mutable int32 IndexedLastWaterChunk = INDEX_NONE;
+    
     
 
 protected:
@@ -1604,6 +1803,48 @@ private:
 
         UPROPERTY()
         UTextureRenderTarget2D* PrecipitationInputTexture = nullptr;
+
+        // Atmosphere precipitation resampled onto the SampleStep lattice (reused every tick)
+        TArray<float> PrecipitationSampleScratch;
+
+    private:
+        // ===== GPU UPLOAD STAGING =====
+        // Texture uploads only send texels under changed water tiles, through fence-tracked staging rings
+        void CollectTextureDirtyRegions(EWaterChangeConsumer Consumer, FTextureDirtyRegions& Regions, int32 Halo);
+
+        // Ping-pong windows around each dirty region for the depth texture's smoothing chain
+        FPaddedGrid DepthTextureFilterGrids[2];
+        FGridFilter DepthTextureFilter;
+        FTextureDirtyRegions DepthTextureDirtyRegions;
+        FGPUUploadStagingRing DepthTextureUploadRing;
+        uint32 DepthTextureSettingsHash = 0;
+
+        FTextureDirtyRegions ErosionTextureDirtyRegions;
+        FGPUUploadStagingRing ErosionUploadRing;
+
+        // Begin* collects the dirty regions into an acquired slot (null when clean or the ring is full);
+        // Submit* enqueues the uploads of a filled slot
+        FGPUUploadStagingRing::FSlot* BeginDepthTextureUpload(int32 FilterHalo);
+        void SubmitDepthTextureUpload(FGPUUploadStagingRing::FSlot* Slot);
+        FGPUUploadStagingRing::FSlot* BeginErosionUpload();
+        void GetErosionStagingPlanes(FGPUUploadStagingRing::FSlot* Slot, FWaterPostPassOutputs& Outputs) const;
+        void SubmitErosionUpload(FGPUUploadStagingRing::FSlot* Slot);
+
+        // ===== FUSED POST-PASS =====
+        // Foam, texture staging and chunk aggregates from one sweep over changed tiles (FWaterPostPass::EWork bits)
+        void RunWaterPostPass(uint8 Work);
+        bool EnsureWaterPostPassLayout();
+
+        // Cached aggregates for a terrain chunk index, or null when the table does not cover it
+        const FWaterChunkStats* FindChunkWaterStats(int32 ChunkIndex) const;
+        bool HasChunkWaterStatsTable() const;   // Post-pass chunk layout matches the terrain's
+
+        FWaterPostPass WaterPostPass;
+
+        // ===== SIMULATION SMOOTHING =====
+        // Snapshot of the depth cells the smoothing passes read (active tiles only)
+        FPaddedGrid SmoothingSourceGrid;
+        FGridFilter SimulationSmoothingFilter;
 };
 
 